@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEASYMM_H__
 #define __ARM_COMPUTE_NEASYMM_H__
 
+#include <algorithm>
 #include <arm_neon.h>
 
 namespace arm_compute
@@ -125,6 +126,49 @@ uint8x16_t finalize_quantization(int32x4x4_t &in_s32,
     return out_u8;
 }
 
+/** Performs final quantization step on single element
+ *
+ * @tparam is_bounded_relu Specified if a fused bounded relu should be applied
+ *
+ * @param[in] in_s32                        Input to be quantized, duplicated across all four lanes.
+ * @param[in] result_fixedpoint_multiplier  Result multiplier parameter
+ * @param[in] result_shift                  Result shift parameter
+ * @param[in] result_offset_after_shift_s32 Result offset parameter
+ * @param[in] min_u8                        Relu lower bound
+ * @param[in] max_u8                        Relu upper bound
+ *
+ * @return Quantized value
+ */
+template <bool is_bounded_relu>
+inline uint8_t finalize_quantization(int32x4_t in_s32, int result_fixedpoint_multiplier, int32_t result_shift, int32x4_t result_offset_after_shift_s32, uint8_t min_u8, uint8_t max_u8)
+{
+    const static int32x4_t zero_s32      = vdupq_n_s32(0);
+    const static int32x4_t sat_value_s32 = vdupq_n_s32(255);
+
+    // Fixed point multiplication with vector saturating rounding doubling multiply high with scalar
+    in_s32 = vqrdmulhq_n_s32(in_s32, result_fixedpoint_multiplier);
+
+    // Round to the nearest division by a power-of-two using result_shift_s32
+    in_s32 = rounding_divide_by_pow2(in_s32, result_shift);
+
+    // Add the offset terms
+    in_s32 = vaddq_s32(in_s32, result_offset_after_shift_s32);
+
+    // Saturate negative values
+    in_s32 = vmaxq_s32(in_s32, zero_s32);
+    in_s32 = vminq_s32(in_s32, sat_value_s32);
+
+    auto out_u8 = static_cast<uint8_t>(vgetq_lane_s32(in_s32, 0));
+
+    if(is_bounded_relu)
+    {
+        out_u8 = std::max(out_u8, min_u8);
+        out_u8 = std::min(out_u8, max_u8);
+    }
+
+    return out_u8;
+}
+
 /** Dequantize a neon vector holding 16 quantized values.
  *
  * @param qv                            Input values to be dequantized.
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBINARIZEINPUTKERNEL_H__
+#define __ARM_COMPUTE_NEBINARIZEINPUTKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel which prepares the input of a binary convolution in a single pass.
+ *
+ * It fuses the padding, the binarization and the computation of the K scaling map:
+ * - The signs of the implicitly zero-padded input are packed as done by @ref NEBinarySignKernel.
+ * - K is the average, over each kernel window, of the mean over absolute values over channels of the padded input,
+ *   as would be computed by an AVG pooling layer run on the beta tensor of @ref NEBinarySignKernel.
+ *
+ * Each thread keeps the beta values of the last kernel_height padded rows in its own slice of a temporary tensor,
+ * so the input is read once (plus the overlapping rows at the boundaries between threads).
+ *
+ * The input can also be already binarized by the output stage of a previous binary layer, in which case its packed signs are only
+ * padded and its beta tensor is used to compute K.
+ */
+class NEBinarizeInputKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEBinarizeInputKernel";
+    }
+    /** Default constructor */
+    NEBinarizeInputKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinarizeInputKernel(const NEBinarizeInputKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinarizeInputKernel &operator=(const NEBinarizeInputKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEBinarizeInputKernel(NEBinarizeInputKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEBinarizeInputKernel &operator=(NEBinarizeInputKernel &&) = default;
+    /** Default destructor */
+    ~NEBinarizeInputKernel() = default;
+
+    /** Set the input and outputs of the kernel.
+     *
+     * @param[in]  input      Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                        while every optional dimension from 4 and above represent a batch of inputs.
+     *                        Data types supported: F32, or U8 if @p input_beta is provided. Data layouts supported: NCHW/NHWC.
+     * @param[out] output     Binarized padded input. Data types supported: U8.
+     * @param[out] K          K scaling map. It has the same shape as the output of the convolution, with a single channel.
+     *                        Data types supported: F32.
+     * @param[in]  tmp        Temporary tensor with at least padded_width * (kernel_height + 1) elements in its first dimension
+     *                        and one row for each thread. Data types supported: F32.
+     * @param[in]  kernel_sz  Size of the kernel of the convolution.
+     * @param[in]  conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  input_beta (Optional) Mean over absolute values over channels of each element of the input. If provided, @p input contains
+     *                        the signs of the input packed without padding, as computed by @ref NEBinaryConvolutionKernel or @ref NEBinaryGEMMKernel,
+     *                        and its data type is U8. It has the shape of the unpacked input, with a single channel. Data types supported: F32.
+     */
+    void configure(const ITensor *input, ITensor *output, ITensor *K, ITensor *tmp, const Size2D &kernel_sz, const PadStrideInfo &conv_info,
+                   const ITensor *input_beta = nullptr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBinarizeInputKernel
+     *
+     * @param[in] input      Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while every optional dimension from 4 and above represent a batch of inputs.
+     *                       Data types supported: F32, or U8 if @p input_beta is provided. Data layouts supported: NCHW/NHWC.
+     * @param[in] output     Binarized padded input. Data types supported: U8.
+     * @param[in] K          K scaling map. It has the same shape as the output of the convolution, with a single channel.
+     *                       Data types supported: F32.
+     * @param[in] tmp        Temporary tensor with at least padded_width * (kernel_height + 1) elements in its first dimension
+     *                       and one row for each thread. Data types supported: F32.
+     * @param[in] kernel_sz  Size of the kernel of the convolution.
+     * @param[in] conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] input_beta (Optional) Mean over absolute values over channels of each element of the input. If provided, @p input contains
+     *                       the signs of the input packed without padding, as computed by @ref NEBinaryConvolutionKernel or @ref NEBinaryGEMMKernel,
+     *                       and its data type is U8. It has the shape of the unpacked input, with a single channel. Data types supported: F32.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *K, const ITensorInfo *tmp, const Size2D &kernel_sz,
+                           const PadStrideInfo &conv_info, const ITensorInfo *input_beta = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common signature for the functions binarizing a padded row
+     *
+     * @param[in]  row        Index of the row in the padded input.
+     * @param[in]  batch      Index of the batch.
+     * @param[out] beta_row   Mean over absolute values over channels of each element of the padded row.
+     * @param[in]  write_bits True if the packed signs of the row have to be written to the output.
+     */
+    using BinarizeRowFunction = void (NEBinarizeInputKernel::*)(int row, int batch, float *beta_row, bool write_bits);
+
+    /** Binarize a padded row of an NCHW input
+     *
+     * @param[in]  row        Index of the row in the padded input.
+     * @param[in]  batch      Index of the batch.
+     * @param[out] beta_row   Mean over absolute values over channels of each element of the padded row.
+     * @param[in]  write_bits True if the packed signs of the row have to be written to the output.
+     */
+    void binarize_row_nchw(int row, int batch, float *beta_row, bool write_bits);
+    /** Binarize a padded row of an NHWC input
+     *
+     * @param[in]  row        Index of the row in the padded input.
+     * @param[in]  batch      Index of the batch.
+     * @param[out] beta_row   Mean over absolute values over channels of each element of the padded row.
+     * @param[in]  write_bits True if the packed signs of the row have to be written to the output.
+     */
+    void binarize_row_nhwc(int row, int batch, float *beta_row, bool write_bits);
+    /** Pad a row of an already binarized NCHW input
+     *
+     * @param[in]  row        Index of the row in the padded input.
+     * @param[in]  batch      Index of the batch.
+     * @param[out] beta_row   Mean over absolute values over channels of each element of the padded row.
+     * @param[in]  write_bits True if the packed signs of the row have to be written to the output.
+     */
+    void copy_row_nchw(int row, int batch, float *beta_row, bool write_bits);
+    /** Pad a row of an already binarized NHWC input
+     *
+     * @param[in]  row        Index of the row in the padded input.
+     * @param[in]  batch      Index of the batch.
+     * @param[out] beta_row   Mean over absolute values over channels of each element of the padded row.
+     * @param[in]  write_bits True if the packed signs of the row have to be written to the output.
+     */
+    void copy_row_nhwc(int row, int batch, float *beta_row, bool write_bits);
+
+    BinarizeRowFunction _func;       /**< Row binarization function to use for the configured data layout */
+    const ITensor      *_input;      /**< Source tensor */
+    const ITensor      *_input_beta; /**< Beta tensor of the already binarized source tensor */
+    ITensor            *_output;     /**< Binarized padded input */
+    ITensor            *_K;          /**< K scaling map */
+    ITensor            *_tmp;        /**< Temporary tensor for the beta values of each thread */
+    Size2D              _kernel_sz;  /**< Kernel size of the convolution */
+    PadStrideInfo       _conv_info;  /**< Padding and stride information */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEBINARIZEINPUTKERNEL_H__ */
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBINARYALPHAKERNEL_H__
+#define __ARM_COMPUTE_NEBINARYALPHAKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel reducing the partial sums of @ref NEBinarySignKernel into the alpha tensor.
+ *
+ * Each alpha value is the mean over absolute values of a 3D input block, computed by adding up the partial sums of the block
+ * always in the same order and dividing them by the number of elements of the block.
+ */
+class NEBinaryAlphaKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEBinaryAlphaKernel";
+    }
+    /** Default constructor */
+    NEBinaryAlphaKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryAlphaKernel(const NEBinaryAlphaKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryAlphaKernel &operator=(const NEBinaryAlphaKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEBinaryAlphaKernel(NEBinaryAlphaKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEBinaryAlphaKernel &operator=(NEBinaryAlphaKernel &&) = default;
+    /** Default destructor */
+    ~NEBinaryAlphaKernel() = default;
+
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  partial_sums Partial sums tensor computed by @ref NEBinarySignKernel. 3 lower dimensions represent the partial sums of a single block,
+     *                          while every optional dimension from 4 and above represent a batch of blocks. Data types supported: F32.
+     * @param[out] alpha        Alpha tensor with one value for every block. Data types supported: Same as @p partial_sums.
+     * @param[in]  num_elems    Number of elements of each block of the binarized tensor.
+     */
+    void configure(const ITensor *partial_sums, ITensor *alpha, unsigned int num_elems);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBinaryAlphaKernel
+     *
+     * @param[in] partial_sums Partial sums tensor computed by @ref NEBinarySignKernel. 3 lower dimensions represent the partial sums of a single block,
+     *                         while every optional dimension from 4 and above represent a batch of blocks. Data types supported: F32.
+     * @param[in] alpha        Alpha tensor with one value for every block. Data types supported: Same as @p partial_sums.
+     * @param[in] num_elems    Number of elements of each block of the binarized tensor.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *partial_sums, const ITensorInfo *alpha, unsigned int num_elems);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_partial_sums; /**< Partial sums tensor */
+    ITensor       *_alpha;        /**< Alpha tensor */
+    unsigned int   _num_elems;    /**< Number of elements of each block */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEBINARYALPHAKERNEL_H__ */
@@ -30,7 +30,16 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Interface for the binary convolution (XNOR popcount + normalization) operation kernel. */
+/** Interface for the binary convolution (XNOR popcount + normalization) operation kernel.
+ *
+ * For each block of output pixels, the binarized input patches are gathered once with the same layout as the binarized weights
+ * and then compared against the weights of every OFM with a vectorized XNOR-popcount.
+ * With the NHWC data layout the channels are packed in whole 128-bit words, so every kernel row is a contiguous bit string
+ * in both the input and the weights and no gathering is needed.
+ *
+ * The output stage can clamp the results with an activation function and, instead of writing them, binarize them
+ * for a following binary layer.
+ */
 class NEBinaryConvolutionKernel : public INEKernel
 {
 public:
@@ -54,50 +63,94 @@ public:
     
     /** Set the inputs and output images
      *
-     * @param[in]  input     Source tensor (binarized). Data types supported: U8.
-     * @param[in]  weights   Weights tensor (binarized). Data type supported: Same as @p input.
-     * @param[in]  biases    Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: F32
-     * @param[out] output    Destination tensor. Data types supported: F32.
-     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
-     * @param[out] alpha     Alpha tensor. Mean over absolute values of each original 3D weight.
-     *                       Calculated using @ref NEBinarySignKernel. Data types supported: F32.
-     * @param[out] beta      Beta tensor. Normalized mean over absolute values over channels of the original input.
-     *                       Calculated using @ref NEBinarySignKernel. Data types supported: F32.
-     * @param[in]  kernel_sz Size of the original (non-binirized) kernel
-     * 
+     * @note Padding must be applied to the input before binarization, therefore @p conv_info must not contain any padding.
+     *
+     * @param[in]  input        Source tensor (binarized). 8 consecutive input values are packed along X (NCHW) or along the channels (NHWC) in every byte.
+     *                          Data types supported: U8.
+     * @param[in]  weights      Weights tensor (binarized). Data type supported: Same as @p input.
+     * @param[in]  biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: F32
+     * @param[out] output       Destination tensor. Data types supported: F32, or U8 to store the signs of the results packed like @p input,
+     *                          without any padding.
+     * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[out] alpha        Alpha tensor. Mean over absolute values of each original 3D weight.
+     *                          Calculated using @ref NEBinarySignKernel. Data types supported: F32.
+     * @param[out] beta         Beta tensor. Normalized mean over absolute values over channels of the original input, averaged over each kernel window.
+     *                          It has the same shape as @p output, with a single channel. Data types supported: F32.
+     * @param[in]  kernel_sz    Size of the original (non-binirized) kernel. With the NCHW data layout, the kernel width must not be greater than 57.
+     * @param[in]  num_channels (Optional) Number of channels of the original (non-binarized) input. Only used with the NHWC data layout,
+     *                          where it can't be deduced from the packed channels.
+     * @param[in]  act_info     (Optional) Activation layer information. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[out] output_beta  (Optional) Mean over absolute values over channels of the results. Required if @p output is U8, otherwise ignored.
+     *                          It has the shape of the non-binarized output, with a single channel. Data types supported: F32.
+     *
      */
-    void configure(ITensor *input, ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
-                   const ITensor *alpha, ITensor *beta, const Size2D &kernel_sz);
-    
+    void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                   const ITensor *alpha, ITensor *beta, const Size2D &kernel_sz, unsigned int num_channels = 0,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), ITensor *output_beta = nullptr);
+
     /** Static function to check if given info will lead to a valid configuration of @ref NEBinaryConvolutionKernel
      *
-     * @param[in] input     Source tensor (binarized). Data types supported: U8.
-     * @param[in] weights   Weights tensor (binarized). Data type supported: Same as @p input.
-     * @param[in] biases    Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: F32
-     * @param[in] output    Destination tensor. Data types supported: F32.
-     * @param[in] conv_info Contains padding and stride information described in @ref PadStrideInfo.
-     * @param[in] alpha     Alpha tensor. Mean over absolute values of each original 3D weight.
-     *                      Calculated using @ref NEBinarySignKernel. Data types supported: F32.
-     * @param[in] beta      Beta tensor. Normalized mean over absolute values over channels of the original input.
-     *                      Calculated using @ref NEBinarySignKernel. Data types supported: F32.
-     * @param[in] kernel_sz Size of the original (non-binirized) kernel
+     * @param[in] input        Source tensor (binarized). 8 consecutive input values are packed along X (NCHW) or along the channels (NHWC) in every byte.
+     *                         Data types supported: U8.
+     * @param[in] weights      Weights tensor (binarized). Data type supported: Same as @p input.
+     * @param[in] biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: F32
+     * @param[in] output       Destination tensor. Data types supported: F32, or U8 to store the signs of the results packed like @p input,
+     *                         without any padding.
+     * @param[in] conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] alpha        Alpha tensor. Mean over absolute values of each original 3D weight.
+     *                         Calculated using @ref NEBinarySignKernel. Data types supported: F32.
+     * @param[in] beta         Beta tensor. Normalized mean over absolute values over channels of the original input, averaged over each kernel window.
+     *                         It has the same shape as @p output, with a single channel. Data types supported: F32.
+     * @param[in] kernel_sz    Size of the original (non-binirized) kernel. With the NCHW data layout, the kernel width must not be greater than 57.
+     * @param[in] num_channels (Optional) Number of channels of the original (non-binarized) input. Only used with the NHWC data layout,
+     *                         where it can't be deduced from the packed channels.
+     * @param[in] act_info     (Optional) Activation layer information. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in] output_beta  (Optional) Mean over absolute values over channels of the results. Required if @p output is U8, otherwise ignored.
+     *                         It has the shape of the non-binarized output, with a single channel. Data types supported: F32.
      *
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
-                           const PadStrideInfo &conv_info, const ITensorInfo *alpha, const ITensorInfo *beta, const Size2D &kernel_sz);
+                           const PadStrideInfo &conv_info, const ITensorInfo *alpha, const ITensorInfo *beta, const Size2D &kernel_sz,
+                           unsigned int num_channels = 0, const ActivationLayerInfo &act_info = ActivationLayerInfo(), const ITensorInfo *output_beta = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    ITensor       *_input;   /**< Source tensor */
-    ITensor       *_weights; /**< Weights tensor */
-    const ITensor *_biases;  /**< Biases tensor */
-    ITensor       *_output;  /**< Destination tensor */
-    const ITensor *_alpha;   /**< Alpha tensor */
-    const ITensor *_beta;    /**< Beta tensor */
-    unsigned int   _num_elems_written_per_iteration;
+    /** Common signature for all the specialised binary convolution functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using BinaryConvolutionFunction = void (NEBinaryConvolutionKernel::*)(const Window &window);
+
+    /** Function to perform the binary convolution on the given window
+     *
+     * @note A template argument equal to 0 means that the corresponding value is only known at runtime.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <unsigned int kernel_w, unsigned int kernel_h, unsigned int stride_x>
+    void binary_convolution(const Window &window);
+    /** Function to perform the binary convolution on the given window with the NHWC data layout
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void binary_convolution_nhwc(const Window &window);
+
+    BinaryConvolutionFunction _func;         /**< Binary convolution function to use for the configured data layout, kernel size and stride */
+    ITensor                  *_input;        /**< Source tensor */
+    const ITensor            *_weights;      /**< Weights tensor */
+    const ITensor            *_biases;       /**< Biases tensor */
+    ITensor                  *_output;       /**< Destination tensor */
+    const ITensor            *_alpha;        /**< Alpha tensor */
+    const ITensor            *_beta;         /**< Beta tensor */
+    ITensor                  *_output_beta;  /**< Beta tensor of the binarized output */
+    Size2D                    _kernel_sz;    /**< Size of the original kernel */
+    PadStrideInfo             _conv_info;    /**< Stride information */
+    unsigned int              _num_channels; /**< Number of channels of the original input */
+    float                     _act_min;      /**< Lower bound of the activation function */
+    float                     _act_max;      /**< Upper bound of the activation function */
 };
 } // namespace arm_compute
-#endif /* __ARM_COMPUTE_CLBINARYCONVOLUTIONKERNEL_H__ */
+#endif /* __ARM_COMPUTE_NEBINARYCONVOLUTIONKERNEL_H__ */
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBINARYGEMMKERNEL_H__
+#define __ARM_COMPUTE_NEBINARYGEMMKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the binary matrix multiplication (XNOR popcount + normalization) kernel.
+ *
+ * Both matrices contain packed bit strings along the first dimension: each row of @p a is the binarized input of an output row
+ * (e.g. the im2col row of an output pixel, or a sample of a fully connected layer) and each row of @p b is the binarized weights
+ * of an output column (OFM). The kernel computes:
+ *
+ * @f[ output_{m,n} = (num\_elems - 2 \cdot popcount(a_m \oplus b_n)) \cdot alpha_n \cdot beta_m + bias_n @f]
+ *
+ * The output is tiled in blocks of rows so that each row of @p b is reused from the cache for the whole block,
+ * while a register-blocked micro-kernel computes 4x4 outputs at a time.
+ *
+ * The output stage can clamp the results with an activation function and, instead of writing them, binarize each output row
+ * for a following binary layer.
+ */
+class NEBinaryGEMMKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEBinaryGEMMKernel";
+    }
+    /** Default constructor */
+    NEBinaryGEMMKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryGEMMKernel(const NEBinaryGEMMKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryGEMMKernel &operator=(const NEBinaryGEMMKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEBinaryGEMMKernel(NEBinaryGEMMKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEBinaryGEMMKernel &operator=(NEBinaryGEMMKernel &&) = default;
+    /** Default destructor */
+    ~NEBinaryGEMMKernel() = default;
+
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  a                   LHS matrix (binarized) with dimensions [K, M, batches], K being the number of bytes of each row.
+     *                                 Data types supported: U8.
+     * @param[in]  b                   Transposed RHS matrix (binarized). It must contain N rows of K bytes each, contiguous in memory,
+     *                                 so a 4D tensor of binarized NHWC weights can be passed directly. Data types supported: Same as @p a.
+     * @param[in]  biases              Biases tensor. Biases are 1D tensor with dimensions [N]. Can be nullptr. Data type supported: F32
+     * @param[out] output              Destination tensor with dimensions [N, M, batches], or [N, M / depth_output_gemm3d, depth_output_gemm3d, batches].
+     *                                 Data types supported: F32, or U8 to store the signs of each row packed in multiples of 16 bytes.
+     * @param[in]  alpha               Scale of each column of the output, with N elements contiguous in memory. Data types supported: F32.
+     * @param[in]  beta                Scale of each row of the output. It has the same shape as @p output, with a single element in the first dimension.
+     *                                 Data types supported: F32.
+     * @param[in]  num_elems           Number of binarized values in each row of @p a and @p b, excluding the padding bits.
+     * @param[in]  depth_output_gemm3d (Optional) Depth of the output when it is reinterpreted as 3D (e.g. the height of an NHWC convolution output).
+     *                                 If 0, the output is not reinterpreted. Defaults to 0.
+     * @param[in]  act_info            (Optional) Activation layer information. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[out] output_beta         (Optional) Mean over absolute values of each row of the results. Required if @p output is U8, otherwise ignored.
+     *                                 It has the same shape as @p beta. Data types supported: F32.
+     */
+    void configure(const ITensor *a, const ITensor *b, const ITensor *biases, ITensor *output, const ITensor *alpha, const ITensor *beta,
+                   unsigned int num_elems, unsigned int depth_output_gemm3d = 0, const ActivationLayerInfo &act_info = ActivationLayerInfo(), ITensor *output_beta = nullptr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBinaryGEMMKernel
+     *
+     * @param[in] a                   LHS matrix (binarized) with dimensions [K, M, batches], K being the number of bytes of each row.
+     *                                Data types supported: U8.
+     * @param[in] b                   Transposed RHS matrix (binarized). It must contain N rows of K bytes each, contiguous in memory,
+     *                                so a 4D tensor of binarized NHWC weights can be passed directly. Data types supported: Same as @p a.
+     * @param[in] biases              Biases tensor. Biases are 1D tensor with dimensions [N]. Can be nullptr. Data type supported: F32
+     * @param[in] output              Destination tensor with dimensions [N, M, batches], or [N, M / depth_output_gemm3d, depth_output_gemm3d, batches].
+     *                                Data types supported: F32, or U8 to store the signs of each row packed in multiples of 16 bytes.
+     * @param[in] alpha               Scale of each column of the output, with N elements contiguous in memory. Data types supported: F32.
+     * @param[in] beta                Scale of each row of the output. It has the same shape as @p output, with a single element in the first dimension.
+     *                                Data types supported: F32.
+     * @param[in] num_elems           Number of binarized values in each row of @p a and @p b, excluding the padding bits.
+     * @param[in] depth_output_gemm3d (Optional) Depth of the output when it is reinterpreted as 3D (e.g. the height of an NHWC convolution output).
+     *                                If 0, the output is not reinterpreted. Defaults to 0.
+     * @param[in] act_info            (Optional) Activation layer information. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in] output_beta         (Optional) Mean over absolute values of each row of the results. Required if @p output is U8, otherwise ignored.
+     *                                It has the same shape as @p beta. Data types supported: F32.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *biases, const ITensorInfo *output, const ITensorInfo *alpha,
+                           const ITensorInfo *beta, unsigned int num_elems, unsigned int depth_output_gemm3d = 0,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo(), const ITensorInfo *output_beta = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_a;                   /**< LHS matrix */
+    const ITensor *_b;                   /**< Transposed RHS matrix */
+    const ITensor *_biases;              /**< Biases tensor */
+    ITensor       *_output;              /**< Destination tensor */
+    const ITensor *_alpha;               /**< Scale of each output column */
+    const ITensor *_beta;                /**< Scale of each output row */
+    ITensor       *_output_beta;         /**< Beta tensor of the binarized output */
+    unsigned int   _num_elems;           /**< Number of valid bits in each row */
+    unsigned int   _depth_output_gemm3d; /**< Depth of the output reinterpreted as 3D */
+    float          _act_min;             /**< Lower bound of the activation function */
+    float          _act_max;             /**< Upper bound of the activation function */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEBINARYGEMMKERNEL_H__ */
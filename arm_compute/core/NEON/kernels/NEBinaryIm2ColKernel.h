@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBINARYIM2COLKERNEL_H__
+#define __ARM_COMPUTE_NEBINARYIM2COLKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the im2col kernel of a binarized tensor.
+ *
+ * The input must have been binarized with the NHWC data layout by @ref NEBinarySignKernel, so that the packed channels of
+ * each spatial location are a contiguous bit string. Every output row contains the concatenation of the kernel_height rows
+ * of the corresponding kernel window, which is the same layout as the binarized weights of each OFM.
+ */
+class NEBinaryIm2ColKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEBinaryIm2ColKernel";
+    }
+    /** Default constructor */
+    NEBinaryIm2ColKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryIm2ColKernel(const NEBinaryIm2ColKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryIm2ColKernel &operator=(const NEBinaryIm2ColKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEBinaryIm2ColKernel(NEBinaryIm2ColKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEBinaryIm2ColKernel &operator=(NEBinaryIm2ColKernel &&) = default;
+    /** Default destructor */
+    ~NEBinaryIm2ColKernel() = default;
+
+    /** Set the input and output of the kernel.
+     *
+     * @note Padding must be applied to the input before binarization, therefore @p conv_info must not contain any padding.
+     *
+     * @param[in]  input       Source tensor (binarized). 3 lower dimensions represent a single input [packed channels, width, height],
+     *                         while every optional dimension from 4 and above represent a batch of inputs.
+     *                         Data types supported: U8. Data layouts supported: NHWC.
+     * @param[out] output      Destination tensor. Its shape is [kernel_width * kernel_height * packed channels, output width * output height, batches].
+     *                         Data types supported: Same as @p input.
+     * @param[in]  kernel_dims The kernel dimensions (width and height).
+     * @param[in]  conv_info   Contains stride information described in @ref PadStrideInfo.
+     */
+    void configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBinaryIm2ColKernel
+     *
+     * @param[in] input       Source tensor (binarized). 3 lower dimensions represent a single input [packed channels, width, height],
+     *                        while every optional dimension from 4 and above represent a batch of inputs.
+     *                        Data types supported: U8. Data layouts supported: NHWC.
+     * @param[in] output      Destination tensor. Its shape is [kernel_width * kernel_height * packed channels, output width * output height, batches].
+     *                        Data types supported: Same as @p input.
+     * @param[in] kernel_dims The kernel dimensions (width and height).
+     * @param[in] conv_info   Contains stride information described in @ref PadStrideInfo.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;           /**< Source tensor */
+    ITensor       *_output;          /**< Destination tensor */
+    Size2D         _kernel_dims;     /**< Kernel dimensions */
+    PadStrideInfo  _conv_info;       /**< Stride information */
+    unsigned int   _convolved_width; /**< Width of the convolved output */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEBINARYIM2COLKERNEL_H__ */
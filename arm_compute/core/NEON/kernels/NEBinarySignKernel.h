@@ -35,8 +35,14 @@ class ITensor;
  *   Each value of the input tensor gets stored as a 0 bit in the destination tensor
  *   if it is 0.f or a negative value, it gets stored as a 1 bit otherwise.
  *   Every 8 input values will be stored in one single value of the output (8 bits per uint8_t value).
- *   Optionally, this kernel also calculates the alpha 1D tensor containing the mean over absolute values of each 3D input block.
+ *   With the NHWC data layout the values are packed along the channels, padded to whole 128-bit words for every spatial location.
+ *   The inputs and weights of a fully connected layer are packed the same way along their first dimension.
+ *   Optionally, this kernel also calculates the sums over absolute values of each row it binarizes, which @ref NEBinaryAlphaKernel
+ *   reduces into the alpha tensor.
  *   Optionally, this kernel also calculates the beta 2D tensor containing the normalized mean over absolute values over channels.
+ *
+ *   Every iteration of the window binarizes all the channels of a row (NCHW) or of a spatial location (NHWC), so that no output
+ *   is shared between threads and the results don't depend on how the window is split.
  */
 class NEBinarySignKernel : public INEKernel
 {
@@ -62,35 +68,59 @@ public:
      *
      * @param[in]  input  Source tensor. Data types supported: F32.
      * @param[out] output Destination tensor. Data types supported: U8.
-     * @param[out] alpha  (Optional) Alpha tensor. It contains the mean over absolute values of each 3D input block.
-     *                    Data types supported: F32.
+     * @param[out] partial_sums (Optional) Partial sums tensor. It contains the sum over absolute values of each binarized row,
+     *                          see @ref misc::shape_calculator::compute_binary_sign_partial_sums_shape. Data types supported: F32.
      * @param[out] beta  (Optional) Beta tensor. It contains the mean over absolute values over channels.
      *                    Data types supported: F32.
+     * @param[in]  is_fully_connected (Optional) True if @p input is the 1D/2D input or weights of a fully connected layer. Its values are then packed
+     *                    along the first dimension as with NHWC, and @p beta contains the mean over absolute values of each row.
      */
-    void configure(const ITensor *input, ITensor *output, ITensor *alpha = nullptr, ITensor *beta = nullptr);
+    void configure(const ITensor *input, ITensor *output, ITensor *partial_sums = nullptr, ITensor *beta = nullptr, bool is_fully_connected = false);
     
     /** Static function to check if given info will lead to a valid configuration of @ref NEBinarySignKernel
      *
      * @param[in] input  Source tensor. Data types supported: F32.
      * @param[in] output Destination tensor. Data types supported: U8.
-     * @param[in] alpha  (Optional) Alpha tensor. It contains the mean over absolute values of each 3D input block.
-     *                    Data types supported: F32.
+     * @param[in] partial_sums (Optional) Partial sums tensor. It contains the sum over absolute values of each binarized row.
+     *                         Data types supported: F32.
      * @param[in] beta  (Optional) Beta tensor. It contains the mean over absolute values over channels.
      *                    Data types supported: F32.
+     * @param[in] is_fully_connected (Optional) True if @p input is the 1D/2D input or weights of a fully connected layer. Its values are then packed
+     *                    along the first dimension as with NHWC, and @p beta contains the mean over absolute values of each row.
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *alpha = nullptr, const ITensorInfo *beta = nullptr);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *partial_sums = nullptr, const ITensorInfo *beta = nullptr,
+                           bool is_fully_connected = false);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    const ITensor *_input;  /**< Source tensor */
-    ITensor       *_output; /**< Destination tensor */
-    ITensor       *_alpha;  /**< Alpha tensor */
-    ITensor       *_beta;   /**< Beta tensor */
-    unsigned int   _num_elems_read_per_iteration;
+    /** Common signature for all the specialised binary sign functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using BinarySignFunction = void (NEBinarySignKernel::*)(const Window &window);
+
+    /** Function to binarize a tensor with the NCHW data layout, packing values along X
+     *
+     * Every iteration binarizes the same row of all the channels, accumulating their absolute values into the beta row.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void binary_sign_nchw(const Window &window);
+    /** Function to binarize a tensor with the NHWC data layout, packing values along the channels
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void binary_sign_nhwc(const Window &window);
+
+    BinarySignFunction _func;         /**< Binary sign function to use for the configured data layout */
+    const ITensor     *_input;        /**< Source tensor */
+    ITensor           *_output;       /**< Destination tensor */
+    ITensor           *_partial_sums; /**< Partial sums tensor */
+    ITensor           *_beta;         /**< Beta tensor */
 };
 } // namespace arm_compute
-#endif /* __ARM_COMPUTE_CLBINARYSIGNKERNEL_H__ */
+#endif /* __ARM_COMPUTE_NEBINARYSIGNKERNEL_H__ */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+#define __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to compute the element-wise part of an LSTM cell in a single pass
+ *
+ * The kernel takes the matrix products of the four gates, stacked along X in the order input, forget, cell, output
+ * (the input gate is omitted with CIFG), and computes for each unit:
+ *
+ * -# forget_gate = Logistic(forget + forget_gate_bias + cell_state_in * cell_to_forget_weights)
+ * -# input_gate  = Logistic(input + input_gate_bias + cell_state_in * cell_to_input_weights), or 1 - forget_gate with CIFG
+ * -# cell_state  = Clip(Activation(cell + cell_bias) * input_gate + cell_state_in * forget_gate, cell_threshold)
+ * -# output_gate = Logistic(output + output_gate_bias + cell_state * cell_to_output_weights)
+ * -# output_state = output_gate * Activation(cell_state)
+ *
+ * The peephole terms are only added if the corresponding weights are passed. The gates and the cell state are also
+ * written to the scratch buffer in the order input (without CIFG), cell state, forget, output.
+ */
+class NELSTMCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELSTMCellKernel";
+    }
+    /** Default constructor */
+    NELSTMCellKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel(const NELSTMCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel &operator=(const NELSTMCellKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel(NELSTMCellKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel &operator=(NELSTMCellKernel &&) = default;
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * @param[in]  gates                  2D tensor with dimensions [num_units * 4, batch_size] without CIFG or [num_units * 3, batch_size] with CIFG,
+     *                                    holding the matrix products of the gates without their biases. Data types supported: F16/F32.
+     * @param[in]  input_gate_bias        1D tensor with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p gates.
+     * @param[in]  forget_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in]  cell_bias              1D tensor with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in]  output_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in]  cell_to_input_weights  1D tensor with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in]  cell_to_forget_weights 1D tensor with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in]  cell_to_output_weights 1D tensor with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in]  cell_state_in          2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[out] cell_state_out         2D tensor with dimensions [num_units, batch_size]. Can be @p cell_state_in. Data type supported: Same as @p gates.
+     * @param[out] output_state           2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[out] scratch_buffer         2D tensor with the same dimensions as @p gates. Data type supported: Same as @p gates.
+     * @param[in]  activation_info        Activation of the cell input and of the cell state.
+     * @param[in]  cell_threshold         The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
+     */
+    void configure(const ITensor *gates,
+                   const ITensor *input_gate_bias, const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                   const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights, const ITensor *cell_to_output_weights,
+                   const ITensor *cell_state_in, ITensor *cell_state_out, ITensor *output_state, ITensor *scratch_buffer,
+                   const ActivationLayerInfo &activation_info, float cell_threshold);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMCellKernel
+     *
+     * @param[in] gates                  2D tensor info with dimensions [num_units * 4, batch_size] without CIFG or [num_units * 3, batch_size] with CIFG. Data types supported: F16/F32.
+     * @param[in] input_gate_bias        1D tensor info with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p gates.
+     * @param[in] forget_gate_bias       1D tensor info with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in] cell_bias              1D tensor info with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in] output_gate_bias       1D tensor info with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in] cell_to_input_weights  1D tensor info with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in] cell_to_forget_weights 1D tensor info with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in] cell_to_output_weights 1D tensor info with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in] cell_state_in          2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in] cell_state_out         2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in] output_state           2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in] scratch_buffer         2D tensor info with the same dimensions as @p gates. Data type supported: Same as @p gates.
+     * @param[in] activation_info        Activation of the cell input and of the cell state.
+     * @param[in] cell_threshold         The clipping threshold for the cell state. If set to 0.0 then clipping is disabled.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *gates,
+                           const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                           const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                           const ITensorInfo *cell_state_in, const ITensorInfo *cell_state_out, const ITensorInfo *output_state, const ITensorInfo *scratch_buffer,
+                           const ActivationLayerInfo &activation_info, float cell_threshold);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Computes the cells of the rows covered by a window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void run_cell(const Window &window);
+
+    /** Common signature for all the specialised cell functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using CellFunctionPtr = void (NELSTMCellKernel::*)(const Window &window);
+
+    CellFunctionPtr     _func;
+    const ITensor      *_gates;
+    const ITensor      *_input_gate_bias;
+    const ITensor      *_forget_gate_bias;
+    const ITensor      *_cell_bias;
+    const ITensor      *_output_gate_bias;
+    const ITensor      *_cell_to_input_weights;
+    const ITensor      *_cell_to_forget_weights;
+    const ITensor      *_cell_to_output_weights;
+    const ITensor      *_cell_state_in;
+    ITensor            *_cell_state_out;
+    ITensor            *_output_state;
+    ITensor            *_scratch_buffer;
+    ActivationLayerInfo _activation_info;
+    float               _cell_threshold;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NELSTMCELLKERNEL_H__ */
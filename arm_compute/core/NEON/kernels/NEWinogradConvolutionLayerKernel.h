@@ -35,7 +35,6 @@ namespace arm_compute
 class ITensor;
 
 /** Interface for the NEON kernel to perform Winograd input transform. */
-template <typename T>
 class INEWinogradLayerTransformInputKernel : public INEKernel
 {
 public:
@@ -84,7 +83,7 @@ public:
 
 /** NEON kernel to perform Winograd input transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformInputKernel : public INEWinogradLayerTransformInputKernel<T>
+class NEWinogradLayerTransformInputKernel : public INEWinogradLayerTransformInputKernel
 {
 public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -136,7 +135,7 @@ public:
 
     /** Configure the output transform kernel.
      *
-     * @param[in]  input_nhwc    Input tensor.  Data types supported: F32. Layout supported NHWC.
+     * @param[in]  input_nhwc    Input tensor.  Data types supported: S16/F16/F32. Layout supported NHWC.
      * @param[in]  num_batches   Number of batches in input tensor.
      * @param[in]  num_rows      Number of rows in input tensor.
      * @param[in]  num_cols      Number of columns in input tensor.
@@ -165,7 +164,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformInputKernel
      *
-     * @param[in] input         First tensor input info. Data types supported: F32.
+     * @param[in] input         First tensor input info. Data types supported: S16/F16/F32.
      * @param[in] output        Output tensor info. Data types supported: same as @p input.
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
      *
@@ -186,7 +185,6 @@ private:
 };
 
 /** Interface for the NEON kernel to perform Winograd output transform. */
-template <typename T>
 class INEWinogradLayerTransformOutputKernel : public INEKernel
 {
 public:
@@ -251,7 +249,7 @@ public:
 
 /** NEON kernel to perform Winograd output transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformOutputKernel : public INEWinogradLayerTransformOutputKernel<T>
+class NEWinogradLayerTransformOutputKernel : public INEWinogradLayerTransformOutputKernel
 {
 public:
     const char *name() const override
@@ -330,7 +328,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformOutputKernel
      *
-     * @param[in]  input         Source tensor with shape [C, N, 16, batches] or [C, N, 36, batches]. Data types supported: F32.
+     * @param[in]  input         Source tensor with shape [C, N, 16, batches] or [C, N, 36, batches]. Data types supported: S32/F16/F32.
      * @param[in]  bias          Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. It can be a nullptr. Data type supported: as @p input
      * @param[out] output        Destination tensor with shape [output_convolved_dims.width, output_convolved_dims.height, C, batches]. Data type supported: same as @p input
      * @param[in]  winograd_info Contains Winograd's information described in @ref WinogradInfo
@@ -356,7 +354,6 @@ private:
 };
 
 /** Interface for the NEON kernel to perform Winograd weights transform. */
-template <typename T>
 class INEWinogradLayerTransformWeightsKernel : public INEKernel
 {
 public:
@@ -405,7 +402,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsKernel
      *
-     * @param[in] input   First tensor input info. Data types supported: F32.
+     * @param[in] input   First tensor input info. Data types supported: S16/F16/F32.
      * @param[in] weights Weights tensor info. Data types supported: same as @p input.
      *
      * @return a status
@@ -415,7 +412,7 @@ public:
 
 /** NEON kernel to perform Winograd weights transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformWeightsKernel final : public INEWinogradLayerTransformWeightsKernel<T>
+class NEWinogradLayerTransformWeightsKernel final : public INEWinogradLayerTransformWeightsKernel
 {
 public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -439,7 +436,7 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsKernel
      *
      * @param[in] input         Source tensor info. The input is a 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM] (NCHW data layout).
-     *                          kernel_x must be 3 and equal to kernel_y. Data types supported: F32.
+     *                          kernel_x must be 3 and equal to kernel_y. Data types supported: S16/F16/F32.
      * @param[in] output        Destination tensor info. The output is a 3D tensor with dimensions [OFM, IFM, 16] or [OFM, IFM, 36]. Data type supported: same as @p input
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
      *
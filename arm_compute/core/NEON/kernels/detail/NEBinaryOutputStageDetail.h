@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_DETAIL_NEBINARYOUTPUTSTAGEDETAIL_H__
+#define __ARM_COMPUTE_DETAIL_NEBINARYOUTPUTSTAGEDETAIL_H__
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace arm_compute
+{
+namespace detail
+{
+/** Check if an activation function can be fused in the output stage of the binary convolution kernels
+ *
+ * Only the activation functions which clamp their input are supported, so that they can be applied with a min/max.
+ *
+ * @param[in] act_info Activation layer information.
+ *
+ * @return a status
+ */
+inline Status validate_binary_output_stage_activation(const ActivationLayerInfo &act_info)
+{
+    if(act_info.enabled())
+    {
+        const ActivationLayerInfo::ActivationFunction act = act_info.activation();
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act != ActivationLayerInfo::ActivationFunction::RELU
+                                        && act != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+                                        && act != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
+                                        "Activation function not supported");
+        ARM_COMPUTE_RETURN_ERROR_ON(act_info.b() > act_info.a());
+    }
+    return Status{};
+}
+
+/** Compute the bounds an activation function clamps its input to
+ *
+ * @param[in] act_info Activation layer information. Must be disabled or pass @ref validate_binary_output_stage_activation.
+ *
+ * @return The lower and upper bounds, which are the lowest and highest floats if @p act_info is disabled
+ */
+inline std::pair<float, float> compute_activation_bounds(const ActivationLayerInfo &act_info)
+{
+    float min_val = std::numeric_limits<float>::lowest();
+    float max_val = std::numeric_limits<float>::max();
+
+    if(act_info.enabled())
+    {
+        switch(act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                min_val = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                min_val = 0.f;
+                max_val = act_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                min_val = act_info.b();
+                max_val = act_info.a();
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Activation function not supported");
+                break;
+        }
+    }
+
+    return std::make_pair(min_val, max_val);
+}
+
+/** Store the sign of a value in a row of packed signs, the first value being stored in the most significant bit of the first byte
+ *
+ * @note The bit is OR-ed with the current contents of the row, which must have been cleared.
+ *
+ * @param[in, out] row Pointer to the first byte of the row.
+ * @param[in]      idx Index of the value in the row.
+ * @param[in]      val Value to binarize: a 1 bit is stored if it is strictly positive.
+ */
+inline void store_sign(uint8_t *row, unsigned int idx, float val)
+{
+    row[idx >> 3] |= static_cast<uint8_t>(val > 0.f) << (7 - (idx & 7));
+}
+} // namespace detail
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_DETAIL_NEBINARYOUTPUTSTAGEDETAIL_H__ */
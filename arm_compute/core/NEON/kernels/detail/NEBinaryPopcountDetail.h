@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_DETAIL_NEBINARYPOPCOUNTDETAIL_H__
+#define __ARM_COMPUTE_DETAIL_NEBINARYPOPCOUNTDETAIL_H__
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace detail
+{
+/** Maximum number of 16-byte vectors whose bit counts can be accumulated pairwise in 16-bit lanes without overflowing */
+constexpr size_t popcount_max_u16_vectors = 4095;
+
+/** Sum all the lanes of a vector
+ *
+ * @param[in] vec Input vector.
+ *
+ * @return The sum of the four lanes of @p vec
+ */
+inline uint32_t reduce_add(uint32x4_t vec)
+{
+#ifdef __aarch64__
+    return vaddvq_u32(vec);
+#else  // __aarch64__
+    const uint64x2_t tmp = vpaddlq_u32(vec);
+    return static_cast<uint32_t>(vgetq_lane_u64(tmp, 0) + vgetq_lane_u64(tmp, 1));
+#endif // __aarch64__
+}
+
+/** Count the number of bits which differ between two packed bit strings (popcount of their XOR)
+ *
+ * The number of matching bits (XNOR popcount) is then equal to the number of valid bits minus the returned value.
+ *
+ * @param[in] a         Pointer to the first bit string.
+ * @param[in] b         Pointer to the second bit string.
+ * @param[in] num_bytes Length of the bit strings in bytes.
+ *
+ * @return The number of differing bits
+ */
+inline uint32_t popcount_xor(const uint8_t *a, const uint8_t *b, size_t num_bytes)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+    size_t     x   = 0;
+
+    while(x + 16 <= num_bytes)
+    {
+        // Accumulate in 16-bit lanes for as long as they cannot overflow, then widen to 32-bit
+        const size_t num_vectors = std::min((num_bytes - x) / 16, popcount_max_u16_vectors);
+        uint16x8_t   acc_u16     = vdupq_n_u16(0);
+        for(size_t v = 0; v < num_vectors; ++v, x += 16)
+        {
+            acc_u16 = vpadalq_u8(acc_u16, vcntq_u8(veorq_u8(vld1q_u8(a + x), vld1q_u8(b + x))));
+        }
+        acc = vpadalq_u16(acc, acc_u16);
+    }
+
+    uint32_t count = reduce_add(acc);
+
+    // Left-over bytes
+    for(; x < num_bytes; ++x)
+    {
+        count += std::bitset<8>(a[x] ^ b[x]).count();
+    }
+
+    return count;
+}
+
+/** Count the number of bits which differ between one packed bit string and four others
+ *
+ * Each vector of @p a is loaded once and compared against the four bit strings pointed by @p b.
+ *
+ * @param[in]  a         Pointer to the bit string to compare against all the others.
+ * @param[in]  b         Pointers to the four bit strings to compare against @p a.
+ * @param[in]  num_bytes Length of the bit strings in bytes.
+ * @param[out] counts    The number of bits which differ between @p a and each bit string in @p b.
+ */
+inline void popcount_xor_x4(const uint8_t *a, const uint8_t *const *b, size_t num_bytes, uint32_t *counts)
+{
+    uint32x4_t acc0 = vdupq_n_u32(0);
+    uint32x4_t acc1 = vdupq_n_u32(0);
+    uint32x4_t acc2 = vdupq_n_u32(0);
+    uint32x4_t acc3 = vdupq_n_u32(0);
+    size_t     x    = 0;
+
+    while(x + 16 <= num_bytes)
+    {
+        const size_t num_vectors = std::min((num_bytes - x) / 16, popcount_max_u16_vectors);
+        uint16x8_t   acc0_u16    = vdupq_n_u16(0);
+        uint16x8_t   acc1_u16    = vdupq_n_u16(0);
+        uint16x8_t   acc2_u16    = vdupq_n_u16(0);
+        uint16x8_t   acc3_u16    = vdupq_n_u16(0);
+        for(size_t v = 0; v < num_vectors; ++v, x += 16)
+        {
+            const uint8x16_t a_vec = vld1q_u8(a + x);
+
+            acc0_u16 = vpadalq_u8(acc0_u16, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b[0] + x))));
+            acc1_u16 = vpadalq_u8(acc1_u16, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b[1] + x))));
+            acc2_u16 = vpadalq_u8(acc2_u16, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b[2] + x))));
+            acc3_u16 = vpadalq_u8(acc3_u16, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b[3] + x))));
+        }
+        acc0 = vpadalq_u16(acc0, acc0_u16);
+        acc1 = vpadalq_u16(acc1, acc1_u16);
+        acc2 = vpadalq_u16(acc2, acc2_u16);
+        acc3 = vpadalq_u16(acc3, acc3_u16);
+    }
+
+    counts[0] = reduce_add(acc0);
+    counts[1] = reduce_add(acc1);
+    counts[2] = reduce_add(acc2);
+    counts[3] = reduce_add(acc3);
+
+    // Left-over bytes
+    for(; x < num_bytes; ++x)
+    {
+        counts[0] += std::bitset<8>(a[x] ^ b[0][x]).count();
+        counts[1] += std::bitset<8>(a[x] ^ b[1][x]).count();
+        counts[2] += std::bitset<8>(a[x] ^ b[2][x]).count();
+        counts[3] += std::bitset<8>(a[x] ^ b[3][x]).count();
+    }
+}
+/** Count the number of bits which differ between each of four packed bit strings and each of four others
+ *
+ * This is the register-blocked micro-kernel of the binary GEMM: every vector of @p a and @p b is loaded once
+ * and used four times, and the 16 partial counts are kept in registers for the whole length of the bit strings.
+ *
+ * @param[in]  a         Pointers to the four bit strings of the first block (rows of the LHS matrix).
+ * @param[in]  b         Pointers to the four bit strings of the second block (rows of the transposed RHS matrix).
+ * @param[in]  num_bytes Length of the bit strings in bytes.
+ * @param[out] counts    The number of bits which differ between @p a[i] and @p b[j], stored in counts[i * 4 + j].
+ */
+inline void popcount_xor_4x4(const uint8_t *const *a, const uint8_t *const *b, size_t num_bytes, uint32_t *counts)
+{
+    uint32x4_t acc[4][4];
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        for(unsigned int j = 0; j < 4; ++j)
+        {
+            acc[i][j] = vdupq_n_u32(0);
+        }
+    }
+
+    size_t x = 0;
+    while(x + 16 <= num_bytes)
+    {
+        const size_t num_vectors = std::min((num_bytes - x) / 16, popcount_max_u16_vectors);
+
+        uint16x8_t acc_u16[4][4];
+        for(unsigned int i = 0; i < 4; ++i)
+        {
+            for(unsigned int j = 0; j < 4; ++j)
+            {
+                acc_u16[i][j] = vdupq_n_u16(0);
+            }
+        }
+
+        for(size_t v = 0; v < num_vectors; ++v, x += 16)
+        {
+            const uint8x16_t b_vec[4] = { vld1q_u8(b[0] + x), vld1q_u8(b[1] + x), vld1q_u8(b[2] + x), vld1q_u8(b[3] + x) };
+
+            for(unsigned int i = 0; i < 4; ++i)
+            {
+                const uint8x16_t a_vec = vld1q_u8(a[i] + x);
+
+                acc_u16[i][0] = vpadalq_u8(acc_u16[i][0], vcntq_u8(veorq_u8(a_vec, b_vec[0])));
+                acc_u16[i][1] = vpadalq_u8(acc_u16[i][1], vcntq_u8(veorq_u8(a_vec, b_vec[1])));
+                acc_u16[i][2] = vpadalq_u8(acc_u16[i][2], vcntq_u8(veorq_u8(a_vec, b_vec[2])));
+                acc_u16[i][3] = vpadalq_u8(acc_u16[i][3], vcntq_u8(veorq_u8(a_vec, b_vec[3])));
+            }
+        }
+
+        for(unsigned int i = 0; i < 4; ++i)
+        {
+            for(unsigned int j = 0; j < 4; ++j)
+            {
+                acc[i][j] = vpadalq_u16(acc[i][j], acc_u16[i][j]);
+            }
+        }
+    }
+
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        for(unsigned int j = 0; j < 4; ++j)
+        {
+            uint32_t count = reduce_add(acc[i][j]);
+
+            // Left-over bytes
+            for(size_t k = x; k < num_bytes; ++k)
+            {
+                count += std::bitset<8>(a[i][k] ^ b[j][k]).count();
+            }
+
+            counts[i * 4 + j] = count;
+        }
+    }
+}
+} // namespace detail
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_DETAIL_NEBINARYPOPCOUNTDETAIL_H__ */
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_DETAIL_NEBINARYSIGNDETAIL_H__
+#define __ARM_COMPUTE_DETAIL_NEBINARYSIGNDETAIL_H__
+
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace detail
+{
+/** Pack the signs of 8 values in one byte, the first value being stored in the most significant bit
+ *
+ * @param[in] vals0 First 4 values.
+ * @param[in] vals1 Last 4 values.
+ *
+ * @return The packed signs, with a 1 bit for every strictly positive value
+ */
+inline uint8_t pack_signs(const float32x4_t &vals0, const float32x4_t &vals1)
+{
+    static const uint8_t bit_weights[8] = { 128, 64, 32, 16, 8, 4, 2, 1 };
+
+    const float32x4_t zero  = vdupq_n_f32(0.f);
+    const uint16x8_t  signs = vcombine_u16(vmovn_u32(vcgtq_f32(vals0, zero)), vmovn_u32(vcgtq_f32(vals1, zero)));
+    const uint8x8_t   bits  = vand_u8(vmovn_u16(signs), vld1_u8(bit_weights));
+
+    // The bits don't overlap, so adding them is equivalent to OR-ing them
+#ifdef __aarch64__
+    return vaddv_u8(bits);
+#else  // __aarch64__
+    return static_cast<uint8_t>(vget_lane_u64(vpaddl_u32(vpaddl_u16(vpaddl_u8(bits))), 0));
+#endif // __aarch64__
+}
+
+/** Sum all the lanes of a vector
+ *
+ * @param[in] vals Input vector.
+ *
+ * @return The sum of the four lanes of @p vals
+ */
+inline float reduce_add(const float32x4_t &vals)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(vals);
+#else  // __aarch64__
+    const float32x2_t tmp = vpadd_f32(vget_low_f32(vals), vget_high_f32(vals));
+    return vget_lane_f32(vpadd_f32(tmp, tmp), 0);
+#endif // __aarch64__
+}
+
+/** Pack the signs of a contiguous run of values (e.g. the channels of an NHWC location) into bytes
+ *
+ * The bytes after the last value, up to @p num_bytes, are set to 0.
+ *
+ * @param[in]  in        Pointer to the values to binarize.
+ * @param[out] out       Pointer to the destination bytes.
+ * @param[in]  num_vals  Number of values to binarize.
+ * @param[in]  num_bytes Number of bytes to write. Must be at least ceil(@p num_vals / 8).
+ *
+ * @return The sum of the absolute values
+ */
+inline float pack_signs_row(const float *in, uint8_t *out, unsigned int num_vals, unsigned int num_bytes)
+{
+    float32x4_t  abs_sum = vdupq_n_f32(0.f);
+    unsigned int i       = 0;
+    unsigned int b       = 0;
+
+    for(; i + 8 <= num_vals; i += 8, ++b)
+    {
+        const float32x4_t vals0 = vld1q_f32(in + i);
+        const float32x4_t vals1 = vld1q_f32(in + i + 4);
+
+        out[b]  = pack_signs(vals0, vals1);
+        abs_sum = vaddq_f32(abs_sum, vaddq_f32(vabsq_f32(vals0), vabsq_f32(vals1)));
+    }
+
+    float sum = reduce_add(abs_sum);
+
+    // Left-over values
+    if(i < num_vals)
+    {
+        uint8_t dst_val = 0;
+        for(unsigned int j = 0; i < num_vals; ++i, ++j)
+        {
+            dst_val |= static_cast<uint8_t>(in[i] > 0.f) << (7 - j);
+            sum += std::abs(in[i]);
+        }
+        out[b++] = dst_val;
+    }
+
+    // Padding bytes
+    for(; b < num_bytes; ++b)
+    {
+        out[b] = 0;
+    }
+
+    return sum;
+}
+} // namespace detail
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_DETAIL_NEBINARYSIGNDETAIL_H__ */
@@ -498,6 +498,14 @@ using PaddingInfo = std::pair<uint32_t, uint32_t>;
 /** List of padding information */
 using PaddingList = std::vector<PaddingInfo>;
 
+/** Padding mode to use for PadLayer */
+enum class PaddingMode
+{
+    CONSTANT,  /**< Pad with a constant value */
+    REFLECT,   /**< Mirror the tensor at its borders without repeating the border elements, e.g. [1 2 3] padded by 2 is [3 2 1 2 3 2 1] */
+    SYMMETRIC, /**< Mirror the tensor at its borders repeating the border elements, e.g. [1 2 3] padded by 2 is [2 1 1 2 3 3 2] */
+};
+
 /** Information to produce a tiled version of a Tensor */
 using Multiples = std::vector<uint32_t>;
 
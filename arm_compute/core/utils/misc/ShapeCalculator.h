@@ -402,10 +402,12 @@ inline TensorShape compute_transposed_shape(const ITensorInfo &input)
  * @param[in] weights          Weights tensor info
  * @param[in] conv_info        Padding and stride information to use for the convolution.
  * @param[in] depth_multiplier Multiplier to apply to the input's depth in order to retrieve the output's depth.
+ * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
  *
  * @return the calculated shape
  */
-inline TensorShape compute_depthwise_convolution_shape(const ITensorInfo &input, const ITensorInfo &weights, PadStrideInfo conv_info, unsigned int depth_multiplier)
+inline TensorShape compute_depthwise_convolution_shape(const ITensorInfo &input, const ITensorInfo &weights, PadStrideInfo conv_info, unsigned int depth_multiplier,
+                                                       const Size2D &dilation = Size2D(1U, 1U))
 {
     const TensorShape input_shape{ input.tensor_shape() };
     const TensorShape weights_shape{ weights.tensor_shape() };
@@ -419,7 +421,7 @@ inline TensorShape compute_depthwise_convolution_shape(const ITensorInfo &input,
     unsigned int output_height = 0;
     std::tie(output_width, output_height) = scaled_dimensions(input_shape[width_idx], input_shape[height_idx],
                                                               weights_shape[width_idx], weights_shape[height_idx],
-                                                              conv_info);
+                                                              conv_info, dilation);
 
     TensorShape output_shape{ input_shape };
     output_shape.set(width_idx, output_width);
@@ -1283,13 +1285,85 @@ inline TensorShape compute_gather_shape(const TensorShape &input_shape, const Te
     return output_shape;
 }
 
-inline TensorShape compute_binary_sign_shape(const TensorShape &src_shape)
+/** Calculate the binarized shape of a tensor
+ *
+ * 8 values are packed along the first dimension in every byte. With the NHWC data layout the first dimension is the channel one,
+ * and the packed channels of every spatial location are padded to a whole number of 128-bit words.
+ *
+ * @param[in] src_shape   Input tensor shape
+ * @param[in] data_layout (Optional) Data layout of the input tensor. Defaults to NCHW
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_binary_sign_shape(const TensorShape &src_shape, DataLayout data_layout = DataLayout::NCHW)
 {
     TensorShape dst_shape = src_shape;
     dst_shape[0] = static_cast<size_t>(ceil(dst_shape[0] / 8.f));
 
+    if(data_layout == DataLayout::NHWC)
+    {
+        dst_shape[0] = ceil_to_multiple(dst_shape[0], 16);
+    }
+
     return dst_shape;
 }
+
+/** Calculate the shape of the weights of a binary convolution layer before they are binarized
+ *
+ * @param[in] weights_info Contains the kernel size and the number of kernels.
+ * @param[in] num_channels Number of input feature maps.
+ * @param[in] data_layout  Data layout of the weights.
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_binary_weights_shape(const WeightsInfo &weights_info, unsigned int num_channels, DataLayout data_layout)
+{
+    const unsigned int kernel_width  = weights_info.kernel_size().first;
+    const unsigned int kernel_height = weights_info.kernel_size().second;
+
+    if(data_layout == DataLayout::NHWC)
+    {
+        return TensorShape(num_channels, kernel_width, kernel_height, weights_info.num_kernels());
+    }
+
+    return TensorShape(kernel_width, kernel_height, num_channels, weights_info.num_kernels());
+}
+
+/** Calculate the shape of the partial sums of absolute values computed while binarizing a tensor
+ *
+ * There is one partial sum for every row binarized by @ref NEBinarySignKernel: every spatial location with the NHWC data layout,
+ * and every row of all the channels with the NCHW one.
+ *
+ * @param[in] src_shape   Input tensor shape
+ * @param[in] data_layout (Optional) Data layout of the input tensor. Defaults to NCHW
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_binary_sign_partial_sums_shape(const TensorShape &src_shape, DataLayout data_layout = DataLayout::NCHW)
+{
+    TensorShape partial_sums_shape = src_shape;
+    partial_sums_shape.set(0, 1);
+    partial_sums_shape.set(get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL), 1);
+
+    return partial_sums_shape;
+}
+
+/** Calculate the im2col output shape of a binarized NHWC tensor
+ *
+ * Every row of the output contains the packed channels of a whole kernel window, in the same order as the binarized weights.
+ *
+ * @param[in] input       Binarized input tensor info. Data layout supported: NHWC
+ * @param[in] kernel_dims The kernel dimensions (width and height).
+ * @param[in] conv_info   Contains stride information. Padding must be applied before binarization.
+ *
+ * @return the calculated shape [kernel_width * kernel_height * packed channels, output width * output height, batches]
+ */
+inline TensorShape compute_binary_im2col_shape(const ITensorInfo &input, const Size2D &kernel_dims, const PadStrideInfo &conv_info)
+{
+    const auto out_dims = scaled_dimensions(input.dimension(1), input.dimension(2), kernel_dims.width, kernel_dims.height, conv_info);
+
+    return TensorShape(input.dimension(0) * kernel_dims.area(), out_dims.first * out_dims.second, input.tensor_shape().total_size_upper(3));
+}
 } // namespace shape_calculator
 } // namespace misc
 } // namespace arm_compute
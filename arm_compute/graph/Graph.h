@@ -208,8 +208,6 @@ public:
      * @return The actual tensor object
      */
     Tensor *tensor(TensorID id);
-
-private:
     /** Creates a tensor object
      *
      * @param[in] desc Tensor descriptor
@@ -97,6 +97,27 @@ public:
     static NodeID add_batch_normalization_node(Graph &g, NodeParams params, NodeIdxPair input, float epsilon,
                                                ITensorAccessorUPtr mean_accessor = nullptr, ITensorAccessorUPtr var_accessor = nullptr,
                                                ITensorAccessorUPtr beta_accessor = nullptr, ITensorAccessorUPtr gamma_accessor = nullptr);
+    /** Adds a binary convolution layer node to the graph
+     *
+     * @param[in] g                     Graph to add the node to
+     * @param[in] params                Common node parameters
+     * @param[in] input                 Input to the binary convolution layer node as a NodeID-Index pair
+     * @param[in] kernel_spatial_extend Spatial extend of convolution kernels
+     * @param[in] depth                 Number of convolution kernels
+     * @param[in] conv_info             Convolution layer information
+     * @param[in] weights_accessor      (Optional) Accessor of the weights node data
+     * @param[in] bias_accessor         (Optional) Accessor of the bias node data
+     * @param[in] scale_accessor        (Optional) Accessor of the per-channel scale applied to the results
+     * @param[in] shift_accessor        (Optional) Accessor of the per-channel shift added to the results after the scale
+     * @param[in] fused_act             (Optional) Activation fused to the results. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
+    static NodeID add_binary_convolution_node(Graph &g, NodeParams params, NodeIdxPair input,
+                                              Size2D kernel_spatial_extend, unsigned int depth, PadStrideInfo conv_info,
+                                              ITensorAccessorUPtr weights_accessor = nullptr, ITensorAccessorUPtr bias_accessor = nullptr,
+                                              ITensorAccessorUPtr scale_accessor = nullptr, ITensorAccessorUPtr shift_accessor = nullptr,
+                                              ActivationLayerInfo fused_act = ActivationLayerInfo());
     /** Adds a bounding box transform layer node to the graph
      *
      * @param[in] g      Graph to add the node to
@@ -26,6 +26,7 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include "arm_compute/runtime/HostMemoryTracker.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 
 #include <map>
@@ -45,6 +46,28 @@ struct MemoryManagerContext
     IAllocator                                  *allocator   = { nullptr };             /**< Backend allocator to use */
 };
 
+/** Memory held by the pools of a memory manager */
+struct MemoryPoolsUsage
+{
+    size_t pool_size{ 0 }; /**< Size in bytes of each pool, i.e. the peak memory of the objects using a pool */
+    size_t num_pools{ 0 }; /**< Number of pools */
+};
+
+/** Memory held by the graphs finalized with a context
+ *
+ * @note The categories, nodes and host amounts only account for host memory, the pools for the memory of all the targets.
+ */
+struct GraphMemoryUsage
+{
+    MemoryUsage                        const_tensors{};    /**< Constant tensors */
+    MemoryUsage                        tensors{};          /**< Tensors which aren't handled by the transition memory manager */
+    MemoryUsage                        function_buffers{}; /**< Buffers the functions allocate for their whole life */
+    std::map<NodeID, MemoryUsage>      nodes{};            /**< Buffers allocated for the function of each node */
+    std::map<Target, MemoryPoolsUsage> transition_pools{}; /**< Pools of the cross-function memory managers, which hold the tensors passed between functions */
+    std::map<Target, MemoryPoolsUsage> function_pools{};   /**< Pools of the intra-function memory managers, which hold the functions' temporary buffers */
+    MemoryUsage                        host{};             /**< All the host memory allocated while finalizing the graphs */
+};
+
 /** Graph context **/
 class GraphContext final
 {
@@ -92,12 +115,35 @@ public:
      * @return Memory manager contexts
      */
     std::map<Target, MemoryManagerContext> &memory_managers();
-    /** Finalizes memory managers in graph context */
-    void finalize();
+    /** Finalizes memory managers in graph context
+     *
+     * @param[in] num_pools (Optional) Number of memory pools to create for each memory manager, i.e. number of functions which can run at the same time.
+     */
+    void finalize(size_t num_pools = 1);
+    /** Returns the tracker accounting for all the host memory allocated while finalizing the graphs
+     *
+     * @return The context's memory tracker
+     */
+    std::shared_ptr<HostMemoryTracker> memory_tracker();
+    /** Returns the tracker accounting for a category of host memory
+     *
+     * @param[in] category Category of memory
+     * @param[in] nid      (Optional) Node the memory is allocated for, only used by @ref MemoryCategory::FunctionBuffers
+     *
+     * @return The memory tracker of the category, or of the node for function buffers
+     */
+    std::shared_ptr<HostMemoryTracker> memory_tracker(MemoryCategory category, NodeID nid = EmptyNodeID);
+    /** Reports the memory held by the graphs finalized with this context
+     *
+     * @return Memory usage per category, node and memory pool
+     */
+    GraphMemoryUsage memory_usage() const;
 
 private:
     GraphConfig _config;                                     /**< Graph configuration */
     std::map<Target, MemoryManagerContext> _memory_managers; /**< Memory managers for each target */
+    std::shared_ptr<HostMemoryTracker>     _memory_tracker;  /**< Tracker of all the host memory allocated for the graphs */
+    std::map<std::pair<MemoryCategory, NodeID>, std::shared_ptr<HostMemoryTracker>> _memory_trackers; /**< Trackers of each category and node */
 };
 } // namespace graph
 } // namespace arm_compute
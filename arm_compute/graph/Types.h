@@ -28,10 +28,14 @@
 #include "arm_compute/core/Types.h"
 
 #include <limits>
+#include <memory>
 #include <string>
 
 namespace arm_compute
 {
+// Forward declarations
+class WeightsCache;
+
 namespace graph
 {
 using arm_compute::Status;
@@ -72,14 +76,25 @@ constexpr EdgeID EmptyEdgeID = std::numeric_limits<EdgeID>::max();
 // Forward declarations
 class TensorDescriptor;
 
+/** Supported graph execution strategies */
+enum class ExecutionStrategy
+{
+    Sequential, /**< Run the nodes one after the other in topological order */
+    Dataflow,   /**< Run the nodes as soon as their inputs are ready, independent nodes run concurrently on separate threads (NEON only) */
+    Pipelined,  /**< Split the nodes in stages running concurrently on successive inputs, each on its own threads (NEON only) */
+};
+
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool        use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
-    bool        use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool        use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    int         num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    bool                          use_function_memory_manager{ true };                 /**< Use a memory manager to manage per-funcion auxilary memory */
+    bool                          use_transition_memory_manager{ true };               /**< Use a memory manager to manager transition buffer memory */
+    bool                          use_tuner{ false };                                  /**< Use a tuner in tunable backends */
+    int                           num_threads{ -1 };                                   /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    std::string                   tuner_file{ "acl_tuner.csv" };                       /**< File to load/store tuning values from */
+    ExecutionStrategy             execution_strategy{ ExecutionStrategy::Sequential }; /**< Strategy used to run the nodes of the graph */
+    unsigned int                  pipeline_stages{ 2 };                                /**< Maximum number of compute stages of a pipelined execution */
+    std::shared_ptr<WeightsCache> weights_cache{ nullptr };                            /**< Cache sharing the weights with the other graphs built from the same model, if any */
 };
 
 /**< Device target types */
@@ -128,6 +143,7 @@ enum class NodeType
 {
     ActivationLayer,
     BatchNormalizationLayer,
+    BinaryConvolutionLayer,
     BoundingBoxTransformLayer,
     ChannelShuffleLayer,
     ConcatenateLayer,
@@ -169,6 +185,14 @@ enum class MemoryManagerAffinity
     Offset  /**< Affinity at offset level */
 };
 
+/** Categories of host memory held by a graph */
+enum class MemoryCategory
+{
+    ConstTensors,   /**< Constant tensors, e.g. weights */
+    Tensors,        /**< Tensors which aren't handled by the transition memory manager, e.g. inputs and outputs */
+    FunctionBuffers /**< Buffers the functions allocate for their whole life, e.g. reshaped weights */
+};
+
 /** NodeID-index struct
  *
  * Used to describe connections
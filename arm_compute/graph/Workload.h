@@ -44,6 +44,12 @@ class Graph;
 
 struct ExecutionTask;
 
+namespace detail
+{
+class DataflowExecutor;
+class PipelineExecutor;
+} // namespace detail
+
 void execute_task(ExecutionTask &task);
 
 /** Task executor */
@@ -97,11 +103,13 @@ struct ExecutionTask
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};          /**< Input handles */
-    std::vector<Tensor *>      outputs = {};          /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
-    Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
-    GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::vector<Tensor *>                     inputs   = {};          /**< Input handles */
+    std::vector<Tensor *>                     outputs  = {};          /**< Output handles */
+    std::vector<ExecutionTask>                tasks    = {};          /**< Execution workload */
+    Graph                                    *graph    = { nullptr }; /**< Graph bound to the workload */
+    GraphContext                             *ctx      = { nullptr }; /**< Graph execution context */
+    std::shared_ptr<detail::DataflowExecutor> executor = { nullptr }; /**< Executor running independent tasks concurrently (Optional) */
+    std::shared_ptr<detail::PipelineExecutor> pipeline = { nullptr }; /**< Executor streaming inputs through stages of tasks (Optional) */
 };
 } // namespace graph
 } // namespace arm_compute
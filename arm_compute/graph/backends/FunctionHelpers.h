@@ -163,6 +163,50 @@ std::unique_ptr<IFunction> create_batch_normalization_layer(BatchNormalizationLa
     return std::move(func);
 }
 
+/** Create a backend binary convolution layer function
+ *
+ * @tparam BinaryConvolutionLayerFunction Backend binary convolution function
+ * @tparam TargetInfo                     Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend binary convolution layer function
+ */
+template <typename BinaryConvolutionLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_binary_convolution_layer(BinaryConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 5 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo conv_info = node.convolution_info();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+
+    std::tie(func, std::ignore) = create_named_memory_managed_function<BinaryConvolutionLayerFunction>(
+                                      std::string(), mm,
+                                      input, weights, biases, output, conv_info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << std::endl);
+    return func;
+}
+
 /** Create a backend bounding box transform layer function
  *
  * @tparam BoundingBoxTransformLayerFunction    Backend bounding box transform function
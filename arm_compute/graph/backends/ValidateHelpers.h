@@ -52,6 +52,36 @@ inline arm_compute::ITensorInfo *get_backing_tensor_info(arm_compute::graph::Ten
     return ((tensor == nullptr) || (tensor->handle() == nullptr)) ? nullptr : tensor->handle()->tensor().info();
 }
 
+/** Validates a Binary Convolution layer node
+ *
+ * @tparam BinaryConvolutionLayer Binary Convolution layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename BinaryConvolutionLayer>
+Status validate_binary_convolution_layer(BinaryConvolutionLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating BinaryConvolutionLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input     = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights   = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases    = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *scale     = get_backing_tensor_info(node.input(3));
+    arm_compute::ITensorInfo *shift     = get_backing_tensor_info(node.input(4));
+    arm_compute::ITensorInfo *output    = get_backing_tensor_info(node.output(0));
+    const PadStrideInfo       conv_info = node.convolution_info();
+
+    // The generic function doesn't have a fused output stage
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scale != nullptr || shift != nullptr || node.fused_activation().enabled(), "Fused scale, shift and activation not supported");
+
+    return BinaryConvolutionLayer::validate(input, weights, biases, output, conv_info);
+}
+
 /** Validates a Bounding Box Transform layer node
  *
  * @tparam BoundingBoxTransformLayer  Bounding Box Transform layer function type
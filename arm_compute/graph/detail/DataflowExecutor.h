@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DETAIL_DATAFLOW_EXECUTOR_H__
+#define __ARM_COMPUTE_GRAPH_DETAIL_DATAFLOW_EXECUTOR_H__
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Executor running the tasks of a workload as soon as all their inputs are ready
+ *
+ * Independent tasks (e.g. the branches of an inception module) run at the same time, each of them on its own lane.
+ * A lane is a worker thread with a private pool of threads, which becomes the scheduler of all the functions it runs.
+ * The threads are split among the lanes once, and each lane pins its threads to its own set of cores, so the running
+ * tasks never compete for a core. As a consequence a task which is the only one ready only runs on its lane's threads.
+ *
+ * @note Only NEON workloads are supported.
+ */
+class DataflowExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] workload    Workload to execute. Its tasks must be sorted in topological order.
+     * @param[in] num_threads Total number of threads to split among the lanes.
+     */
+    DataflowExecutor(const ExecutionWorkload &workload, unsigned int num_threads);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    DataflowExecutor(const DataflowExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    DataflowExecutor &operator=(const DataflowExecutor &) = delete;
+    /** Destructor: stops the lanes */
+    ~DataflowExecutor();
+    /** Checks if a workload can be run by a dataflow executor
+     *
+     * @param[in] workload Workload to check
+     *
+     * @return True if all the tasks of the workload run on NEON and the library has been built with C++11 threads support
+     */
+    static bool is_supported(const ExecutionWorkload &workload);
+    /** Returns the maximum number of tasks which can run at the same time
+     *
+     * @return Number of lanes
+     */
+    unsigned int num_lanes() const;
+    /** Runs all the tasks of a workload once
+     *
+     * @param[in] workload Workload to execute. Must be the workload the executor has been created with.
+     */
+    void run(ExecutionWorkload &workload);
+
+private:
+    class Lane;
+    /** Queue of the ready tasks, sorted in topological order */
+    using TaskQueue = std::priority_queue<unsigned int, std::vector<unsigned int>, std::greater<unsigned int>>;
+
+    /** Dispatches the ready tasks to the free lanes
+     *
+     * @note Must be called with _mutex held.
+     */
+    void dispatch_ready_tasks();
+    /** Function ran by the thread of a lane
+     *
+     * @param[in] lane Lane to serve
+     */
+    void lane_thread(Lane &lane);
+
+    std::vector<std::vector<unsigned int>> _successors;       /**< Indices of the tasks consuming the outputs of each task */
+    std::vector<unsigned int>              _num_dependencies; /**< Number of tasks producing the inputs of each task */
+    std::vector<std::unique_ptr<Lane>>     _lanes;
+    unsigned int                           _num_threads;
+
+    // State of the current run, protected by _mutex
+    ExecutionWorkload        *_workload;
+    std::vector<unsigned int> _pending_dependencies;
+    TaskQueue                 _ready_tasks;
+    std::vector<Lane *>       _free_lanes;
+    unsigned int              _num_running;
+    unsigned int              _num_completed;
+    std::exception_ptr        _error;
+    bool                      _stop;
+    std::mutex                _mutex;
+    std::condition_variable   _cv; /**< Signalled when a task completes */
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_DETAIL_DATAFLOW_EXECUTOR_H__ */
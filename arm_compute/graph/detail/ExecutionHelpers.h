@@ -28,6 +28,9 @@
 
 namespace arm_compute
 {
+// Forward declarations
+class WeightsCache;
+
 namespace graph
 {
 // Forward declarations
@@ -64,6 +67,22 @@ void allocate_all_output_tensors(INode &node);
  * @param[in] g Graph to allocate the tensors
  */
 void allocate_const_tensors(Graph &g);
+/** Backs the const tensors of a graph with the weights shared through a cache
+ *
+ * The accessors of the tensors are called only if their weights aren't in the cache yet, and are released afterwards.
+ *
+ * @note Only the tensors of the NEON backend can be shared
+ *
+ * @param[in] g     Graph to share the const tensors of
+ * @param[in] cache Cache shared with the other graphs built from the same model
+ */
+void share_const_tensors(Graph &g, WeightsCache &cache);
+/** Drops from a cache the const tensors of a graph which are not used any more
+ *
+ * @param[in] g     Graph to release the const tensors of
+ * @param[in] cache Cache the const tensors have been shared through
+ */
+void release_unused_shared_tensors(Graph &g, WeightsCache &cache);
 /** Allocates all tensors of a graph
  *
  * @param[in] g Graph to allocate the tensors
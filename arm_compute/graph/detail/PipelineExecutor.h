@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_EXECUTOR_H__
+#define __ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_EXECUTOR_H__
+
+#include "arm_compute/graph/Types.h"
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class MemoryRegion;
+
+namespace graph
+{
+// Forward declarations
+class Graph;
+class Tensor;
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Executor streaming successive inputs through a pipeline of stages
+ *
+ * The nodes of the graph are split in contiguous ranges of the topological order of similar amount of work,
+ * each of them run by a stage on its own group of threads pinned to cores no other stage uses. The input and output accessors get a stage of their own,
+ * so loading the next input and consuming the previous outputs overlap with the computations.
+ *
+ * Every stage works on a different input at a given time. A tensor produced by a stage and consumed by the next ones
+ * is therefore split in one tensor per stage, which take their memory in turns from a ring of buffers:
+ * a stage writes the buffer of the next input while the following stages read the buffers of the previous ones.
+ *
+ * @note Only NEON graphs are supported.
+ */
+class PipelineExecutor final
+{
+public:
+    /** Constructor: splits the graph in stages and rebinds the tensors crossing them
+     *
+     * @note Must be called before the nodes of the graph are configured.
+     * @note Tensors shared by several nodes (e.g. sub-tensors or in-place outputs) are never split, so they can prevent some splits.
+     *
+     * @param[in, out] g           Graph to split
+     * @param[in]      node_order  Nodes of the graph in topological order
+     * @param[in]      num_stages  Maximum number of stages to split the computations in
+     * @param[in]      num_threads Total number of threads to share among the stages running computations
+     */
+    PipelineExecutor(Graph &g, const std::vector<NodeID> &node_order, unsigned int num_stages, unsigned int num_threads);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PipelineExecutor(const PipelineExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PipelineExecutor &operator=(const PipelineExecutor &) = delete;
+    /** Destructor: stops the stages */
+    ~PipelineExecutor();
+    /** Checks if a graph can be run by a pipeline executor
+     *
+     * @param[in] g Graph to check
+     *
+     * @return True if all the nodes of the graph run on NEON and the library has been built with C++11 threads support
+     */
+    static bool is_supported(const Graph &g);
+    /** Returns the number of stages of the pipeline, including the ones running the accessors
+     *
+     * @return Number of stages, less than 2 if the graph couldn't be split
+     */
+    unsigned int num_stages() const;
+    /** Returns the number of stages running functions
+     *
+     * @note Valid only once the executor has been configured.
+     *
+     * @return Maximum number of functions running at the same time
+     */
+    unsigned int num_compute_stages() const;
+    /** Assigns the tasks of a workload to the stages and allocates the buffers of the tensors crossing them
+     *
+     * @note Must be called after the nodes of the graph have been configured, and before any other tensor is allocated.
+     *
+     * @param[in] workload Workload of the split graph
+     */
+    void configure(const ExecutionWorkload &workload);
+    /** Streams inputs through the pipeline until one of the input or output accessors returns false
+     *
+     * The inputs loaded after the one which made an output accessor return false are dropped.
+     *
+     * @param[in] workload Workload to execute. Must be the workload the executor has been configured with.
+     */
+    void run(ExecutionWorkload &workload);
+
+private:
+    class Stage;
+    /** Tensor crossing stages, split in one tensor per stage it is used in */
+    struct Boundary
+    {
+        std::vector<Tensor *>                      tensors{};  /**< Tensor used by the producing stage and by each following stage, nullptr if unused */
+        std::vector<std::unique_ptr<MemoryRegion>> buffers{};  /**< Ring of buffers, one per stage the tensor crosses plus one */
+        unsigned int                               stage{ 0 }; /**< Stage producing the tensor */
+    };
+
+    /** Checks if a stage can start processing an input
+     *
+     * @note Must be called with _mutex held.
+     *
+     * @param[in] stage Index of the stage
+     * @param[in] frame Index of the input
+     *
+     * @return True if the previous stage is done with the input and the buffers the stage writes into are free
+     */
+    bool can_start(unsigned int stage, unsigned int frame) const;
+    /** Runs a stage on an input
+     *
+     * @param[in]  stage     Stage to run
+     * @param[in]  frame     Index of the input
+     * @param[out] end_frame Index of the first input not to process if an accessor requested the end of the stream
+     */
+    void run_frame(Stage &stage, unsigned int frame, unsigned int &end_frame);
+    /** Function ran by the thread of a stage
+     *
+     * @param[in] stage Index of the stage to serve
+     */
+    void stage_thread(unsigned int stage);
+
+    std::vector<int>                    _node_stages; /**< Stage of each node of the graph, -1 for constant nodes */
+    std::vector<Boundary>               _boundaries;
+    std::vector<std::unique_ptr<Stage>> _stages;
+
+    // State of the current run, protected by _mutex
+    ExecutionWorkload        *_workload;
+    std::vector<unsigned int> _completed_frames; /**< Number of inputs each stage is done with */
+    unsigned int              _end_frame;        /**< Index of the first input not to process */
+    unsigned int              _num_finished;     /**< Number of stages done with the stream */
+    unsigned int              _run_id;
+    std::exception_ptr        _error;
+    bool                      _stop;
+    std::mutex                _mutex;
+    std::condition_variable   _cv; /**< Signalled when a stage completes an input */
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_EXECUTOR_H__ */
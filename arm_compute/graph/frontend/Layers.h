@@ -154,6 +154,65 @@ private:
     float               _epsilon;
 };
 
+/** Binary Convolution Layer */
+class BinaryConvolutionLayer final : public ILayer
+{
+public:
+    /** Construct a binary convolution layer.
+     *
+     * @param[in] conv_width  Convolution width.
+     * @param[in] conv_height Convolution height.
+     * @param[in] ofm         Output feature map.
+     * @param[in] weights     Accessor to get kernel weights from. Weights are binarized by the backend.
+     * @param[in] bias        Accessor to get kernel bias from.
+     * @param[in] conv_info   Padding and stride information.
+     * @param[in] scale       (Optional) Accessor to get the per-channel scale applied to the results from, e.g. a folded batch normalization.
+     * @param[in] shift       (Optional) Accessor to get the per-channel shift added to the results after @p scale from.
+     * @param[in] fused_act   (Optional) Activation fused to the results. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     */
+    BinaryConvolutionLayer(unsigned int        conv_width,
+                           unsigned int        conv_height,
+                           unsigned int        ofm,
+                           ITensorAccessorUPtr weights,
+                           ITensorAccessorUPtr bias,
+                           PadStrideInfo       conv_info,
+                           ITensorAccessorUPtr scale     = nullptr,
+                           ITensorAccessorUPtr shift     = nullptr,
+                           ActivationLayerInfo fused_act = ActivationLayerInfo())
+        : _conv_width(conv_width),
+          _conv_height(conv_height),
+          _ofm(ofm),
+          _conv_info(std::move(conv_info)),
+          _weights(std::move(weights)),
+          _bias(std::move(bias)),
+          _scale(std::move(scale)),
+          _shift(std::move(shift)),
+          _fused_act(fused_act)
+    {
+    }
+
+    NodeID create_layer(IStream &s) override
+    {
+        NodeIdxPair input         = { s.tail_node(), 0 };
+        NodeParams  common_params = { name(), s.hints().target_hint };
+        return GraphBuilder::add_binary_convolution_node(s.graph(), common_params, input,
+                                                         Size2D(_conv_width, _conv_height), _ofm, _conv_info,
+                                                         std::move(_weights), std::move(_bias),
+                                                         std::move(_scale), std::move(_shift), _fused_act);
+    }
+
+private:
+    unsigned int              _conv_width;
+    unsigned int              _conv_height;
+    unsigned int              _ofm;
+    const PadStrideInfo       _conv_info;
+    ITensorAccessorUPtr       _weights;
+    ITensorAccessorUPtr       _bias;
+    ITensorAccessorUPtr       _scale;
+    ITensorAccessorUPtr       _shift;
+    const ActivationLayerInfo _fused_act;
+};
+
 /** Bounding Box Transform Layer */
 class BoundingBoxTransformLayer final : public ILayer
 {
@@ -67,6 +67,11 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Reports the memory held by the finalized stream
+     *
+     * @return Memory usage per category, node and memory pool
+     */
+    GraphMemoryUsage memory_usage() const;
 
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
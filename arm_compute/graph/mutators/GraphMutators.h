@@ -29,6 +29,7 @@
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
 #include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
+#include "arm_compute/graph/mutators/PadLayerSubTensorMutator.h"
 #include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
 
 #endif /* __ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H__ */
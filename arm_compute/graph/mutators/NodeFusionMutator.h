@@ -25,6 +25,9 @@
 #define __ARM_COMPUTE_GRAPH_NODE_FUSION_MUTATOR_H__
 
 #include "arm_compute/graph/IGraphMutator.h"
+#include "arm_compute/graph/Types.h"
+
+#include <set>
 
 namespace arm_compute
 {
@@ -37,6 +40,12 @@ namespace detail
  * @param[in] g Graph to perform operation fusion on
  */
 void fuse_batch_norm_with_activation(Graph &g);
+/** Fuse a batch normalization layer into the scale and shift of the preceding NEON binary convolution layer
+ *
+ * @param[in] g                           Graph to perform operation fusion on
+ * @param[in] supported_fused_activations Activations which can be fused along with the batch normalization
+ */
+void fuse_binary_convolution_with_batch_normalization(Graph &g, const std::set<Activation> &supported_fused_activations);
 } // namespace detail
 
 /** Mutation pass to fuss nodes */
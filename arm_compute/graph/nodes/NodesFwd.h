@@ -32,6 +32,7 @@ namespace graph
 class INode;
 class ActivationLayerNode;
 class BatchNormalizationLayerNode;
+class BinaryConvolutionLayerNode;
 class BoundingBoxTransformLayerNode;
 class ChannelShuffleLayerNode;
 class ConcatenateLayerNode;
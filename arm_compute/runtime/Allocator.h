@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/IAllocator.h"
 
 #include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/Types.h"
 
 #include <cstddef>
 
@@ -36,13 +37,22 @@ namespace arm_compute
 class Allocator final : public IAllocator
 {
 public:
-    /** Default constructor */
+    /** Default constructor: regions follow @ref MemoryRegion::default_policy() */
     Allocator() = default;
+    /** Constructor
+     *
+     * @param[in] policy Allocation policy of the regions created by this allocator
+     */
+    explicit Allocator(HostMemoryPolicy policy);
 
     // Inherited methods overridden:
     void *allocate(size_t size, size_t alignment) override;
     void free(void *ptr) override;
     std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    bool             _has_policy{ false };
+    HostMemoryPolicy _policy{ HostMemoryPolicy::ZERO_INITIALIZED };
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_ALLOCATOR_H__ */
@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/IScheduler.h"
 
 #include <list>
+#include <vector>
 
 namespace arm_compute
 {
@@ -34,6 +35,22 @@ namespace arm_compute
 class CPPScheduler : public IScheduler
 {
 public:
+    /** Placement of the threads of the pool on the cores of the system */
+    enum class CorePolicy
+    {
+        ANY,       /**< Threads aren't pinned, the calling thread processes a share of the work and all the threads get equal shares (Default) */
+        ALL_CORES, /**< Each thread is pinned to a core, most capable cores first, and static splits give each thread a share proportional to its core's capacity */
+        BIG_CORES, /**< Each thread is pinned to one of the most capable cores, the pool is limited to their number */
+        CUSTOM,    /**< Each thread is pinned to one of the cores given to @ref set_cores, the pool is limited to their number */
+    };
+
+    /** Constructor: create a pool of threads.
+     *
+     * @note Most users should use the singleton returned by @ref get(). Separate instances allow different functions to run at the same time on disjoint sets of threads.
+     */
+    CPPScheduler();
+    /** Destructor: join all the threads of the pool. */
+    ~CPPScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
@@ -44,6 +61,28 @@ public:
      * @return Number of threads available in CPPScheduler.
      */
     unsigned int num_threads() const override;
+    /** Sets how the threads of the pool are placed on the cores of the system.
+     *
+     * On heterogeneous systems (e.g. big.LITTLE) pinning the threads lets the scheduler know the capacity of
+     * the core each of them runs on, and keeps the kernels from migrating between cores in the middle of a run.
+     *
+     * @note With pinning policies the calling thread only waits for the workers, so that it isn't pinned itself.
+     *
+     * @param[in] policy Placement policy to use. The pool is recreated if it changes.
+     */
+    void set_core_policy(CorePolicy policy);
+    /** Pins the threads of the pool to the given cores, one thread per core, and sets the policy to @ref CorePolicy::CUSTOM
+     *
+     * This lets several pools run side by side on disjoint sets of cores.
+     *
+     * @param[in] cores Indices of the cores to use. Mustn't be empty.
+     */
+    void set_cores(std::vector<unsigned int> cores);
+    /** Returns the placement policy of the threads of the pool.
+     *
+     * @return The current placement policy.
+     */
+    CorePolicy core_policy() const;
 
     /** Access the scheduler singleton
      *
@@ -70,11 +109,15 @@ protected:
 
 private:
     class Thread;
-    /** Constructor: create a pool of threads. */
-    CPPScheduler();
+    /** Recreate the worker threads according to the number of threads and placement policy. */
+    void create_threads();
 
-    unsigned int      _num_threads;
-    std::list<Thread> _threads;
+    unsigned int              _num_threads;
+    unsigned int              _requested_threads;
+    CorePolicy                _core_policy;
+    std::vector<unsigned int> _cores;
+    std::vector<unsigned int> _thread_capacities;
+    std::list<Thread>         _threads;
 };
 }
 #endif /* __ARM_COMPUTE_CPPSCHEDULER_H__ */
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__
+#define __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+/** C++11 implementation of a pool of persistent threads which split a kernel's execution using work stealing.
+ *
+ * Contrary to @ref CPPScheduler, scheduling a kernel doesn't allocate any memory nor wake up each thread through its own
+ * mutex and condition variable:
+ * - The windows of a kernel are spread among per-thread queues, each thread pops windows from the front of its own queue
+ *   and steals windows from the back of the other queues once it is empty.
+ * - Idle threads spin for a short while waiting for the next kernel before parking on a condition variable, so that
+ *   back-to-back kernels don't pay for a wake-up.
+ */
+class CPPWorkStealingScheduler : public IScheduler
+{
+public:
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    CPPWorkStealingScheduler(const CPPWorkStealingScheduler &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    CPPWorkStealingScheduler &operator=(const CPPWorkStealingScheduler &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains threads) */
+    CPPWorkStealingScheduler(CPPWorkStealingScheduler &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains threads) */
+    CPPWorkStealingScheduler &operator=(CPPWorkStealingScheduler &&) = delete;
+    /** Destructor: stop and join the worker threads. */
+    ~CPPWorkStealingScheduler();
+    /** Sets the number of threads the scheduler will use to run the kernels.
+     *
+     * @param[in] num_threads If set to 0, then one thread per CPU core available on the system will be used, otherwise the number of threads specified.
+     */
+    void set_num_threads(unsigned int num_threads) override;
+    /** Returns the number of threads that the CPPWorkStealingScheduler has in its pool.
+     *
+     * @return Number of threads available in CPPWorkStealingScheduler.
+     */
+    unsigned int num_threads() const override;
+
+    /** Access the scheduler singleton
+     *
+     * @return The scheduler
+     */
+    static CPPWorkStealingScheduler &get();
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * The kernel will run on a single thread if any of these conditions is true:
+     * - ICPPKernel::is_parallelisable() returns false
+     * - The scheduler has been initialized with only one thread.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     */
+    void schedule(ICPPKernel *kernel, const Hints &hints) override;
+
+protected:
+    /** Will run the workloads in parallel using num_threads
+     *
+     * @param[in] workloads Workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    static constexpr size_t cache_line_size = 64; /**< Size in bytes of the cache lines the queues are aligned to */
+
+    /** Queue of the indices of the windows left to a thread, packed as [begin, end) in a single atomic word and padded to a whole cache line */
+    struct RangeQueue
+    {
+        std::atomic<uint64_t> range{ 0 };
+        uint8_t               padding[cache_line_size - sizeof(std::atomic<uint64_t>)];
+    };
+
+    /** Constructor: create a pool of threads. */
+    CPPWorkStealingScheduler();
+    /** Start the worker threads */
+    void start_workers();
+    /** Stop and join the worker threads */
+    void stop_workers();
+    /** Function ran by each worker thread
+     *
+     * @param[in] thread_id  Index of the thread.
+     * @param[in] last_epoch Epoch of the last job published before the thread was started.
+     */
+    void worker_thread(unsigned int thread_id, unsigned int last_epoch);
+    /** Publish the current job to the worker threads, take part in its execution and wait for its completion
+     *
+     * @param[in] num_items Number of windows or workloads of the job.
+     */
+    void run_job(unsigned int num_items);
+    /** Execute windows or workloads of the current job until all the queues are empty
+     *
+     * @param[in] thread_id Index of the calling thread.
+     */
+    void process_items(unsigned int thread_id);
+    /** Pop the first item of a thread's own queue
+     *
+     * @param[in]  thread_id Index of the calling thread.
+     * @param[out] item      Index of the popped item.
+     *
+     * @return True if an item was popped.
+     */
+    bool pop(unsigned int thread_id, unsigned int &item);
+    /** Steal the last item of another thread's queue
+     *
+     * @param[in]  thread_id Index of the calling thread.
+     * @param[out] item      Index of the stolen item.
+     *
+     * @return True if an item was stolen.
+     */
+    bool steal(unsigned int thread_id, unsigned int &item);
+
+    unsigned int                  _num_threads;
+    std::vector<std::thread>      _workers;
+    std::unique_ptr<uint8_t[]>    _queues_memory;
+    RangeQueue                   *_queues;
+
+    // Current job: either the windows of a kernel or a list of workloads
+    ICPPKernel                           *_kernel;
+    Window                                _max_window;
+    Hints                                 _hints;
+    std::pair<unsigned int, unsigned int> _grid;
+    std::vector<Workload>                *_workloads;
+
+    std::atomic<unsigned int> _epoch;        /**< Incremented every time a new job is published */
+    std::atomic<unsigned int> _busy_workers; /**< Number of worker threads which haven't finished the current job yet */
+    std::atomic<bool>         _has_error;    /**< True if a workload threw an exception */
+    std::exception_ptr        _error;
+    std::mutex                _mutex;
+    std::condition_variable   _cv;
+    unsigned int              _num_parked; /**< Number of worker threads parked on the condition variable, protected by _mutex */
+    bool                      _stop;       /**< Request for the worker threads to exit, protected by _mutex */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__ */
@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__
 #define __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__
 
+#include <vector>
+
 namespace arm_compute
 {
 class CPUInfo;
@@ -40,5 +42,22 @@ void get_cpu_configuration(CPUInfo &cpuinfo);
  * @return The minumum number of common cores.
  */
 unsigned int get_threads_hint();
+/** Estimates the relative compute capacity of each core of the system.
+ *
+ * The capacities exposed by the kernel in /sys/devices/system/cpu/cpuN/cpu_capacity are used when available,
+ * otherwise little cores (Cortex-A53 / Cortex-A55) are assumed to have half the capacity of the other ones.
+ *
+ * @param[in] cpuinfo @ref CPUInfo holding the system's cpu configuration.
+ *
+ * @return The capacity of each core, 1024 for the most capable ones.
+ */
+std::vector<unsigned int> get_cpu_capacities(const CPUInfo &cpuinfo);
+/** Pins the calling thread to a core.
+ *
+ * @param[in] core Index of the core.
+ *
+ * @return True if the thread was pinned, false if the system doesn't support it or refused the request.
+ */
+bool set_thread_affinity(unsigned int core);
 }
 #endif /* __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__ */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_HOSTMEMORYTRACKER_H__
+#define __ARM_COMPUTE_HOSTMEMORYTRACKER_H__
+
+#include "arm_compute/runtime/Types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace arm_compute
+{
+/** Accounts for the host memory allocated by the @ref MemoryRegion objects created while the tracker is active on a thread
+ *
+ * The memory is released from the tracker it was accounted to, whichever thread frees it.
+ * Trackers can be nested: a tracker also accounts for the memory of the trackers it is the parent of.
+ */
+class HostMemoryTracker final : public std::enable_shared_from_this<HostMemoryTracker>
+{
+public:
+    /** Makes a tracker the active one of the calling thread until the end of the scope */
+    class Scope final
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] tracker Tracker to activate. Can be nullptr to stop tracking the allocations.
+         */
+        explicit Scope(HostMemoryTracker *tracker);
+        /** Restores the tracker which was active before */
+        ~Scope();
+        /** Prevent instances of this class from being copied */
+        Scope(const Scope &) = delete;
+        /** Prevent instances of this class from being copied */
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        HostMemoryTracker *_previous;
+    };
+
+    /** Constructor
+     *
+     * @param[in] parent (Optional) Tracker which also accounts for the memory of this one
+     */
+    explicit HostMemoryTracker(std::shared_ptr<HostMemoryTracker> parent = nullptr);
+    /** Accounts for an allocation
+     *
+     * @param[in] size Size in bytes of the allocation
+     */
+    void allocated(size_t size);
+    /** Accounts for a deallocation
+     *
+     * @param[in] size Size in bytes of the deallocation
+     */
+    void freed(size_t size);
+    /** Returns the memory accounted for by the tracker
+     *
+     * @return Resident and peak amounts of memory
+     */
+    MemoryUsage usage() const;
+    /** Returns the tracker active on the calling thread
+     *
+     * @note The tracker must be owned by a std::shared_ptr
+     *
+     * @return The active tracker, nullptr if the allocations aren't tracked
+     */
+    static std::shared_ptr<HostMemoryTracker> current();
+
+private:
+    std::shared_ptr<HostMemoryTracker> _parent;
+    std::atomic<size_t>                _resident;
+    std::atomic<size_t>                _peak;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_HOSTMEMORYTRACKER_H__ */
@@ -78,6 +78,11 @@ public:
      * @return Mapping type of the lifetime manager
      */
     virtual MappingType mapping_type() const = 0;
+    /** Returns the size of the memory pools created by the lifetime manager
+     *
+     * @return Size in bytes of a pool, i.e. the memory needed by all the registered groups
+     */
+    virtual size_t pool_size() const = 0;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_ILIFETIMEMANAGER_H__ */
@@ -64,6 +64,11 @@ public:
      * @pre All pools must be unoccupied
      */
     virtual void clear() = 0;
+    /** Returns the size of each of the pools populated by the memory manager
+     *
+     * @return Size in bytes of a pool. The memory held by the manager is this size multiplied by the number of pools of its pool manager
+     */
+    virtual size_t pool_size() const = 0;
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_IMEMORYMANAGER_H__ */
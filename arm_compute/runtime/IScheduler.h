@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_ISCHEDULER_H__
 
 #include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Dimensions.h"
 
 #include <functional>
 
@@ -55,7 +56,7 @@ public:
          * @param[in] strategy        (Optional) Split strategy.
          */
         Hints(unsigned int split_dimension, StrategyHint strategy = StrategyHint::STATIC)
-            : _split_dimension(split_dimension), _strategy(strategy)
+            : _split_dimension(split_dimension), _secondary_split_dimension(MAX_DIMS), _strategy(strategy)
         {
         }
         /** Set the split_dimension hint
@@ -77,6 +78,39 @@ public:
         {
             return _split_dimension;
         }
+        /** Set the secondary_split_dimension hint
+         *
+         * When set, the scheduler splits the kernel's execution window into a grid of tiles across
+         * both the split dimension and this one, which keeps all the threads busy when the split
+         * dimension alone has too few iterations.
+         *
+         * @note The kernel must accept any sub-window along both dimensions.
+         *
+         * @param[in] secondary_split_dimension Second dimension along which to split the kernel's execution window.
+         *
+         * @return the Hints object
+         */
+        Hints &set_secondary_split_dimension(unsigned int secondary_split_dimension)
+        {
+            _secondary_split_dimension = secondary_split_dimension;
+            return *this;
+        }
+        /** Return the prefered secondary split dimension
+         *
+         * @return The secondary split dimension
+         */
+        unsigned int secondary_split_dimension() const
+        {
+            return _secondary_split_dimension;
+        }
+        /** Whether the workload should be split across two dimensions
+         *
+         * @return True if a secondary split dimension, different from the split dimension, has been set
+         */
+        bool is_2d_split() const
+        {
+            return _secondary_split_dimension < MAX_DIMS && _secondary_split_dimension != _split_dimension;
+        }
 
         /** Set the strategy hint
          *
@@ -100,6 +134,7 @@ public:
 
     private:
         unsigned int _split_dimension;
+        unsigned int _secondary_split_dimension;
         StrategyHint _strategy;
     };
     /** Signature for the workloads to execute */
@@ -70,7 +70,7 @@ protected:
     struct Element
     {
         Element(void *id_ = nullptr, IMemory *handle_ = nullptr, size_t size_ = 0, size_t alignment_ = 0, bool status_ = false)
-            : id(id_), handle(handle_), size(size_), alignment(alignment_), status(status_)
+            : id(id_), handle(handle_), size(size_), alignment(alignment_), status(status_), start(0), end(0)
         {
         }
         void    *id;        /**< Element id */
@@ -78,6 +78,8 @@ protected:
         size_t   size;      /**< Element's size */
         size_t   alignment; /**< Alignment requirement */
         bool     status;    /**< Lifetime status */
+        size_t   start;     /**< Time at which the element's lifetime started */
+        size_t   end;       /**< Time at which the element's lifetime ended */
     };
 
     /** Blob struct */
@@ -94,6 +96,7 @@ protected:
     std::list<Blob> _free_blobs;                                           /**< Free blobs */
     std::list<Blob> _occupied_blobs;                                       /**< Occupied blobs */
     std::map<IMemoryGroup *, std::map<void *, Element>> _finalized_groups; /**< A map that contains the finalized groups */
+    size_t _time;                                                          /**< Logical clock, ticking at every start and end of lifetime */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_ISIMPLELIFETIMEMANAGER_H__ */
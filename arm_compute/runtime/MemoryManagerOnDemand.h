@@ -54,6 +54,7 @@ public:
     IPoolManager     *pool_manager() override;
     void populate(IAllocator &allocator, size_t num_pools) override;
     void clear() override;
+    size_t pool_size() const override;
 
 private:
     std::shared_ptr<ILifetimeManager> _lifetime_mgr; /**< Lifetime manager */
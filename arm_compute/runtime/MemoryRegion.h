@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/IMemoryRegion.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Types.h"
 #include "support/ToolchainSupport.h"
 
 #include <cstddef>
@@ -41,29 +42,9 @@ public:
      *
      * @param[in] size      Region size
      * @param[in] alignment Alignment in bytes of the base pointer. Defaults to 0
+     * @param[in] policy    (Optional) How the backing memory is allocated. Defaults to the policy set with @ref set_default_policy
      */
-    MemoryRegion(size_t size, size_t alignment = 0)
-        : IMemoryRegion(size), _mem(nullptr), _ptr(nullptr)
-    {
-        if(size != 0)
-        {
-            // Allocate backing memory
-            size_t space = size + alignment;
-            _mem         = std::shared_ptr<uint8_t>(new uint8_t[space](), [](uint8_t *ptr)
-            {
-                delete[] ptr;
-            });
-            _ptr = _mem.get();
-
-            // Calculate alignment offset
-            if(alignment != 0)
-            {
-                void *aligned_ptr = _mem.get();
-                support::cpp11::align(alignment, size, aligned_ptr, space);
-                _ptr = aligned_ptr;
-            }
-        }
-    }
+    MemoryRegion(size_t size, size_t alignment = 0, HostMemoryPolicy policy = default_policy());
     MemoryRegion(void *ptr, size_t size)
         : IMemoryRegion(size), _mem(nullptr), _ptr(nullptr)
     {
@@ -102,6 +83,20 @@ public:
         }
     }
 
+    /** Sets the allocation policy used by the regions which aren't given one explicitly
+     *
+     * @note Uninitialised memory makes allocations cheaper but the padding of the tensors then holds garbage
+     *       until it is written to, which kernels must not rely on anyway when memory is managed.
+     *
+     * @param[in] policy Allocation policy to use by default
+     */
+    static void set_default_policy(HostMemoryPolicy policy);
+    /** Returns the allocation policy used by the regions which aren't given one explicitly
+     *
+     * @return The default allocation policy
+     */
+    static HostMemoryPolicy default_policy();
+
 protected:
     std::shared_ptr<uint8_t> _mem;
     void                    *_ptr;
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBINARYWEIGHTS_H__
+#define __ARM_COMPUTE_NEBINARYWEIGHTS_H__
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Pre-packed weights of a binary convolution layer
+ *
+ * Holds the packed sign bits of the weights, as computed by @ref NEBinarySign, and the alpha value of every OFM, so that
+ * @ref NEBinaryConvolutionLayer can run without the FP32 weights. They can be saved to a file, which is later memory-mapped
+ * so that the tensors point directly at its content without any copy.
+ *
+ * The file is made of a header of uint32_t values (magic number, version, data layout, kernel width, kernel height, IFM, OFM,
+ * offset and size in bytes of the packed weights, offset of alpha), followed by the packed weights and by the OFM alpha
+ * values, both starting at an offset aligned to @ref alignment bytes. Values are stored in the byte order of the host.
+ */
+class NEBinaryWeights
+{
+public:
+    /** Alignment in bytes of the tensors within a file */
+    static constexpr size_t alignment = 64;
+
+    /** Default constructor */
+    NEBinaryWeights();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryWeights(const NEBinaryWeights &) = delete;
+    /** Default move constructor */
+    NEBinaryWeights(NEBinaryWeights &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryWeights &operator=(const NEBinaryWeights &) = delete;
+    /** Default move assignment operator */
+    NEBinaryWeights &operator=(NEBinaryWeights &&) = default;
+    /** Default destructor */
+    ~NEBinaryWeights() = default;
+    /** Binarize FP32 weights and compute their alpha values
+     *
+     * @param[in] weights Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: F32.
+     *                    Data layouts supported: NCHW/NHWC.
+     */
+    void pack(const ITensor *weights);
+    /** Save the packed weights to a file
+     *
+     * @param[in] filename Name of the file to write.
+     */
+    void save(const std::string &filename) const;
+    /** Memory-map a file written by @ref save, so that the tensors use its content without copying it
+     *
+     * The file stays mapped until this object is destroyed or other weights are loaded.
+     *
+     * @param[in] filename Name of the file to map.
+     */
+    void load(const std::string &filename);
+    /** Packed weights tensor, to be passed to @ref NEBinaryConvolutionLayer together with @ref alpha and @ref weights_info
+     *
+     * @return The U8 packed weights tensor
+     */
+    const ITensor *weights() const;
+    /** Alpha tensor, containing the mean over absolute values of the weights of every OFM
+     *
+     * @return The F32 alpha tensor with dimensions [OFM]
+     */
+    const ITensor *alpha() const;
+    /** Information describing the packed weights to @ref NEBinaryConvolutionLayer
+     *
+     * @return The weights information, with the kernel size and the number of kernels
+     */
+    WeightsInfo weights_info() const;
+    /** Data layout of the packed weights, which must be the one of the convolution input
+     *
+     * @return The data layout
+     */
+    DataLayout data_layout() const;
+    /** Number of input feature maps of the packed weights
+     *
+     * @return The number of IFMs
+     */
+    unsigned int num_channels() const;
+
+private:
+    /** Deleter unmapping a memory-mapped file */
+    struct Unmapper
+    {
+        /** Unmap the memory
+         *
+         * @param[in] ptr Pointer to the beginning of the mapped memory.
+         */
+        void operator()(void *ptr) const;
+
+        size_t size; /**< Size of the mapped memory in bytes */
+    };
+
+    /** Initialise the metadata and the tensor infos of the packed weights
+     *
+     * @param[in] data_layout  Data layout of the weights.
+     * @param[in] kernel_dims  Kernel width and height.
+     * @param[in] num_channels Number of IFMs.
+     * @param[in] num_kernels  Number of OFMs.
+     */
+    void init(DataLayout data_layout, const Size2D &kernel_dims, unsigned int num_channels, unsigned int num_kernels);
+
+    Tensor                          _weights;
+    Tensor                          _alpha;
+    DataLayout                      _data_layout;
+    Size2D                          _kernel_dims;
+    unsigned int                    _num_channels;
+    unsigned int                    _num_kernels;
+    std::unique_ptr<void, Unmapper> _mapping;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEBINARYWEIGHTS_H__ */
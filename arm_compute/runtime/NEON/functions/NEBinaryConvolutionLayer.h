@@ -24,14 +24,16 @@
 #ifndef __ARM_COMPUTE_NEBINARYCONVOLUTIONLAYER_H__
 #define __ARM_COMPUTE_NEBINARYCONVOLUTIONLAYER_H__
 
-#include "arm_compute/core/NEON/kernels/NEBinarySignKernel.h"
+#include "arm_compute/core/NEON/kernels/NEBinarizeInputKernel.h"
 #include "arm_compute/core/NEON/kernels/NEBinaryConvolutionKernel.h"
+#include "arm_compute/core/NEON/kernels/NEBinaryGEMMKernel.h"
+#include "arm_compute/core/NEON/kernels/NEBinaryIm2ColKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEBinarySign.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEPadLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 
 #include <memory>
 
@@ -39,7 +41,21 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to compute the binary convolution layer. This function calls the following NEON kernels/functions: TODO
+/** Basic function to compute the binary convolution layer. This function calls the following NEON kernels/functions:
+ *
+ * -# @ref NEBinarySign (executed only once for the weights, unless they are pre-packed)
+ * -# @ref NEBinarizeInputKernel
+ * -# @ref NEBinaryConvolutionKernel or, with NHWC and kernels bigger than 1x1:
+ * -# @ref NEBinaryIm2ColKernel
+ * -# @ref NEBinaryGEMMKernel
+ *
+ * Any kernel size (with a width up to 57 for NCHW) and stride are supported.
+ * In NHWC the input and weights are binarized along the channels, so that each kernel row becomes a contiguous bit string.
+ *
+ * A per-channel scale and shift (e.g. a folded batch normalization) and a clamping activation can be fused in the output stage.
+ * Consecutive binary convolution layers can also be chained through their binarized tensors: the producer writes the packed signs
+ * of its results and their beta tensor instead of @p output, and the consumer reads them instead of @p input. In that case the
+ * FP32 tensors are only used to describe the shapes, and are neither read, written nor allocated.
  */
 class NEBinaryConvolutionLayer : public IFunction
 {   
@@ -60,47 +76,94 @@ public:
      *                              while every optional dimension from 4 and above represent a batch of inputs.
      *                              Data types supported: F32.
      * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     *                              Data layouts supported: NCHW/NHWC, the same as @p input.
      * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
      *                              Data type supported: Should match @p input data type
      * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                              Data types supported: Same as @p input.
      * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo.
-     * 
+     * @param[in]  weights_info     (Optional) Specifies if the weights have already been binarized, e.g. by @ref NEBinaryWeights.
+     *                              In that case @p weights is the U8 packed weights tensor, and the kernel size and number of kernels are taken from here.
+     * @param[in]  alpha            (Optional) Alpha tensor of pre-packed weights, with dimensions [OFM]. Data type supported: Same as @p input.
+     *                              Required if @p weights_info says the weights are pre-packed, otherwise ignored.
+     * @param[in]  scale            (Optional) Scale applied to each output feature map, with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[in]  shift            (Optional) Shift added to each output feature map after @p scale, with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[in]  act_info         (Optional) Activation layer information. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in]  binarized_input  (Optional) Packed signs of the input, as written in @p binarized_output by a previous binary convolution layer.
+     *                              If provided, @p input is only used as a descriptor of the unpacked input. Data type supported: U8.
+     * @param[in]  input_beta       (Optional) Beta tensor of @p binarized_input. Required if @p binarized_input is provided, otherwise ignored.
+     *                              Data type supported: Same as @p input.
+     * @param[out] binarized_output (Optional) Packed signs of the results, to be used as @p binarized_input by the next binary convolution layer.
+     *                              If provided, @p output is only used as a descriptor of the unpacked output. Data type supported: U8.
+     * @param[out] output_beta      (Optional) Beta tensor of @p binarized_output. Required if @p binarized_output is provided, otherwise ignored.
+     *                              Data type supported: Same as @p input.
      */
-    void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info);
+    void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                   const WeightsInfo &weights_info = WeightsInfo(), const ITensor *alpha = nullptr, const ITensor *scale = nullptr, const ITensor *shift = nullptr,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), const ITensor *binarized_input = nullptr, const ITensor *input_beta = nullptr,
+                   ITensor *binarized_output = nullptr, ITensor *output_beta = nullptr);
     /** Static function to check if given info will lead to a valid configuration of @ref NEBinaryConvolutionLayer
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
      *                             Data types supported: F32.
      * @param[in] weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
+     *                             Data layouts supported: NCHW/NHWC, the same as @p input.
      * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported:Same as @p input.
      * @param[in] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                             Data types supported: Same as @p input.
      * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info     (Optional) Specifies if the weights have already been binarized, e.g. by @ref NEBinaryWeights.
+     *                             In that case @p weights is the U8 packed weights tensor, and the kernel size and number of kernels are taken from here.
+     * @param[in] alpha            (Optional) Alpha tensor of pre-packed weights, with dimensions [OFM]. Data type supported: Same as @p input.
+     *                             Required if @p weights_info says the weights are pre-packed, otherwise ignored.
+     * @param[in] scale            (Optional) Scale applied to each output feature map, with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[in] shift            (Optional) Shift added to each output feature map after @p scale, with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[in] act_info         (Optional) Activation layer information. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in] binarized_input  (Optional) Packed signs of the input, as written in @p binarized_output by a previous binary convolution layer.
+     *                             If provided, @p input is only used as a descriptor of the unpacked input. Data type supported: U8.
+     * @param[in] input_beta       (Optional) Beta tensor of @p binarized_input. Required if @p binarized_input is provided, otherwise ignored.
+     *                             Data type supported: Same as @p input.
+     * @param[in] binarized_output (Optional) Packed signs of the results, to be used as @p binarized_input by the next binary convolution layer.
+     *                             If provided, @p output is only used as a descriptor of the unpacked output. Data type supported: U8.
+     * @param[in] output_beta      (Optional) Beta tensor of @p binarized_output. Required if @p binarized_output is provided, otherwise ignored.
+     *                             Data type supported: Same as @p input.
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                           const WeightsInfo &weights_info = WeightsInfo(), const ITensorInfo *alpha = nullptr, const ITensorInfo *scale = nullptr,
+                           const ITensorInfo *shift = nullptr, const ActivationLayerInfo &act_info = ActivationLayerInfo(), const ITensorInfo *binarized_input = nullptr,
+                           const ITensorInfo *input_beta = nullptr, const ITensorInfo *binarized_output = nullptr, const ITensorInfo *output_beta = nullptr);
     
     // Inherited methods overridden:
     void run() override;
     void prepare() override;
 
 private:
-    NEPadLayer                      _pad_input;
-    NEBinarySignKernel              _binarize_input;
-    NEBinarySignKernel              _binarize_weights;
-    NEBinaryConvolutionKernel       _binary_convolution;
-    NEPoolingLayer                  _normalize_beta;
-    Tensor                          _padded_input;
-    Tensor                          _binarized_input;
-    Tensor                          _binarized_weights;
-    Tensor                          _alpha;
-    Tensor                          _beta;
-    Tensor                          _K;
-    bool                            _is_prepared;
-    std::shared_ptr<IMemoryManager> _memory_manager;
+    MemoryGroup               _memory_group;
+    NEBinarizeInputKernel     _binarize_input;
+    NEBinarySign              _binarize_weights;
+    NEBinaryConvolutionKernel _binary_convolution;
+    NEBinaryIm2ColKernel      _im2col;
+    NEBinaryGEMMKernel        _binary_gemm;
+    const ITensor            *_original_weights;
+    const ITensor            *_original_alpha;
+    const ITensor            *_original_biases;
+    const ITensor            *_scale;
+    const ITensor            *_shift;
+    Tensor                    _binarized_input;
+    Tensor                    _binarized_weights;
+    Tensor                    _im2col_output;
+    Tensor                    _alpha;
+    Tensor                    _fused_alpha;
+    Tensor                    _fused_biases;
+    Tensor                    _K;
+    Tensor                    _tmp;
+    unsigned int              _split_dimension;
+    unsigned int              _secondary_split_dimension;
+    bool                      _use_binary_gemm;
+    bool                      _is_prepared;
 };
 }
 #endif /* __ARM_COMPUTE_CLCONVOLUTIONLAYER_H__ */
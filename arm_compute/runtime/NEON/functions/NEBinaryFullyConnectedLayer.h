@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBINARYFULLYCONNECTEDLAYER_H__
+#define __ARM_COMPUTE_NEBINARYFULLYCONNECTEDLAYER_H__
+
+#include "arm_compute/core/NEON/kernels/NEBinaryGEMMKernel.h"
+#include "arm_compute/core/NEON/kernels/NEBinarySignKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to compute a binary (XNOR-Net) fully connected layer. This function calls the following NEON kernels:
+ *
+ * -# @ref NEBinarySignKernel (executed only once for the weights)
+ * -# @ref NEBinarySignKernel
+ * -# @ref NEBinaryGEMMKernel
+ *
+ * Each output is computed as the XNOR-popcount of the binarized input and weights, scaled by the mean over absolute values
+ * of the input sample and of the weights of that output, plus the bias.
+ */
+class NEBinaryFullyConnectedLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NEBinaryFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryFullyConnectedLayer(const NEBinaryFullyConnectedLayer &) = delete;
+    /** Default move constructor */
+    NEBinaryFullyConnectedLayer(NEBinaryFullyConnectedLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinaryFullyConnectedLayer &operator=(const NEBinaryFullyConnectedLayer &) = delete;
+    /** Default move assignment operator */
+    NEBinaryFullyConnectedLayer &operator=(NEBinaryFullyConnectedLayer &&) = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input   Source tensor with dimensions [num_inputs] or [num_inputs, batches]. Data types supported: F32.
+     * @param[in]  weights Weights tensor with dimensions [num_inputs, num_outputs]. Data type supported: Same as @p input.
+     * @param[in]  biases  Biases tensor with dimensions [num_outputs]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output  Destination tensor with dimensions [num_outputs] or [num_outputs, batches]. Data type supported: Same as @p input.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBinaryFullyConnectedLayer
+     *
+     * @param[in] input   Source tensor info with dimensions [num_inputs] or [num_inputs, batches]. Data types supported: F32.
+     * @param[in] weights Weights tensor info with dimensions [num_inputs, num_outputs]. Data type supported: Same as @p input.
+     * @param[in] biases  Biases tensor info with dimensions [num_outputs]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output  Destination tensor info with dimensions [num_outputs] or [num_outputs, batches]. Data type supported: Same as @p input.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup        _memory_group;
+    NEBinarySignKernel _binarize_input;
+    NEBinarySignKernel _binarize_weights;
+    NEBinaryGEMMKernel _binary_gemm;
+    const ITensor     *_original_weights;
+    Tensor             _binarized_input;
+    Tensor             _binarized_weights;
+    Tensor             _alpha;
+    Tensor             _beta;
+    bool               _is_prepared;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEBINARYFULLYCONNECTEDLAYER_H__ */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBINARYSIGN_H__
+#define __ARM_COMPUTE_NEBINARYSIGN_H__
+
+#include "arm_compute/core/NEON/kernels/NEBinaryAlphaKernel.h"
+#include "arm_compute/core/NEON/kernels/NEBinarySignKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to binarize a tensor and compute its alpha and beta scaling factors. This function calls the following NEON kernels:
+ *
+ * -# @ref NEBinarySignKernel
+ * -# @ref NEBinaryAlphaKernel (if alpha is requested)
+ *
+ * The sign kernel only writes outputs owned by the iteration computing them, and alpha is reduced from its partial sums in a
+ * separate stage, so both stages scale with the number of threads and give the same results whatever their number.
+ */
+class NEBinarySign : public IFunction
+{
+public:
+    /** Constructor */
+    NEBinarySign(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinarySign(const NEBinarySign &) = delete;
+    /** Default move constructor */
+    NEBinarySign(NEBinarySign &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBinarySign &operator=(const NEBinarySign &) = delete;
+    /** Default move assignment operator */
+    NEBinarySign &operator=(NEBinarySign &&) = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32.
+     * @param[out] output Destination tensor. Data types supported: U8.
+     * @param[out] alpha  (Optional) Alpha tensor. It contains the mean over absolute values of each 3D input block.
+     *                    Data types supported: F32.
+     * @param[out] beta   (Optional) Beta tensor. It contains the mean over absolute values over channels.
+     *                    Data types supported: F32.
+     */
+    void configure(const ITensor *input, ITensor *output, ITensor *alpha = nullptr, ITensor *beta = nullptr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBinarySign
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32.
+     * @param[in] output Destination tensor info. Data types supported: U8.
+     * @param[in] alpha  (Optional) Alpha tensor info. Data types supported: F32.
+     * @param[in] beta   (Optional) Beta tensor info. Data types supported: F32.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *alpha = nullptr, const ITensorInfo *beta = nullptr);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    MemoryGroup         _memory_group;
+    NEBinarySignKernel  _sign_kernel;
+    NEBinaryAlphaKernel _alpha_kernel;
+    Tensor              _partial_sums;
+    size_t              _split_dimension;
+    bool                _calc_alpha;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEBINARYSIGN_H__ */
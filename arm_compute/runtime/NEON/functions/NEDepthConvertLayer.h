@@ -47,7 +47,7 @@ public:
      *
      * Valid conversions Input -> Output :
      *
-     *   - QASYMM8 -> F16, F32
+     *   - QASYMM8 -> S16, F16, F32 (S16 keeps the quantized values with the offset removed)
      *   - U8 -> U16, S16, S32
      *   - U16 -> U8, U32
      *   - S16 -> U8, S32
@@ -36,7 +36,6 @@
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
-#include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -82,8 +81,7 @@ private:
  *
  * -# @ref NEIm2ColKernel
  * -# @ref NEGEMM (if the data type is FP32 or FP16)
- * -# @ref NEGEMMLowpMatrixMultiplyCore (if the data type is QASYMM8)
- * -# @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if the data type is QASYMM8)
+ * -# @ref NEGEMMLowpMatrixMultiplyCore (if the data type is QASYMM8, with the output stage fused)
  * -# @ref NEArithmeticAdditionKernel (if biases != nullptr and we have a 1x1 convolution with the NHWC data layout)
  * -# @ref NECol2ImKernel (if NCHW data layout)
  *
@@ -151,23 +149,26 @@ private:
      *
      * @param[in]  input         Input tensor. Data types supported: QASYMM8/F16/F32.
      * @param[in]  weights       Weights tensor. Data type supported: Same as @p input.
-     * @param[out] output        Output tensor. Data types supported: Same as @p input,
-     *                           except for input of QASYMM8 type where output should be of S32 type.
+     * @param[in]  biases        Biases tensor. Only used for input of QASYMM8 type, where they are added by the output stage. Data type supported: S32.
+     * @param[out] output        Output tensor. Data types supported: Same as @p input.
+     * @param[in]  output_stage  Output stage used to requantize the result for input of QASYMM8 type.
      * @param[in]  gemm_3d_depth (Optional) Depth of GEMM 3D (Defaults to 1)
      */
-    void configure_mm(const ITensor *input, const ITensor *weights, ITensor *output, int gemm_3d_depth = 1);
+    void configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const GEMMLowpOutputStageInfo &output_stage, int gemm_3d_depth = 1);
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer matrix multiply routines
      *
      * @param[in] input         Input tensor. Data types supported: QASYMM8/F16/F32.
      * @param[in] weights       Weights tensor. Data type supported: Same as @p input.
-     * @param[in] output        Output tensor. Data types supported: Same as @p input,
-     *                          except for input of QASYMM8 type where output should be of S32 type.
+     * @param[in] biases        Biases tensor. Only used for input of QASYMM8 type, where they are added by the output stage. Data type supported: S32.
+     * @param[in] output        Output tensor. Data types supported: Same as @p input.
+     * @param[in] output_stage  Output stage used to requantize the result for input of QASYMM8 type.
      * @param[in] gemm_3d_depth (Optional) Depth of GEMM 3D (Defaults to 1)
      * @param[in] skip_im2col   (Optional) Flag which specifies if im2col has to be skipped. i.e. 1x1 convolution with NHWC data layout. (Default to false)
      *
      * @return a status
      */
-    static Status validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, int gemm_3d_depth = 1, bool skip_im2col = false);
+    static Status validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const GEMMLowpOutputStageInfo &output_stage,
+                              int gemm_3d_depth = 1, bool skip_im2col = false);
     /** Static function to check if GEMM3D is supported in @ref NEGEMM or in @ref NEGEMMLowpMatrixMultiplyCore
      *
      * @param[in] data_type     Input data type
@@ -179,23 +180,21 @@ private:
     static Status validate_gemm3d(DataType data_type, int gemm_3d_depth, bool skip_im2col);
 
 private:
-    MemoryGroup                                         _memory_group;
-    NEConvolutionLayerReshapeWeights                    _reshape_weights;
-    NEIm2ColKernel                                      _im2col_kernel;
-    NEGEMM                                              _mm_gemm;
-    NEGEMMLowpMatrixMultiplyCore                        _mm_gemmlowp;
-    NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint _gemmlowp_output_stage;
-    NECol2ImKernel                                      _col2im_kernel;
-    NEActivationLayer                                   _activationlayer_function;
-    NEArithmeticAdditionKernel                          _add_bias_kernel;
-    NEReshapeLayer                                      _reshape_layer;
+    MemoryGroup                      _memory_group;
+    NEConvolutionLayerReshapeWeights _reshape_weights;
+    NEIm2ColKernel                   _im2col_kernel;
+    NEGEMM                           _mm_gemm;
+    NEGEMMLowpMatrixMultiplyCore     _mm_gemmlowp;
+    NECol2ImKernel                   _col2im_kernel;
+    NEActivationLayer                _activationlayer_function;
+    NEArithmeticAdditionKernel       _add_bias_kernel;
+    NEReshapeLayer                   _reshape_layer;
 
     const ITensor *_original_weights;
 
     Tensor _im2col_output;
     Tensor _weights_reshaped;
     Tensor _gemm_output;
-    Tensor _tmp_output;
 
     DataLayout _data_layout;
 
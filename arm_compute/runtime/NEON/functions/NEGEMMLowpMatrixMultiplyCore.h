@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpOffsetContributionKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMLowpOffsetContributionOutputStageKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpReductionKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
@@ -44,11 +45,14 @@ class ITensor;
  *  -# @ref NEGEMMInterleave4x4Kernel
  *  -# @ref NEGEMMTranspose1xWKernel
  *  -# @ref NEGEMMLowpMatrixMultiplyKernel
- *  -# @ref NEGEMMLowpOffsetContributionKernel
+ *  -# @ref NEGEMMLowpOffsetContributionKernel or @ref NEGEMMLowpOffsetContributionOutputStageKernel
  *
  * otherwise if the DOT product instruction is available:
  *
- *  -# @ref NEGEMMLowpOffsetContributionKernel
+ *  -# @ref NEGEMMLowpOffsetContributionKernel or @ref NEGEMMLowpOffsetContributionOutputStageKernel
+ *
+ * @ref NEGEMMLowpOffsetContributionOutputStageKernel is used when gemm_info specifies a QUANTIZE_DOWN_FIXEDPOINT output stage:
+ * the offset contribution, the bias addition and the requantization to QASYMM8 are then performed in a single pass over the int32 accumulators.
  *
 */
 class NEGEMMLowpMatrixMultiplyCore : public IFunction
@@ -73,22 +77,28 @@ public:
      *  -# Convert b values from QASYMM8 to int32 add b_offset to each of them.
      *  -# Compute the matrix product of the resulting a * b in int32.
      *
+     * @note The output type is S32 if gemm_info.gemmlowp_output_stage().type == GEMMLowpOutputStageType::NONE. It is QASYMM8 otherwise
+     *
      * @param[in]  a         First input tensor  (Matrix A). Data type supported: QASYMM8.
      * @param[in]  b         Second input tensor (Matrix B). Data type supported: same as @p a
-     * @param[in]  c         Third input tensor  (Matrix C). It can be a nullptr. Data type supported: S32
-     * @param[out] output    Output tensor. Data type supported: Data type supported: S32
+     * @param[in]  c         Third input tensor  (Matrix C). It can be a nullptr. Data type supported: S32.
+     *                       Only supported, as a 1D bias of dimension [OFM], if a fused output stage is requested
+     * @param[out] output    Output tensor. Data type supported: Data type supported: S32/QASYMM8
      * @param[in]  gemm_info (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
-     *                       if the reshape of matrix B should be executed only for the first run
+     *                       if the reshape of matrix B should be executed only for the first run.
+     *                       It also specifies the output stage to fuse. Only GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT is supported
      */
     void configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *output, const GEMMInfo &gemm_info = GEMMInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMLowpMatrixMultiplyCore
      *
      * @param[in] a         First input tensor  (Matrix A). Data type supported: QASYMM8.
      * @param[in] b         Second input tensor (Matrix B). Data type supported: same as @p a
-     * @param[in] c         Third input tensor  (Matrix C). It can be a nullptr. Data type supported: S32
-     * @param[in] output    Output tensor. Data type supported: Data type supported: S32
+     * @param[in] c         Third input tensor  (Matrix C). It can be a nullptr. Data type supported: S32.
+     *                      Only supported, as a 1D bias of dimension [OFM], if a fused output stage is requested
+     * @param[in] output    Output tensor. Data type supported: Data type supported: S32/QASYMM8
      * @param[in] gemm_info (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
-     *                      if the reshape of matrix B should be executed only for the first run
+     *                      if the reshape of matrix B should be executed only for the first run.
+     *                      It also specifies the output stage to fuse. Only GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT is supported
      *
      * @return a status
      */
@@ -99,25 +109,28 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup                        _memory_group;
-    NEGEMMAssemblyDispatch             _asm_glue;
-    std::unique_ptr<INEKernel>         _mm_kernel;
-    std::unique_ptr<INEKernel>         _mtx_a_reshape_kernel;
-    std::unique_ptr<INEKernel>         _mtx_b_reshape_kernel;
-    NEGEMMLowpMatrixAReductionKernel   _mtx_a_reduction_kernel;
-    NEGEMMLowpMatrixBReductionKernel   _mtx_b_reduction_kernel;
-    NEGEMMLowpOffsetContributionKernel _offset_contribution_kernel;
-    Tensor                             _vector_sum_col;
-    Tensor                             _vector_sum_row;
-    Tensor                             _tmp_a;
-    Tensor                             _tmp_b;
-    const ITensor                     *_original_b;
-    int32_t                            _a_offset;
-    int32_t                            _b_offset;
-    bool                               _run_vector_matrix_multiplication;
-    bool                               _dot_product_path;
-    bool                               _reshape_b_only_on_first_run;
-    bool                               _is_prepared;
+    MemoryGroup                                   _memory_group;
+    NEGEMMAssemblyDispatch                        _asm_glue;
+    std::unique_ptr<INEKernel>                    _mm_kernel;
+    std::unique_ptr<INEKernel>                    _mtx_a_reshape_kernel;
+    std::unique_ptr<INEKernel>                    _mtx_b_reshape_kernel;
+    NEGEMMLowpMatrixAReductionKernel              _mtx_a_reduction_kernel;
+    NEGEMMLowpMatrixBReductionKernel              _mtx_b_reduction_kernel;
+    NEGEMMLowpOffsetContributionKernel            _offset_contribution_kernel;
+    NEGEMMLowpOffsetContributionOutputStageKernel _offset_contribution_output_stage_kernel;
+    Tensor                                        _vector_sum_col;
+    Tensor                                        _vector_sum_row;
+    Tensor                                        _tmp_a;
+    Tensor                                        _tmp_b;
+    Tensor                                        _mm_result_s32;
+    const ITensor                                *_original_b;
+    int32_t                                       _a_offset;
+    int32_t                                       _b_offset;
+    bool                                          _run_vector_matrix_multiplication;
+    bool                                          _dot_product_path;
+    bool                                          _reshape_b_only_on_first_run;
+    bool                                          _is_prepared;
+    bool                                          _fuse_output_stage;
 };
 }
 #endif /*__ARM_COMPUTE_NEGEMMLOWPMATRIXMULTIPLYCORE_H__ */
@@ -77,6 +77,7 @@ public:
 private:
     NEIm2ColKernel _kernel;
     unsigned int   _y_dim;
+    unsigned int   _x_dim;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEIM2COL_H__ */
@@ -25,24 +25,35 @@
 #define __ARM_COMPUTE_NELSTMLAYER_H__
 
 #include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
-#include "arm_compute/core/NEON/kernels/NEArithmeticAdditionKernel.h"
-#include "arm_compute/core/NEON/kernels/NEArithmeticSubtractionKernel.h"
 #include "arm_compute/core/NEON/kernels/NECopyKernel.h"
-#include "arm_compute/core/NEON/kernels/NEPixelWiseMultiplicationKernel.h"
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
+#include "arm_compute/core/NEON/kernels/NEWidthConcatenateLayerKernel.h"
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
-#include "arm_compute/runtime/NEON/functions/NEWidthConcatenateLayer.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 // Forward declarations
 class ITensor;
 
-/** Basic function to run @ref NELSTMLayer */
+/** Basic function to run a step of an LSTM layer. This function calls the following NEON kernels and functions:
+ *
+ *  -# @ref NEWidthConcatenateLayerKernel (to stack the input and the output state)
+ *  -# @ref NEGEMM (to compute the matrix products of all the gates at once)
+ *  -# @ref NELSTMCellKernel
+ *  -# @ref NEFullyConnectedLayer (if there is a projection)
+ *  -# @ref NEActivationLayerKernel (if the projection is clipped)
+ *  -# @ref NECopyKernel
+ *
+ * The weights of the gates are stacked into a single matrix in @ref prepare.
+ */
 class NELSTMLayer : public IFunction
 {
 public:
@@ -132,78 +143,26 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
-    MemoryGroup                     _memory_group;
-    NEFullyConnectedLayer           _fully_connected_input_gate;
-    NEGEMM                          _gemm_input_gate;
-    NETransposeKernel               _transpose_input_gate;
-    NEArithmeticAdditionKernel      _accum_input_gate1;
-    NEArithmeticAddition            _accum_input_gate2;
-    NEArithmeticSubtractionKernel   _subtract_input_gate;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_input_gate;
-    NEActivationLayerKernel         _activation_input_gate;
-    NEFullyConnectedLayer           _fully_connected_forget_gate;
-    NEGEMM                          _gemm_forget_gate;
-    NETransposeKernel               _transpose_forget_gate;
-    NEArithmeticAdditionKernel      _accum_forget_gate1;
-    NEArithmeticAddition            _accum_forget_gate2;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_forget_gate;
-    NEActivationLayerKernel         _activation_forget_gate;
-    NEFullyConnectedLayer           _fully_connected_cell_state;
-    NEGEMM                          _gemm_cell_state1;
-    NEGEMM                          _gemm_cell_state2;
-    NETransposeKernel               _transpose_cell_state;
-    NEArithmeticAdditionKernel      _accum_cell_state1;
-    NEArithmeticAdditionKernel      _accum_cell_state2;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_cell_state1;
-    NEActivationLayerKernel         _activation_cell_state;
-    NEActivationLayerKernel         _cell_clip;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_cell_state2;
-    NEFullyConnectedLayer           _fully_connected_output;
-    NEGEMM                          _gemm_output;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_output_state1;
-    NETransposeKernel               _transpose_output;
-    NEArithmeticAdditionKernel      _accum_output1;
-    NEArithmeticAddition            _accum_output2;
-    NEActivationLayerKernel         _activation_output;
-    NEActivationLayerKernel         _activation_output_state;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_output_state2;
-    NEFullyConnectedLayer           _fully_connected_output_state;
-    NEGEMM                          _gemm_output_state;
-    NEArithmeticAdditionKernel      _accum_output_state;
-    NEActivationLayerKernel         _projection_clip;
-    NECopyKernel                    _copy_cell_state;
-    NECopyKernel                    _copy_output;
-    NEWidthConcatenateLayer         _concat_scratch_buffer;
-    Tensor                          _input_gate_out1;
-    Tensor                          _input_gate_out2;
-    Tensor                          _input_gate_out3;
-    Tensor                          _input_gate_out4;
-    Tensor                          _input_gate_out5;
-    Tensor                          _forget_gate_out1;
-    Tensor                          _forget_gate_out2;
-    Tensor                          _forget_gate_out3;
-    Tensor                          _forget_gate_out4;
-    Tensor                          _forget_gate_out5;
-    Tensor                          _cell_state_out1;
-    Tensor                          _cell_state_out2;
-    Tensor                          _cell_state_out3;
-    Tensor                          _cell_state_out4;
-    Tensor                          _cell_state_out5;
-    Tensor                          _output1;
-    Tensor                          _output2;
-    Tensor                          _output3;
-    Tensor                          _output4;
-    Tensor                          _output5;
-    Tensor                          _cell_state_activation;
-    Tensor                          _output_state1;
-    Tensor                          _ones;
-    bool                            _run_peephole_opt;
-    bool                            _run_cifg_opt;
-    bool                            _perform_cell_clipping;
-    bool                            _has_projection_weights;
-    bool                            _perform_projection_clipping;
+    MemoryGroup                   _memory_group;
+    NEWidthConcatenateLayerKernel _concat_input;
+    NEWidthConcatenateLayerKernel _concat_output_state;
+    NEGEMM                        _gemm_gates;
+    NELSTMCellKernel              _cell_kernel;
+    NEFullyConnectedLayer         _fully_connected_output_state;
+    NEActivationLayerKernel       _projection_clip;
+    NECopyKernel                  _copy_output;
+    Tensor                        _gate_input;
+    Tensor                        _gate_weights;
+    Tensor                        _gates;
+    Tensor                        _output_state1;
+    std::vector<const ITensor *>  _input_weights;
+    std::vector<const ITensor *>  _recurrent_weights;
+    bool                          _has_projection_weights;
+    bool                          _perform_projection_clipping;
+    bool                          _is_prepared;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NELSTMLAYER_H__ */
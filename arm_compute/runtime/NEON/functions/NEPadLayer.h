@@ -25,10 +25,8 @@
 #define __ARM_COMPUTE_NEPADLAYER_H__
 
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/SubTensor.h"
 
-#include "arm_compute/core/NEON/kernels/NECopyKernel.h"
-#include "arm_compute/core/NEON/kernels/NEMemsetKernel.h"
+#include "arm_compute/core/NEON/kernels/NEPadLayerKernel.h"
 #include "arm_compute/core/Types.h"
 
 namespace arm_compute
@@ -38,8 +36,7 @@ class ITensor;
 
 /** Basic function to pad a tensor. This function calls the following NEON kernels:
  *
- *  -# @ref NEMemsetKernel
- *  -# @ref NECopyKernel
+ *  -# @ref NEPadLayerKernel
  */
 class NEPadLayer : public IFunction
 {
@@ -53,8 +50,10 @@ public:
      * @param[in]  padding        The padding for each spatial dimension of the input tensor. The pair padding[i]
      *                            specifies the front and the end padding in the i-th dimension.
      * @param[in]  constant_value (Optional) Constant value to be used for the padding
+     * @param[in]  mode           (Optional) Padding mode. With REFLECT the padding of each dimension must be smaller than its size,
+     *                            with SYMMETRIC it must not be larger.
      */
-    void configure(ITensor *input, ITensor *output, const PaddingList &padding, PixelValue constant_value = PixelValue());
+    void configure(ITensor *input, ITensor *output, const PaddingList &padding, PixelValue constant_value = PixelValue(), PaddingMode mode = PaddingMode::CONSTANT);
     /**  Static function to check if given info will lead to a valid configuration of @ref NEPadLayer.
      *
      * @param[in] input          Source tensor info. Data types supported: U8/S8/QASYMM8/U16/S16/F16/U32/S32/F32.
@@ -62,18 +61,18 @@ public:
      * @param[in] padding        The padding for each spatial dimension of the input tensor. The pair padding[i]
      *                           specifies the front and the end padding in the i-th dimension.
      * @param[in] constant_value (Optional) Constant value to be used for the padding
+     * @param[in] mode           (Optional) Padding mode
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const PaddingList &padding, PixelValue constant_value = PixelValue());
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const PaddingList &padding, PixelValue constant_value = PixelValue(),
+                           PaddingMode mode = PaddingMode::CONSTANT);
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    NEMemsetKernel _memset_kernel;
-    NECopyKernel   _copy_kernel;
-    SubTensor      _output_subtensor;
+    NEPadLayerKernel _pad_kernel;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEPADLAYER_H__ */
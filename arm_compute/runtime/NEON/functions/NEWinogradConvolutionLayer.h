@@ -27,11 +27,14 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDepthConvertLayerKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CPP/functions/CPPPermute.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 
 #include "arm_compute/runtime/Tensor.h"
 
@@ -46,8 +49,12 @@ class ITensor;
  * -# @ref NEWinogradLayerTransformOutputKernel
  * -# @ref NEGEMMAssemblyDispatch
  * -# @ref CPPPermute (three times: weights, input and output)
+ * -# @ref NEDepthConvertLayerKernel (twice, if the data type is QASYMM8: weights and input)
+ * -# @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if the data type is QASYMM8)
  *
  * @note  Some Winograd configurations (i.e. F(2x2, 5x5), F(4x4, 5x5)) are supported only with enable_fast_math = true
+ * @note  F16 and QASYMM8 only support 3x3 kernels. F16 uses F(4x4, 3x3) only with enable_fast_math = true and QASYMM8 always uses F(2x2, 3x3)
+ *        with 16-bit transforms and 32-bit accumulation (AArch64 only).
  */
 class NEWinogradConvolutionLayer : public IFunction
 {
@@ -59,10 +66,10 @@ public:
      *
      * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                              while every optional dimension from 4 and above represent a batch of inputs.
-     *                              Data types supported: F32.
+     *                              Data types supported: QASYMM8/F16/F32.
      * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
      *                              Currently only 3x3 and 5x5 kernels are supported.
-     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
      * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                              Data types supported: Same as @p input.
      * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
@@ -81,10 +88,10 @@ public:
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
-     *                             Data types supported: F32.
+     *                             Data types supported: QASYMM8/F16/F32.
      * @param[in] weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
      *                             Currently only 3x3 and 5x5 kernels are supported.
-     * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
      * @param[in] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                             Data types supported: Same as @p input.
      * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
@@ -103,12 +110,16 @@ public:
     NEWinogradConvolutionLayer &operator=(const NEWinogradConvolutionLayer &) = delete;
 
 private:
-    MemoryGroup                _memory_group;
-    NEGEMM                     _gemm_function;
-    std::unique_ptr<INEKernel> _transform_input_kernel;
-    std::unique_ptr<INEKernel> _transform_output_kernel;
-    std::unique_ptr<INEKernel> _transform_weights_kernel;
-    NEActivationLayer          _activationlayer_function;
+    MemoryGroup                                         _memory_group;
+    NEGEMM                                              _gemm_function;
+    NEGEMMAssemblyDispatch                              _asm_glue;
+    std::unique_ptr<INEKernel>                          _transform_input_kernel;
+    std::unique_ptr<INEKernel>                          _transform_output_kernel;
+    std::unique_ptr<INEKernel>                          _transform_weights_kernel;
+    NEActivationLayer                                   _activationlayer_function;
+    NEDepthConvertLayerKernel                           _convert_input_kernel;
+    NEDepthConvertLayerKernel                           _convert_weights_kernel;
+    NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint _output_stage;
 
     CPPPermute     _permute_input;
     CPPPermute     _permute_weights;
@@ -119,11 +130,15 @@ private:
     Tensor         _input_nhwc;
     Tensor         _output_nhwc;
     Tensor         _weights_hwio;
+    Tensor         _input_s16;
+    Tensor         _weights_s16;
+    Tensor         _output_s32;
     const ITensor *_input;
     const ITensor *_weights;
     ITensor       *_output;
     bool           _is_prepared;
     bool           _is_activationlayer_enabled;
+    bool           _is_quantized;
 };
 }
 #endif /* __ARM_COMPUTE_NEWINOGRADCONVOLUTIONLAYER_H__ */
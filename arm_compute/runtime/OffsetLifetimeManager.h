@@ -37,7 +37,12 @@ namespace arm_compute
 class IMemoryPool;
 
 /** Concrete class that tracks the lifetime of registered tensors and
- *  calculates the systems memory requirements in terms of a single blob and a list of offsets */
+ *  calculates the systems memory requirements in terms of a single blob and a list of offsets
+ *
+ * The lifetimes of the tensors are treated as intervals: tensors which are never alive at the same time can share
+ * memory. Offsets are assigned greedily, largest tensors first, each one going to the smallest gap left between the
+ * tensors already placed which are alive at the same time.
+ */
 class OffsetLifetimeManager : public ISimpleLifetimeManager
 {
 public:
@@ -52,9 +57,16 @@ public:
     /** Allow instances of this class to be moved */
     OffsetLifetimeManager &operator=(OffsetLifetimeManager &&) = default;
 
+    /** Returns the requirements of the memory blob backing the pools
+     *
+     * @return The blob's size and alignment
+     */
+    const BlobInfo &info() const;
+
     // Inherited methods overridden:
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
     MappingType mapping_type() const override;
+    size_t      pool_size() const override;
 
 private:
     // Inherited methods overridden:
@@ -29,15 +29,24 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IMemoryPool.h"
 #include "support/Mutex.h"
-#include "support/Semaphore.h"
 
+#include <atomic>
 #include <cstddef>
-#include <list>
+#include <cstdint>
 #include <memory>
+#include <vector>
+
+#ifndef NO_MULTI_THREADING
+#include <condition_variable>
+#endif /* NO_MULTI_THREADING */
 
 namespace arm_compute
 {
-/** Memory pool manager */
+/** Memory pool manager
+ *
+ * Locking and unlocking pools is lock-free: each pool has an occupancy flag which threads claim atomically,
+ * starting with the pool they used last on this manager. Threads only sleep when all the pools are in use.
+ */
 class PoolManager : public IPoolManager
 {
 public:
@@ -61,10 +70,40 @@ public:
     size_t                       num_pools() const override;
 
 private:
-    std::list<std::unique_ptr<IMemoryPool>> _free_pools;     /**< List of free pools */
-    std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
-    std::unique_ptr<arm_compute::Semaphore> _sem;            /**< Semaphore to control the queues */
-    mutable arm_compute::Mutex              _mtx;            /**< Mutex to control access to the queues */
+    /** Claim a free pool without blocking
+     *
+     * @return The claimed pool, nullptr if all the pools are in use
+     */
+    IMemoryPool *try_lock_pool();
+    /** Get the index of the pool the calling thread locked last
+     *
+     * Threads first try to get the same pool again: concurrent threads then settle on different pools and don't compete for them.
+     * The hint is a thread local slot tagged with the identifier of the manager, so reading and updating it never blocks.
+     *
+     * @return Index of the pool to try first
+     */
+    size_t preferred_pool() const;
+    /** Set the index of the pool the calling thread locked last
+     *
+     * @param[in] idx Index of the pool
+     */
+    void set_preferred_pool(size_t idx) const;
+    /** Reset the occupancy flags after the set of pools changed */
+    void reset_occupancy();
+    /** Check if any of the pools is in use
+     *
+     * @return True if at least one pool is locked
+     */
+    bool any_occupied() const;
+
+    std::vector<std::unique_ptr<IMemoryPool>> _pools;       /**< Managed pools */
+    std::unique_ptr<std::atomic<bool>[]>      _occupied;    /**< Occupancy flag of each pool */
+    std::atomic<unsigned int>                 _num_waiters; /**< Number of threads waiting for a pool to be unlocked */
+    mutable arm_compute::Mutex                _mtx;         /**< Mutex protecting the set of pools and the waits */
+    uint64_t                                  _id;          /**< Unique identifier of the manager, tagging the preferred pool of the threads */
+#ifndef NO_MULTI_THREADING
+    std::condition_variable_any _cv; /**< Condition variable signalled when a pool is unlocked */
+#endif /* NO_MULTI_THREADING */
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_POOLMANAGER_H__ */
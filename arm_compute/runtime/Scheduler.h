@@ -36,10 +36,11 @@ public:
     /** Scheduler type */
     enum class Type
     {
-        ST,    /**< Single thread. */
-        CPP,   /**< C++11 threads. */
-        OMP,   /**< OpenMP. */
-        CUSTOM /**< Provided by the user. */
+        ST,                /**< Single thread. */
+        CPP,               /**< C++11 threads. */
+        CPP_WORK_STEALING, /**< C++11 persistent threads with work stealing. */
+        OMP,               /**< OpenMP. */
+        CUSTOM             /**< Provided by the user. */
     };
     /** Sets the user defined scheduler and makes it the active scheduler.
      *
@@ -47,6 +48,8 @@ public:
      */
     static void set(std::shared_ptr<IScheduler> scheduler);
     /** Access the scheduler singleton.
+     *
+     * @note Returns the scheduler set with @ref set_thread_scheduler if the calling thread has one.
      *
      * @return A reference to the scheduler object.
      */
@@ -70,6 +73,13 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Overrides the active scheduler for the calling thread only.
+     *
+     * This allows several functions to run at the same time from different threads, each of them on its own pool of threads.
+     *
+     * @param[in] scheduler Scheduler to use in the calling thread, or nullptr to go back to the active scheduler. Ownership is not transferred.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
 
 private:
     static Type                        _scheduler_type;
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_SCHEDULER_UTILS_H__
+#define __ARM_COMPUTE_SCHEDULER_UTILS_H__
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace scheduler_utils
+{
+/** Return the number of iterations available to split a kernel's execution window
+ *
+ * @param[in] window Execution window of the kernel.
+ * @param[in] hints  Hints for the scheduler.
+ *
+ * @return Number of iterations along the split dimension, multiplied by the ones along the secondary split dimension for 2D splits.
+ */
+unsigned int num_iterations(const Window &window, const IScheduler::Hints &hints);
+/** Work out the grid of tiles a kernel's execution window is split into
+ *
+ * For 1D splits the grid is simply max_tiles x 1. For 2D splits, the grid minimising the time taken by the slowest
+ * thread is picked, taking into account that the last tile along a dimension absorbs the leftover iterations.
+ *
+ * @param[in] window      Execution window of the kernel.
+ * @param[in] hints       Hints for the scheduler.
+ * @param[in] max_tiles   Maximum number of tiles to create. Must be greater than 0 and not greater than @ref num_iterations.
+ * @param[in] num_threads Number of threads which will process the tiles.
+ *
+ * @return Number of tiles along the split dimension and along the secondary split dimension.
+ */
+std::pair<unsigned int, unsigned int> split_grid(const Window &window, const IScheduler::Hints &hints, unsigned int max_tiles, unsigned int num_threads);
+/** Return one of the tiles of a kernel's execution window
+ *
+ * @param[in] window Execution window of the kernel.
+ * @param[in] hints  Hints for the scheduler.
+ * @param[in] id     Index of the tile, tiles are numbered along the split dimension first.
+ * @param[in] grid   Grid returned by @ref split_grid.
+ *
+ * @return The sub-window to process.
+ */
+Window split_window(const Window &window, const IScheduler::Hints &hints, unsigned int id, const std::pair<unsigned int, unsigned int> &grid);
+/** Return one of the chunks of a kernel's execution window split along the split dimension in proportion to some weights
+ *
+ * Used to give threads running on cores of different capacities a share of the work matching their speed.
+ *
+ * @param[in] window  Execution window of the kernel.
+ * @param[in] hints   Hints for the scheduler.
+ * @param[in] id      Index of the chunk.
+ * @param[in] weights Weight of each chunk. Must not have more elements than there are iterations along the split dimension.
+ *
+ * @return The sub-window to process, which contains at least one iteration.
+ */
+Window split_window_weighted(const Window &window, const IScheduler::Hints &hints, unsigned int id, const std::vector<unsigned int> &weights);
+} // namespace scheduler_utils
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_SCHEDULER_UTILS_H__ */
@@ -100,6 +100,15 @@ public:
      * @return error status
      */
     arm_compute::Status import_memory(void *memory, size_t size);
+    /** Import an existing memory as a tensor's backing memory
+     *
+     * @note The ownership of the memory is shared with the other objects it was copied from
+     *
+     * @param[in] memory Memory to import. Its region must be at least as large as the tensor
+     *
+     * @return error status
+     */
+    arm_compute::Status import_memory(Memory memory);
     /** Associates the tensor with a memory group
      *
      * @param[in] associated_memory_group Memory group to associate the tensor with
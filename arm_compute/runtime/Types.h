@@ -37,6 +37,14 @@ enum class MappingType
     OFFSETS /**< Mappings are in offset granularity in the same blob */
 };
 
+/** Policies to allocate the backing memory of host memory regions */
+enum class HostMemoryPolicy
+{
+    ZERO_INITIALIZED, /**< Zero-filled memory from the free store (Default) */
+    UNINITIALIZED,    /**< Uninitialised memory from the free store: pages are only touched when first written */
+    HUGE_PAGES        /**< Uninitialised memory mapped on huge pages when large enough and supported by the system, to reduce TLB misses */
+};
+
 /** A map of (handle, index/offset), where handle is the memory handle of the object
  * to provide the memory for and index/offset is the buffer/offset from the pool that should be used
  *
@@ -47,6 +55,13 @@ using MemoryMappings = std::map<IMemory *, size_t>;
 /** A map of the groups and memory mappings */
 using GroupMappings = std::map<size_t, MemoryMappings>;
 
+/** Amounts of memory, in bytes */
+struct MemoryUsage
+{
+    size_t resident{ 0 }; /**< Memory currently held */
+    size_t peak{ 0 };     /**< Highest amount of memory held at the same time */
+};
+
 /** Meta-data information for each blob */
 struct BlobInfo
 {
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_WEIGHTSCACHE_H__
+#define __ARM_COMPUTE_WEIGHTSCACHE_H__
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensorInfo;
+class Tensor;
+
+/** Shares immutable weights, and the buffers functions prepare from them, between several instances of the same network
+ *
+ * The weights are identified by the key of the scope which acquires them, by the order they are acquired in within that scope,
+ * and by their shape and data type, so every instance must acquire the same weights in the same order, which is the case for the functions of identical networks.
+ * Weights of a different shape or data type acquired under the same key and index are not shared.
+ *
+ * The first instance which acquires some weights allocates them and fills them before the end of its scope,
+ * the other ones wait for them to be ready and then share the same memory.
+ */
+class WeightsCache final
+{
+public:
+    /** Makes a cache the active one of the calling thread until the end of the scope
+     *
+     * The weights acquired in the scope are shared with the other instances when the scope ends,
+     * unless the tensor they were acquired for has been marked as unused by then: they are dropped from the cache in that case.
+     */
+    class Scope final
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] cache Cache to activate. Can be nullptr to stop sharing the weights.
+         * @param[in] key   Key identifying the weights acquired in the scope (e.g. the node which prepares them)
+         */
+        Scope(WeightsCache *cache, std::string key);
+        /** Shares the weights acquired in the scope and restores the cache which was active before */
+        ~Scope();
+        /** Prevent instances of this class from being copied */
+        Scope(const Scope &) = delete;
+        /** Prevent instances of this class from being copied */
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        friend class WeightsCache;
+
+        WeightsCache                                 *_cache;
+        std::string                                   _key;
+        unsigned int                                  _next_index;
+        std::vector<std::pair<unsigned int, Tensor *>> _acquired;
+        Scope                                        *_previous;
+    };
+
+    /** Default constructor */
+    WeightsCache();
+    /** Prevent instances of this class from being copied */
+    WeightsCache(const WeightsCache &) = delete;
+    /** Prevent instances of this class from being copied */
+    WeightsCache &operator=(const WeightsCache &) = delete;
+    /** Backs a tensor with the next weights of the scope active on the calling thread
+     *
+     * If no scope is active the tensor is simply allocated.
+     *
+     * @param[in, out] tensor Tensor to allocate. Its info must be initialised.
+     *
+     * @return True if the tensor already holds the weights, false if they have to be written by the caller
+     *
+     * @throw std::runtime_error if the shared weights are smaller than the tensor, or can't be imported in it
+     */
+    static bool acquire(Tensor &tensor);
+    /** Drops the weights acquired under a key from the cache
+     *
+     * The memory is freed once no tensor uses it any more. An instance which acquires the weights afterwards has to fill them again.
+     *
+     * @param[in] key Key of the scope the weights were acquired in
+     */
+    void release(const std::string &key);
+    /** Returns the amount of memory held by the cache
+     *
+     * @return Size in bytes of the weights in the cache
+     */
+    size_t size() const;
+
+private:
+    /** Key of the scope, index of the weights in the scope, dimensions and data type of the weights */
+    using Key = std::tuple<std::string, unsigned int, std::vector<size_t>, DataType>;
+    struct Entry
+    {
+        std::shared_ptr<IMemoryRegion> region{ nullptr }; /**< Backing memory of the weights */
+        bool                           ready{ false };    /**< True once the weights have been written */
+    };
+
+    /** Creates the key identifying some weights
+     *
+     * @param[in] scope_key Key of the scope acquiring the weights
+     * @param[in] index     Index of the weights in the scope
+     * @param[in] info      Info of the tensor holding the weights
+     *
+     * @return The key
+     */
+    static Key make_key(const std::string &scope_key, unsigned int index, const ITensorInfo &info);
+    void publish(Scope &scope);
+
+    mutable std::mutex      _mtx;
+    std::condition_variable _cv;
+    std::map<Key, Entry>    _entries;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_WEIGHTSCACHE_H__ */
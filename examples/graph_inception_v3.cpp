@@ -198,9 +198,11 @@ public:
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_file  = common_params.tuner_file;
+        config.num_threads        = common_params.threads;
+        config.use_tuner          = common_params.enable_tuner;
+        config.tuner_file         = common_params.tuner_file;
+        config.execution_strategy = common_params.execution_strategy;
+        config.pipeline_stages    = common_params.pipeline_stages;
 
         graph.finalize(common_params.target, config);
 
@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBinarizeInputKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/detail/NEBinarySignDetail.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+TensorShape compute_padded_input_shape(const ITensorInfo &input, const PadStrideInfo &conv_info)
+{
+    const unsigned int idx_w = get_data_layout_dimension_index(input.data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int idx_h = get_data_layout_dimension_index(input.data_layout(), DataLayoutDimension::HEIGHT);
+
+    TensorShape padded_shape = input.tensor_shape();
+    padded_shape.set(idx_w, input.dimension(idx_w) + conv_info.pad_left() + conv_info.pad_right());
+    padded_shape.set(idx_h, input.dimension(idx_h) + conv_info.pad_top() + conv_info.pad_bottom());
+
+    return padded_shape;
+}
+
+TensorShape compute_K_shape(const ITensorInfo &input, const Size2D &kernel_sz, const PadStrideInfo &conv_info)
+{
+    const unsigned int idx_w = get_data_layout_dimension_index(input.data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int idx_h = get_data_layout_dimension_index(input.data_layout(), DataLayoutDimension::HEIGHT);
+    const unsigned int idx_c = get_data_layout_dimension_index(input.data_layout(), DataLayoutDimension::CHANNEL);
+    const auto         dims  = scaled_dimensions(input.dimension(idx_w), input.dimension(idx_h), kernel_sz.width, kernel_sz.height, conv_info);
+
+    TensorShape K_shape = input.tensor_shape();
+    K_shape.set(idx_w, dims.first);
+    K_shape.set(idx_h, dims.second);
+    K_shape.set(idx_c, 1);
+
+    return K_shape;
+}
+
+TensorShape compute_output_shape(const ITensorInfo &input, const ITensorInfo *input_beta, const PadStrideInfo &conv_info)
+{
+    const DataLayout data_layout = input.data_layout();
+
+    if(input_beta == nullptr)
+    {
+        return compute_binary_sign_shape(compute_padded_input_shape(input, conv_info), data_layout);
+    }
+
+    // The input is already binarized: only its spatial dimensions are padded
+    TensorShape output_shape = compute_padded_input_shape(*input_beta, conv_info);
+    if(data_layout == DataLayout::NHWC)
+    {
+        output_shape.set(0, input.dimension(0));
+    }
+    else
+    {
+        output_shape.set(2, input.dimension(2));
+        output_shape = compute_binary_sign_shape(output_shape, data_layout);
+    }
+
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *K, const ITensorInfo *tmp, const Size2D &kernel_sz,
+                          const PadStrideInfo &conv_info, const ITensorInfo *input_beta)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output, K, tmp);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NCHW, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(tmp, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_sz.width == 0 || kernel_sz.height == 0);
+
+    const DataLayout data_layout = input->data_layout();
+
+    if(input_beta != nullptr)
+    {
+        const unsigned int idx_c = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_beta, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, input_beta);
+        ARM_COMPUTE_RETURN_ERROR_ON(input_beta->dimension(idx_c) != 1);
+
+        TensorShape packed_shape = input_beta->tensor_shape();
+        packed_shape.set(idx_c, (data_layout == DataLayout::NHWC) ? input->dimension(idx_c) * 8 : input->dimension(idx_c));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input->tensor_shape(), compute_binary_sign_shape(packed_shape, data_layout));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    }
+
+    const TensorShape  padded_shape = compute_padded_input_shape((input_beta != nullptr) ? *input_beta : *input, conv_info);
+    const unsigned int padded_width = padded_shape[get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)];
+
+    ARM_COMPUTE_RETURN_ERROR_ON(padded_width < kernel_sz.width);
+    ARM_COMPUTE_RETURN_ERROR_ON(padded_shape[get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)] < kernel_sz.height);
+    ARM_COMPUTE_RETURN_ERROR_ON(tmp->dimension(0) < padded_width * (kernel_sz.height + 1));
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(*input, input_beta, conv_info));
+    }
+
+    // Checks performed when K is configured
+    if(K->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(K, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, K);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(K->tensor_shape(), compute_K_shape((input_beta != nullptr) ? *input_beta : *input, kernel_sz, conv_info));
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(const ITensorInfo *input, ITensorInfo *output, ITensorInfo *K, const Size2D &kernel_sz, const PadStrideInfo &conv_info,
+                                                        const ITensorInfo *input_beta)
+{
+    const ITensorInfo *spatial_info = (input_beta != nullptr) ? input_beta : input;
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_output_shape(*input, input_beta, conv_info)).set_data_type(DataType::U8));
+    auto_init_if_empty(*K, spatial_info->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_K_shape(*spatial_info, kernel_sz, conv_info)));
+
+    // Each iteration computes a row of K and binarizes the padded rows it needs, no padding is required
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, K->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT)), 1));
+    win.set(Window::DimZ, Window::Dimension(0, input->tensor_shape().total_size_upper(3), 1));
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+    coord.set_num_dimensions(K->num_dimensions());
+    K->set_valid_region(ValidRegion(coord, K->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+
+/** Sum the absolute values of a contiguous run of values
+ *
+ * @param[in] in       Pointer to the values.
+ * @param[in] num_vals Number of values.
+ *
+ * @return The sum of the absolute values
+ */
+inline float abs_sum(const float *in, unsigned int num_vals)
+{
+    float32x4_t  acc = vdupq_n_f32(0.f);
+    unsigned int i   = 0;
+    for(; i + 4 <= num_vals; i += 4)
+    {
+        acc = vaddq_f32(acc, vabsq_f32(vld1q_f32(in + i)));
+    }
+
+    float sum = detail::reduce_add(acc);
+    for(; i < num_vals; ++i)
+    {
+        sum += std::abs(in[i]);
+    }
+
+    return sum;
+}
+} // namespace
+
+NEBinarizeInputKernel::NEBinarizeInputKernel()
+    : _func(nullptr), _input(nullptr), _input_beta(nullptr), _output(nullptr), _K(nullptr), _tmp(nullptr), _kernel_sz(), _conv_info()
+{
+}
+
+void NEBinarizeInputKernel::configure(const ITensor *input, ITensor *output, ITensor *K, ITensor *tmp, const Size2D &kernel_sz, const PadStrideInfo &conv_info,
+                                      const ITensor *input_beta)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, K, tmp);
+    const ITensorInfo *input_beta_info = (input_beta != nullptr) ? input_beta->info() : nullptr;
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), K->info(), tmp->info(), kernel_sz, conv_info, input_beta_info));
+
+    const bool is_nhwc = input->info()->data_layout() == DataLayout::NHWC;
+
+    _input      = input;
+    _input_beta = input_beta;
+    _output     = output;
+    _K          = K;
+    _tmp        = tmp;
+    _kernel_sz  = kernel_sz;
+    _conv_info  = conv_info;
+
+    if(input_beta != nullptr)
+    {
+        _func = is_nhwc ? &NEBinarizeInputKernel::copy_row_nhwc : &NEBinarizeInputKernel::copy_row_nchw;
+    }
+    else
+    {
+        _func = is_nhwc ? &NEBinarizeInputKernel::binarize_row_nhwc : &NEBinarizeInputKernel::binarize_row_nchw;
+    }
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), K->info(), kernel_sz, conv_info, input_beta_info);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEBinarizeInputKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *K, const ITensorInfo *tmp, const Size2D &kernel_sz,
+                                       const PadStrideInfo &conv_info, const ITensorInfo *input_beta)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, K, tmp, kernel_sz, conv_info, input_beta));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input, output->clone().get(), K->clone().get(), kernel_sz, conv_info, input_beta).first);
+    return Status{};
+}
+
+void NEBinarizeInputKernel::binarize_row_nchw(int row, int batch, float *beta_row, bool write_bits)
+{
+    const int          width         = _input->info()->dimension(0);
+    const int          height        = _input->info()->dimension(1);
+    const unsigned int num_channels  = _input->info()->dimension(2);
+    const int          pad_left      = _conv_info.pad_left();
+    const unsigned int padded_width  = width + pad_left + _conv_info.pad_right();
+    const unsigned int num_bytes     = _output->info()->dimension(0);
+    const int          in_row        = row - static_cast<int>(_conv_info.pad_top());
+    const Strides     &in_strides    = _input->info()->strides_in_bytes();
+    const Strides     &out_strides   = _output->info()->strides_in_bytes();
+    const uint8_t     *in_base       = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t           *out_base      = _output->buffer() + _output->info()->offset_first_element_in_bytes() + row * out_strides.y() + batch * out_strides[3];
+    const bool         is_padded_row = in_row < 0 || in_row >= height;
+
+    std::fill_n(beta_row, padded_width, 0.f);
+
+    for(unsigned int c = 0; c < num_channels; ++c)
+    {
+        uint8_t *out_ptr = out_base + c * out_strides.z();
+
+        if(is_padded_row)
+        {
+            if(write_bits)
+            {
+                std::memset(out_ptr, 0, num_bytes);
+            }
+            continue;
+        }
+
+        const auto in_ptr = reinterpret_cast<const float *>(in_base + in_row * in_strides.y() + c * in_strides.z() + batch * in_strides[3]);
+
+        for(unsigned int b = 0; b < num_bytes; ++b)
+        {
+            const int x_start = b * 8 - pad_left;
+
+            if(x_start >= 0 && x_start + 8 <= width)
+            {
+                const float32x4_t vals0 = vld1q_f32(in_ptr + x_start);
+                const float32x4_t vals1 = vld1q_f32(in_ptr + x_start + 4);
+
+                if(write_bits)
+                {
+                    out_ptr[b] = detail::pack_signs(vals0, vals1);
+                }
+                vst1q_f32(beta_row + b * 8, vaddq_f32(vld1q_f32(beta_row + b * 8), vabsq_f32(vals0)));
+                vst1q_f32(beta_row + b * 8 + 4, vaddq_f32(vld1q_f32(beta_row + b * 8 + 4), vabsq_f32(vals1)));
+            }
+            else
+            {
+                // Byte overlapping the padding: the padded values are 0, hence their bits are 0 too
+                uint8_t dst_val = 0;
+                for(int i = 0; i < 8; ++i)
+                {
+                    const int x = x_start + i;
+                    if(x >= 0 && x < width)
+                    {
+                        dst_val |= static_cast<uint8_t>(in_ptr[x] > 0.f) << (7 - i);
+                        beta_row[b * 8 + i] += std::abs(in_ptr[x]);
+                    }
+                }
+                if(write_bits)
+                {
+                    out_ptr[b] = dst_val;
+                }
+            }
+        }
+    }
+
+    for(unsigned int p = 0; p < padded_width; ++p)
+    {
+        beta_row[p] /= num_channels;
+    }
+}
+
+void NEBinarizeInputKernel::binarize_row_nhwc(int row, int batch, float *beta_row, bool write_bits)
+{
+    const unsigned int num_channels = _input->info()->dimension(0);
+    const int          width        = _input->info()->dimension(1);
+    const int          height       = _input->info()->dimension(2);
+    const int          pad_left     = _conv_info.pad_left();
+    const unsigned int padded_width = width + pad_left + _conv_info.pad_right();
+    const unsigned int num_bytes    = _output->info()->dimension(0);
+    const int          in_row       = row - static_cast<int>(_conv_info.pad_top());
+    const Strides     &in_strides   = _input->info()->strides_in_bytes();
+    const Strides     &out_strides  = _output->info()->strides_in_bytes();
+    const uint8_t     *in_base      = _input->buffer() + _input->info()->offset_first_element_in_bytes() + in_row * in_strides.z() + batch * in_strides[3];
+    uint8_t           *out_base     = _output->buffer() + _output->info()->offset_first_element_in_bytes() + row * out_strides.z() + batch * out_strides[3];
+
+    for(unsigned int p = 0; p < padded_width; ++p)
+    {
+        const int x       = static_cast<int>(p) - pad_left;
+        uint8_t  *out_ptr = out_base + p * out_strides.y();
+
+        if(in_row < 0 || in_row >= height || x < 0 || x >= width)
+        {
+            // The padded values are 0, hence their bits are 0 too
+            if(write_bits)
+            {
+                std::memset(out_ptr, 0, num_bytes);
+            }
+            beta_row[p] = 0.f;
+            continue;
+        }
+
+        const auto  in_ptr = reinterpret_cast<const float *>(in_base + x * in_strides.y());
+        const float sum    = write_bits ? detail::pack_signs_row(in_ptr, out_ptr, num_channels, num_bytes) : abs_sum(in_ptr, num_channels);
+
+        beta_row[p] = sum / num_channels;
+    }
+}
+
+void NEBinarizeInputKernel::copy_row_nchw(int row, int batch, float *beta_row, bool write_bits)
+{
+    const int          width         = _input_beta->info()->dimension(0);
+    const int          height        = _input_beta->info()->dimension(1);
+    const unsigned int num_channels  = _input->info()->dimension(2);
+    const int          num_in_bytes  = _input->info()->dimension(0);
+    const int          pad_left      = _conv_info.pad_left();
+    const unsigned int padded_width  = width + pad_left + _conv_info.pad_right();
+    const unsigned int num_bytes     = _output->info()->dimension(0);
+    const int          in_row        = row - static_cast<int>(_conv_info.pad_top());
+    const Strides     &in_strides    = _input->info()->strides_in_bytes();
+    const Strides     &out_strides   = _output->info()->strides_in_bytes();
+    const bool         is_padded_row = in_row < 0 || in_row >= height;
+
+    std::fill_n(beta_row, padded_width, 0.f);
+
+    if(!is_padded_row)
+    {
+        const Strides &beta_strides = _input_beta->info()->strides_in_bytes();
+        const auto     in_beta_ptr  = reinterpret_cast<const float *>(_input_beta->buffer() + _input_beta->info()->offset_first_element_in_bytes() + in_row * beta_strides.y()
+                                                                      + batch * beta_strides[3]);
+        std::copy_n(in_beta_ptr, width, beta_row + pad_left);
+    }
+
+    if(!write_bits)
+    {
+        return;
+    }
+
+    const uint8_t *in_base  = _input->buffer() + _input->info()->offset_first_element_in_bytes() + in_row * in_strides.y() + batch * in_strides[3];
+    uint8_t       *out_base = _output->buffer() + _output->info()->offset_first_element_in_bytes() + row * out_strides.y() + batch * out_strides[3];
+
+    for(unsigned int c = 0; c < num_channels; ++c)
+    {
+        uint8_t *out_ptr = out_base + c * out_strides.z();
+
+        if(is_padded_row)
+        {
+            std::memset(out_ptr, 0, num_bytes);
+            continue;
+        }
+
+        const uint8_t *in_ptr = in_base + c * in_strides.z();
+
+        // Each output byte is made of the bits of at most two input bytes, shifted by the left padding
+        for(unsigned int b = 0; b < num_bytes; ++b)
+        {
+            const int x_start  = static_cast<int>(b * 8) - pad_left;
+            const int in_byte  = (x_start >= 0) ? x_start / 8 : -((7 - x_start) / 8);
+            const int shift    = x_start - in_byte * 8;
+            const int hi       = (in_byte >= 0 && in_byte < num_in_bytes) ? in_ptr[in_byte] : 0;
+            const int lo       = (in_byte + 1 >= 0 && in_byte + 1 < num_in_bytes) ? in_ptr[in_byte + 1] : 0;
+            const int num_vals = std::min(std::max(width - x_start, 0), 8);
+
+            out_ptr[b] = static_cast<uint8_t>((((hi << 8) | lo) << shift) >> 8) & static_cast<uint8_t>(0xFF00 >> num_vals);
+        }
+    }
+}
+
+void NEBinarizeInputKernel::copy_row_nhwc(int row, int batch, float *beta_row, bool write_bits)
+{
+    const int          width        = _input_beta->info()->dimension(1);
+    const int          height       = _input_beta->info()->dimension(2);
+    const int          pad_left     = _conv_info.pad_left();
+    const unsigned int padded_width = width + pad_left + _conv_info.pad_right();
+    const unsigned int num_bytes    = _output->info()->dimension(0);
+    const int          in_row       = row - static_cast<int>(_conv_info.pad_top());
+    const Strides     &in_strides   = _input->info()->strides_in_bytes();
+    const Strides     &beta_strides = _input_beta->info()->strides_in_bytes();
+    const Strides     &out_strides  = _output->info()->strides_in_bytes();
+    const uint8_t     *in_base      = _input->buffer() + _input->info()->offset_first_element_in_bytes() + in_row * in_strides.z() + batch * in_strides[3];
+    const uint8_t     *beta_base    = _input_beta->buffer() + _input_beta->info()->offset_first_element_in_bytes() + in_row * beta_strides.z() + batch * beta_strides[3];
+    uint8_t           *out_base     = _output->buffer() + _output->info()->offset_first_element_in_bytes() + row * out_strides.z() + batch * out_strides[3];
+
+    for(unsigned int p = 0; p < padded_width; ++p)
+    {
+        const int x       = static_cast<int>(p) - pad_left;
+        uint8_t  *out_ptr = out_base + p * out_strides.y();
+
+        if(in_row < 0 || in_row >= height || x < 0 || x >= width)
+        {
+            if(write_bits)
+            {
+                std::memset(out_ptr, 0, num_bytes);
+            }
+            beta_row[p] = 0.f;
+            continue;
+        }
+
+        if(write_bits)
+        {
+            std::memcpy(out_ptr, in_base + x * in_strides.y(), num_bytes);
+        }
+        beta_row[p] = *reinterpret_cast<const float *>(beta_base + x * beta_strides.y());
+    }
+}
+
+void NEBinarizeInputKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(static_cast<size_t>(info.thread_id) >= _tmp->info()->tensor_shape().total_size_upper(1));
+
+    const DataLayout   data_layout  = _input->info()->data_layout();
+    const unsigned int idx_w        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int kernel_w     = _kernel_sz.width;
+    const int          kernel_h     = _kernel_sz.height;
+    const unsigned int stride_x     = _conv_info.stride().first;
+    const int          stride_y     = _conv_info.stride().second;
+    const ITensorInfo *spatial_info = (_input_beta != nullptr) ? _input_beta->info() : _input->info();
+    const unsigned int padded_width = spatial_info->dimension(idx_w) + _conv_info.pad_left() + _conv_info.pad_right();
+    const unsigned int out_width    = _K->info()->dimension(idx_w);
+    const float        scale        = 1.f / _kernel_sz.area();
+    const Strides     &K_strides    = _K->info()->strides_in_bytes();
+    uint8_t           *K_base       = _K->buffer() + _K->info()->offset_first_element_in_bytes();
+
+    // The beta values of the last kernel_h padded rows are kept in a ring buffer, followed by their sum over the kernel height
+    const auto beta_rows = reinterpret_cast<float *>(_tmp->buffer() + _tmp->info()->offset_first_element_in_bytes() + info.thread_id * _tmp->info()->strides_in_bytes().y());
+    const auto col_sums  = beta_rows + kernel_h * padded_width;
+
+    const int row_start = window.y().start();
+
+    for(int batch = window.z().start(); batch < window.z().end(); batch += window.z().step())
+    {
+        int next_row = row_start * stride_y;
+
+        for(int y = row_start; y < window.y().end(); y += window.y().step())
+        {
+            const int first_row = y * stride_y;
+
+            // Binarize the rows which are not in the ring buffer yet. The bits of a row are only written by the thread computing
+            // the first row of K which needs it, the other threads only compute its beta values
+            for(int row = std::max(next_row, first_row); row < first_row + kernel_h; ++row)
+            {
+                const int  first_user = std::max(row - kernel_h + stride_y, 0) / stride_y;
+                const bool write_bits = first_user >= row_start;
+
+                (this->*_func)(row, batch, beta_rows + (row % kernel_h) * padded_width, write_bits);
+            }
+            next_row = first_row + kernel_h;
+
+            // Average the beta values over each kernel window
+            std::fill_n(col_sums, padded_width, 0.f);
+            for(int ky = 0; ky < kernel_h; ++ky)
+            {
+                const float *beta_row = beta_rows + ((first_row + ky) % kernel_h) * padded_width;
+                for(unsigned int p = 0; p < padded_width; ++p)
+                {
+                    col_sums[p] += beta_row[p];
+                }
+            }
+
+            for(unsigned int x = 0; x < out_width; ++x)
+            {
+                float sum = 0.f;
+                for(unsigned int kx = 0; kx < kernel_w; ++kx)
+                {
+                    sum += col_sums[x * stride_x + kx];
+                }
+
+                *reinterpret_cast<float *>(K_base + x * K_strides[idx_w] + y * K_strides[idx_h] + batch * K_strides[3]) = sum * scale;
+            }
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBinaryAlphaKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *partial_sums, const ITensorInfo *alpha, unsigned int num_elems)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(partial_sums, alpha);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(partial_sums, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_elems == 0);
+
+    // Checks performed when alpha is configured
+    if(alpha->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(partial_sums, alpha);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(alpha->tensor_shape(), TensorShape(partial_sums->tensor_shape().total_size_upper(3)));
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *partial_sums, ITensorInfo *alpha)
+{
+    // Alpha auto inizialitation if not yet initialized
+    auto_init_if_empty(*alpha, partial_sums->clone()->set_tensor_shape(TensorShape(partial_sums->tensor_shape().total_size_upper(3))));
+
+    // Each iteration reduces a whole block, no padding is needed
+    Window win = calculate_max_window(*alpha, Steps());
+
+    Coordinates coord;
+    coord.set_num_dimensions(alpha->num_dimensions());
+    alpha->set_valid_region(ValidRegion(coord, alpha->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEBinaryAlphaKernel::NEBinaryAlphaKernel()
+    : _partial_sums(nullptr), _alpha(nullptr), _num_elems(0)
+{
+}
+
+void NEBinaryAlphaKernel::configure(const ITensor *partial_sums, ITensor *alpha, unsigned int num_elems)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(partial_sums, alpha);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(partial_sums->info(), alpha->info(), num_elems));
+
+    _partial_sums = partial_sums;
+    _alpha        = alpha;
+    _num_elems    = num_elems;
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(partial_sums->info(), alpha->info());
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+
+    INEKernel::configure(win_config.second);
+}
+
+Status NEBinaryAlphaKernel::validate(const ITensorInfo *partial_sums, const ITensorInfo *alpha, unsigned int num_elems)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(partial_sums, alpha, num_elems));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(partial_sums->clone().get(), alpha->clone().get()).first);
+
+    return Status{};
+}
+
+void NEBinaryAlphaKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const TensorShape &shape        = _partial_sums->info()->tensor_shape();
+    const Strides     &strides      = _partial_sums->info()->strides_in_bytes();
+    const uint8_t     *partials_ptr = _partial_sums->buffer() + _partial_sums->info()->offset_first_element_in_bytes();
+    const size_t       block_stride = (_partial_sums->info()->num_dimensions() > 3) ? strides[3] : 0;
+
+    Iterator alpha(_alpha, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *block_ptr = partials_ptr + id.x() * block_stride;
+        float          sum       = 0.f;
+
+        // The partial sums are always added up in the same order, whatever the number of threads
+        for(size_t z = 0; z < shape.z(); ++z)
+        {
+            for(size_t y = 0; y < shape.y(); ++y)
+            {
+                const uint8_t *row_ptr = block_ptr + y * strides.y() + z * strides.z();
+                for(size_t x = 0; x < shape.x(); ++x)
+                {
+                    sum += *reinterpret_cast<const float *>(row_ptr + x * strides.x());
+                }
+            }
+        }
+
+        *reinterpret_cast<float *>(alpha.ptr()) = sum / _num_elems;
+    },
+    alpha);
+}
@@ -25,233 +25,567 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/detail/NEBinaryOutputStageDetail.h"
+#include "arm_compute/core/NEON/kernels/detail/NEBinaryPopcountDetail.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 
-#include <arm_neon.h>
-#include <bitset>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
 
 using namespace arm_compute;
 using namespace arm_compute::misc::shape_calculator;
 
 namespace
 {
+constexpr unsigned int max_kernel_width       = 57;   /**< Maximum number of bits which can be extracted from a packed row with a single 64-bit load */
+constexpr unsigned int num_pixels_per_block   = 4;    /**< Number of consecutive output pixels sharing each weights load */
+constexpr unsigned int num_pixels_per_byte    = 8;    /**< Number of output pixels processed by each NCHW iteration, whose signs fill a packed byte */
+constexpr unsigned int max_patch_bytes_per_px = 1024; /**< Size of the per-pixel buffer used to gather the input patches */
+
+/** Compute the shape of the non-binarized output
+ *
+ * @param[in] output      Destination tensor info.
+ * @param[in] weights     Binarized weights tensor info.
+ * @param[in] output_beta Beta tensor info of the binarized output. Only used if @p output is U8.
+ *
+ * @return the calculated shape
+ */
+TensorShape compute_unpacked_output_shape(const ITensorInfo &output, const ITensorInfo &weights, const ITensorInfo *output_beta)
+{
+    if(output.data_type() != DataType::U8)
+    {
+        return output.tensor_shape();
+    }
+
+    TensorShape output_shape = output_beta->tensor_shape();
+    output_shape.set(get_data_layout_dimension_index(output.data_layout(), DataLayoutDimension::CHANNEL), weights.dimension(3));
+
+    return output_shape;
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
-                          const PadStrideInfo &conv_info, const ITensorInfo *alpha, const ITensorInfo *beta, const Size2D &kernel_sz)
+                          const PadStrideInfo &conv_info, const ITensorInfo *alpha, const ITensorInfo *beta, const Size2D &kernel_sz, unsigned int num_channels,
+                          const ActivationLayerInfo &act_info, const ITensorInfo *output_beta)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output, alpha, beta);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(alpha, 1, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(beta, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.has_padding(), "Padding must be applied to the input before binarization");
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_sz.width == 0 || kernel_sz.height == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!weights->padding().empty(), "The binarized weights of each OFM must be contiguous in memory");
+    ARM_COMPUTE_RETURN_ON_ERROR(detail::validate_binary_output_stage_activation(act_info));
+
+    const bool is_output_binarized = output->data_type() == DataType::U8;
+    if(is_output_binarized)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output_beta);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_beta, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(output, output_beta);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_beta->tensor_shape(), beta->tensor_shape());
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                           compute_binary_sign_shape(compute_unpacked_output_shape(*output, *weights, output_beta), output->data_layout()));
+    }
+
+    // Shape of the results, before their binarization
+    const TensorShape output_shape = compute_unpacked_output_shape(*output, *weights, output_beta);
+
+    const DataLayout   data_layout = input->data_layout();
+    const unsigned int idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const unsigned int stride_x    = conv_info.stride().first;
+    const unsigned int stride_y    = conv_info.stride().second;
+
+    if(data_layout == DataLayout::NHWC)
+    {
+        // Every kernel row must be a contiguous bit string
+        ARM_COMPUTE_RETURN_ERROR_ON(num_channels == 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != compute_binary_sign_shape(TensorShape(num_channels), DataLayout::NHWC)[0]);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->strides_in_bytes()[idx_w] != input->dimension(0) * input->element_size());
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(idx_w) < (output_shape[idx_w] - 1) * stride_x + kernel_sz.width);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_w) != kernel_sz.width);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(kernel_sz.width > max_kernel_width, "Kernel width not supported");
+        // The packed input must contain every bit accessed by the last kernel window
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(idx_w) * 8 < (output_shape[idx_w] - 1) * stride_x + kernel_sz.width);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_w) != compute_binary_sign_shape(TensorShape(kernel_sz.width))[0]);
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_h) != kernel_sz.height);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_c) != input->dimension(idx_c));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(3) != output_shape[idx_c]);
+    ARM_COMPUTE_RETURN_ERROR_ON(alpha->dimension(0) != weights->dimension(3));
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(idx_h) < (output_shape[idx_h] - 1) * stride_y + kernel_sz.height);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(3) != output_shape[3]);
+
+    TensorShape beta_shape = output_shape;
+    beta_shape.set(idx_c, 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(beta->tensor_shape(), beta_shape);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+    }
 
     return Status{};
 }
 
-std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *weights, ITensorInfo *biases, ITensorInfo *output,
-                          const PadStrideInfo &conv_info, ITensorInfo *alpha, ITensorInfo *beta, const Size2D &kernel_sz)
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *output, const ITensorInfo *weights, ITensorInfo *output_beta)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output, alpha, beta);
+    const bool        is_output_binarized = output->data_type() == DataType::U8;
+    const TensorShape output_shape        = compute_unpacked_output_shape(*output, *weights, output_beta);
+
+    // Each iteration computes a block of consecutive pixels along the width for all the OFMs.
+    // With NCHW a block covers a whole byte of the binarized output, so that no two threads write the same byte.
+    // Partial blocks are handled inside the kernel, so no padding is needed
+    Window win;
+    if(output->data_layout() == DataLayout::NHWC)
+    {
+        win = calculate_max_window(ValidRegion(Coordinates(), output_shape), Steps(1U, num_pixels_per_block));
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    }
+    else
+    {
+        win = calculate_max_window(ValidRegion(Coordinates(), output_shape), Steps(num_pixels_per_byte));
+        win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+    }
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+
+    if(is_output_binarized)
+    {
+        coord.set_num_dimensions(output_beta->num_dimensions());
+        output_beta->set_valid_region(ValidRegion(coord, output_beta->tensor_shape()));
+    }
+
+    return std::make_pair(Status{}, win);
+}
+
+/** Extract consecutive bits from a packed row
+ *
+ * @param[in] row_ptr    Pointer to the first byte of the packed row.
+ * @param[in] bit_offset Position of the first bit to extract, where bit 0 is the most significant bit of the first byte.
+ * @param[in] num_bits   Number of bits to extract. Must be in the range [1, 57].
+ *
+ * @return The extracted bits, aligned to the most significant bit. All the remaining bits are zero.
+ */
+inline uint64_t load_bits(const uint8_t *row_ptr, unsigned int bit_offset, unsigned int num_bits)
+{
+    const uint8_t     *ptr       = row_ptr + (bit_offset >> 3);
+    const unsigned int shift     = bit_offset & 7;
+    const unsigned int num_bytes = (shift + num_bits + 7) >> 3;
+
+    uint64_t bits = 0;
+    for(unsigned int i = 0; i < num_bytes; ++i)
+    {
+        bits |= static_cast<uint64_t>(ptr[i]) << (56 - 8 * i);
+    }
 
-    constexpr unsigned int num_elems_read_per_iteration    = 1;
-    const     unsigned int num_elems_written_per_iteration = num_elems_read_per_iteration * 8;
-
-    // Configure window
-    Window win = calculate_max_window(*output, Steps(num_elems_written_per_iteration));
-    
-    // Update window and padding
-    AccessWindowHorizontal input_access(input, 0, num_elems_read_per_iteration);
-    // Weights and biases don't need any padding
-    AccessWindowHorizontal output_access(output, 0, num_elems_written_per_iteration);
-    // Alpha doesn't need any padding
-    AccessWindowHorizontal beta_access(beta, 0, (beta != nullptr) ? num_elems_written_per_iteration : 0);
-    
-    bool window_changed = update_window_and_padding(win, input_access, output_access, beta_access);
-    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
-
-    Status err = (window_changed) ? ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Insufficient Padding!") : Status{};
-    return std::make_pair(err, win);
+    return (bits << shift) & (~static_cast<uint64_t>(0) << (64 - num_bits));
+}
+
+/** Store the most significant bytes of a bit string extracted with @ref load_bits
+ *
+ * @param[in]  bits      Bits to store, aligned to the most significant bit.
+ * @param[out] dst       Destination pointer.
+ * @param[in]  num_bytes Number of bytes to store.
+ */
+inline void store_bits(uint64_t bits, uint8_t *dst, unsigned int num_bytes)
+{
+    for(unsigned int i = 0; i < num_bytes; ++i)
+    {
+        dst[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+    }
+}
+
+/** Gather one row of the input patches of a block of output pixels
+ *
+ * @note The generic version extracts the bits of each pixel separately. The 1x1 and 3x3 specialisations read the bits
+ *       of the whole block with a single fixed-size load, as @p x is a multiple of @ref num_pixels_per_byte and each
+ *       patch row fits in a single byte.
+ *
+ * @param[in]  row_ptr    Pointer to the first byte of the packed input row.
+ * @param[in]  x          Index of the first output pixel of the block.
+ * @param[in]  num_pixels Number of valid pixels in the block.
+ * @param[in]  kw         Width of the original kernel.
+ * @param[in]  stride_w   Stride along the width.
+ * @param[in]  row_bytes  Number of bytes of each patch row.
+ * @param[out] patches    Per-pixel patch buffers.
+ * @param[in]  offset     Offset in bytes of the row in each patch buffer.
+ */
+template <unsigned int kernel_w, unsigned int stride_x>
+inline void gather_row(const uint8_t *row_ptr, unsigned int x, unsigned int num_pixels, unsigned int kw, unsigned int stride_w, unsigned int row_bytes,
+                       uint8_t (*patches)[max_patch_bytes_per_px], unsigned int offset)
+{
+    for(unsigned int p = 0; p < num_pixels; ++p)
+    {
+        store_bits(load_bits(row_ptr, (x + p) * stride_w, kw), patches[p] + offset, row_bytes);
+    }
+}
+
+template <>
+inline void gather_row<1, 1>(const uint8_t *row_ptr, unsigned int x, unsigned int num_pixels, unsigned int kw, unsigned int stride_w, unsigned int row_bytes,
+                             uint8_t (*patches)[max_patch_bytes_per_px], unsigned int offset)
+{
+    ARM_COMPUTE_UNUSED(kw, stride_w, row_bytes);
+
+    // The bits of the block are exactly one input byte
+    const unsigned int bits = row_ptr[x >> 3];
+    for(unsigned int p = 0; p < num_pixels; ++p)
+    {
+        patches[p][offset] = static_cast<uint8_t>((bits << p) & 0x80);
+    }
+}
+
+template <>
+inline void gather_row<3, 1>(const uint8_t *row_ptr, unsigned int x, unsigned int num_pixels, unsigned int kw, unsigned int stride_w, unsigned int row_bytes,
+                             uint8_t (*patches)[max_patch_bytes_per_px], unsigned int offset)
+{
+    ARM_COMPUTE_UNUSED(kw, stride_w, row_bytes);
+
+    // The block spans bits [0, 10) of the two bytes starting at x / 8. The second byte is only read if a valid pixel needs it
+    const uint8_t     *ptr  = row_ptr + (x >> 3);
+    const unsigned int bits = (static_cast<unsigned int>(ptr[0]) << 8) | ((num_pixels > 6) ? ptr[1] : 0);
+    for(unsigned int p = 0; p < num_pixels; ++p)
+    {
+        patches[p][offset] = static_cast<uint8_t>(((bits << p) >> 8) & 0xE0);
+    }
+}
+
+template <>
+inline void gather_row<3, 2>(const uint8_t *row_ptr, unsigned int x, unsigned int num_pixels, unsigned int kw, unsigned int stride_w, unsigned int row_bytes,
+                             uint8_t (*patches)[max_patch_bytes_per_px], unsigned int offset)
+{
+    ARM_COMPUTE_UNUSED(kw, stride_w, row_bytes);
+
+    // The block spans bits [0, 17) of the three bytes starting at x / 4. The trailing bytes are only read if a valid pixel needs them
+    const uint8_t     *ptr  = row_ptr + (x >> 2);
+    const unsigned int bits = (static_cast<unsigned int>(ptr[0]) << 16) | ((num_pixels > 3) ? static_cast<unsigned int>(ptr[1]) << 8 : 0) | ((num_pixels > 7) ? ptr[2] : 0);
+    for(unsigned int p = 0; p < num_pixels; ++p)
+    {
+        patches[p][offset] = static_cast<uint8_t>(((bits << (2 * p)) >> 16) & 0xE0);
+    }
 }
 } // namespace
 
 NEBinaryConvolutionKernel::NEBinaryConvolutionKernel()
-    : _input(nullptr),_weights(nullptr), _biases(nullptr), _output(nullptr), _alpha(nullptr), _beta(nullptr), _num_elems_written_per_iteration(8)
+    : _func(nullptr), _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _alpha(nullptr), _beta(nullptr), _output_beta(nullptr), _kernel_sz(), _conv_info(),
+      _num_channels(0), _act_min(0.f), _act_max(0.f)
 {
 }
 
-void NEBinaryConvolutionKernel::configure(ITensor *input, ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
-                                          const ITensor *alpha, ITensor *beta, const Size2D &kernel_sz)
+void NEBinaryConvolutionKernel::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                          const ITensor *alpha, ITensor *beta, const Size2D &kernel_sz, unsigned int num_channels,
+                                          const ActivationLayerInfo &act_info, ITensor *output_beta)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output, alpha, beta);
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr,
-                                                  output->info(), conv_info, alpha->info(), beta->info(), kernel_sz));
-    _input   = input;
-    _weights = weights;
-    _biases  = biases;
-    _output  = output;
-    _alpha   = alpha;
-    _beta    = beta;
-    
+                                                  output->info(), conv_info, alpha->info(), beta->info(), kernel_sz, num_channels,
+                                                  act_info, (output_beta != nullptr) ? output_beta->info() : nullptr));
+    _input        = input;
+    _weights      = weights;
+    _biases       = biases;
+    _output       = output;
+    _alpha        = alpha;
+    _beta         = beta;
+    _kernel_sz    = kernel_sz;
+    _conv_info    = conv_info;
+    _num_channels = num_channels;
+    _output_beta  = (output->info()->data_type() == DataType::U8) ? output_beta : nullptr;
+
+    std::tie(_act_min, _act_max) = detail::compute_activation_bounds(act_info);
+
+    const unsigned int stride_x = conv_info.stride().first;
+
+    // Only the 1x1 and 3x3 configurations with a unit or double stride have fixed-size gathers, every other one uses the runtime-sized function
+    _func = &NEBinaryConvolutionKernel::binary_convolution<0, 0, 0>;
+    if(input->info()->data_layout() == DataLayout::NHWC)
+    {
+        _func = &NEBinaryConvolutionKernel::binary_convolution_nhwc;
+    }
+    else if(kernel_sz == Size2D(1U, 1U) && stride_x == 1)
+    {
+        _func = &NEBinaryConvolutionKernel::binary_convolution<1, 1, 1>;
+    }
+    else if(kernel_sz == Size2D(3U, 3U) && (stride_x == 1 || stride_x == 2))
+    {
+        _func = (stride_x == 1) ? &NEBinaryConvolutionKernel::binary_convolution<3, 3, 1> : &NEBinaryConvolutionKernel::binary_convolution<3, 3, 2>;
+    }
+
     // Configure kernel window
-    auto win_config = validate_and_configure_window(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr,
-                                                    output->info(), conv_info, alpha->info(), beta->info(), kernel_sz);
+    auto win_config = validate_and_configure_window(output->info(), weights->info(), (_output_beta != nullptr) ? _output_beta->info() : nullptr);
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
-    
+
     INEKernel::configure(win_config.second);
 }
 
 Status NEBinaryConvolutionKernel::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
-                                           const PadStrideInfo &conv_info, const ITensorInfo *alpha, const ITensorInfo *beta, const Size2D &kernel_sz)
+                                           const PadStrideInfo &conv_info, const ITensorInfo *alpha, const ITensorInfo *beta, const Size2D &kernel_sz,
+                                           unsigned int num_channels, const ActivationLayerInfo &act_info, const ITensorInfo *output_beta)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output, alpha, beta);
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, (biases != nullptr) ? biases : nullptr, output, conv_info, alpha, beta, kernel_sz));
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), weights->clone().get(), (biases != nullptr) ? biases->clone().get() : nullptr,
-                                                              output->clone().get(), conv_info, alpha->clone().get(), beta->clone().get(), kernel_sz).first);
+    const bool is_output_binarized = output->data_type() == DataType::U8;
+
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, biases, output, conv_info, alpha, beta, kernel_sz, num_channels, act_info, output_beta));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(output->clone().get(), weights, is_output_binarized ? output_beta->clone().get() : nullptr).first);
     return Status{};
 }
 
-void NEBinaryConvolutionKernel::run(const Window &window, const ThreadInfo &info)
+template <unsigned int kernel_w, unsigned int kernel_h, unsigned int stride_x>
+void NEBinaryConvolutionKernel::binary_convolution(const Window &window)
 {
-    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
-    
-    const unsigned int src_stride_x     = _input->info()->strides_in_bytes().x();
+    const unsigned int kw       = (kernel_w != 0) ? kernel_w : _kernel_sz.width;
+    const unsigned int kh       = (kernel_h != 0) ? kernel_h : _kernel_sz.height;
+    const unsigned int stride_w = (stride_x != 0) ? stride_x : _conv_info.stride().first;
+    const unsigned int stride_h = _conv_info.stride().second;
+
+    const unsigned int src_stride_y     = _input->info()->strides_in_bytes().y();
+    const unsigned int src_stride_z     = _input->info()->strides_in_bytes().z();
+    const unsigned int src_stride_w     = _input->info()->strides_in_bytes()[3];
+    const unsigned int weights_stride_w = _weights->info()->strides_in_bytes()[3];
+    const unsigned int out_width        = _beta->info()->dimension(0);
+    const unsigned int num_ofms         = _weights->info()->dimension(3);
+    const bool         has_bias         = _biases != nullptr;
+    const bool         binarize_output  = _output_beta != nullptr;
+
+    // The binarized weights of each OFM are laid out as weights_depth * kh rows of row_bytes bytes each.
+    // The input patch of every output pixel is gathered with the same layout, so that each dot product
+    // becomes a popcount over two contiguous bit strings
+    const unsigned int row_bytes      = _weights->info()->dimension(0);
+    const unsigned int num_rows       = _weights->info()->dimension(2) * kh;
+    const unsigned int rows_per_chunk = max_patch_bytes_per_px / row_bytes;
+
+    // Number of products accumulated in each output value: matches - mismatches = num_elems - 2 * mismatches
+    const float num_elems = static_cast<float>(kw * num_rows);
+
+    const uint8_t *src_base     = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *weights_base = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const auto     alpha_ptr    = reinterpret_cast<const float *>(_alpha->buffer() + _alpha->info()->offset_first_element_in_bytes());
+    const auto     biases_ptr   = has_bias ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    alignas(16) uint8_t patches[num_pixels_per_byte][max_patch_bytes_per_px];
+    const uint8_t *patch_ptrs[num_pixels_per_byte];
+
+    // Mismatching bits of each OFM and pixel of the block, accumulated over the chunks of rows
+    std::vector<uint32_t> mismatches(num_ofms * num_pixels_per_byte);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const unsigned int num_pixels = std::min(num_pixels_per_byte, out_width - id.x());
+        const uint8_t     *in_ptr     = src_base + id.y() * stride_h * src_stride_y + id[3] * src_stride_w;
+        const auto         beta_ptr   = reinterpret_cast<const float *>(_beta->ptr_to_element(Coordinates(id.x(), id.y(), 0, id[3])));
+
+        // Pixels beyond the end of the row reuse the first patch, their results are discarded
+        for(unsigned int p = 0; p < num_pixels_per_byte; ++p)
+        {
+            patch_ptrs[p] = patches[(p < num_pixels) ? p : 0];
+        }
+
+        std::fill(mismatches.begin(), mismatches.end(), 0);
+
+        for(unsigned int chunk_start = 0; chunk_start < num_rows; chunk_start += rows_per_chunk)
+        {
+            const unsigned int chunk_rows  = std::min(rows_per_chunk, num_rows - chunk_start);
+            const unsigned int chunk_bytes = chunk_rows * row_bytes;
+
+            // Gather the input patches
+            for(unsigned int r = chunk_start; r < chunk_start + chunk_rows; ++r)
+            {
+                const unsigned int d  = r / kh;
+                const unsigned int ky = r % kh;
+
+                gather_row<kernel_w, stride_x>(in_ptr + d * src_stride_z + ky * src_stride_y, id.x(), num_pixels, kw, stride_w, row_bytes,
+                                               patches, (r - chunk_start) * row_bytes);
+            }
+
+            // XNOR-popcount against the weights of every OFM
+            for(unsigned int ofm = 0; ofm < num_ofms; ++ofm)
+            {
+                const uint8_t *weights_ptr = weights_base + ofm * weights_stride_w + chunk_start * row_bytes;
+                uint32_t      *ofm_counts  = mismatches.data() + ofm * num_pixels_per_byte;
+
+                for(unsigned int p = 0; p < num_pixels; p += num_pixels_per_block)
+                {
+                    uint32_t counts[num_pixels_per_block];
+                    detail::popcount_xor_x4(weights_ptr, patch_ptrs + p, chunk_bytes, counts);
+
+                    for(unsigned int i = 0; i < num_pixels_per_block; ++i)
+                    {
+                        ofm_counts[p + i] += counts[i];
+                    }
+                }
+            }
+        }
+
+        // Normalize, then either store the results or their signs
+        float abs_sums[num_pixels_per_byte] = { 0.f };
+
+        for(unsigned int ofm = 0; ofm < num_ofms; ++ofm)
+        {
+            const uint32_t *ofm_counts = mismatches.data() + ofm * num_pixels_per_byte;
+            const float     bias       = has_bias ? biases_ptr[ofm] : 0.f;
+
+            if(binarize_output)
+            {
+                uint8_t *out_ptr = _output->ptr_to_element(Coordinates(id.x() / num_pixels_per_byte, id.y(), ofm, id[3]));
+
+                *out_ptr = 0;
+                for(unsigned int p = 0; p < num_pixels; ++p)
+                {
+                    const float val = std::min(std::max((num_elems - 2.f * static_cast<float>(ofm_counts[p])) * alpha_ptr[ofm] * beta_ptr[p] + bias, _act_min), _act_max);
+                    detail::store_sign(out_ptr, p, val);
+                    abs_sums[p] += std::abs(val);
+                }
+            }
+            else
+            {
+                const auto out_ptr = reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(id.x(), id.y(), ofm, id[3])));
+
+                for(unsigned int p = 0; p < num_pixels; ++p)
+                {
+                    out_ptr[p] = std::min(std::max((num_elems - 2.f * static_cast<float>(ofm_counts[p])) * alpha_ptr[ofm] * beta_ptr[p] + bias, _act_min), _act_max);
+                }
+            }
+        }
+
+        if(binarize_output)
+        {
+            const auto out_beta_ptr = reinterpret_cast<float *>(_output_beta->ptr_to_element(Coordinates(id.x(), id.y(), 0, id[3])));
+            for(unsigned int p = 0; p < num_pixels; ++p)
+            {
+                out_beta_ptr[p] = abs_sums[p] / num_ofms;
+            }
+        }
+    });
+}
+
+void NEBinaryConvolutionKernel::binary_convolution_nhwc(const Window &window)
+{
+    const unsigned int kw       = _kernel_sz.width;
+    const unsigned int kh       = _kernel_sz.height;
+    const unsigned int stride_w = _conv_info.stride().first;
+    const unsigned int stride_h = _conv_info.stride().second;
+
     const unsigned int src_stride_y     = _input->info()->strides_in_bytes().y();
     const unsigned int src_stride_z     = _input->info()->strides_in_bytes().z();
     const unsigned int src_stride_w     = _input->info()->strides_in_bytes()[3];
-    const unsigned int weights_stride_y = _weights->info()->strides_in_bytes().y();
     const unsigned int weights_stride_z = _weights->info()->strides_in_bytes().z();
     const unsigned int weights_stride_w = _weights->info()->strides_in_bytes()[3];
-    const unsigned int alpha_stride_x   = _alpha->info()->strides_in_bytes().x();
-    const unsigned int beta_stride_x    = _beta->info()->strides_in_bytes().x();
-    const unsigned int beta_stride_y    = _beta->info()->strides_in_bytes().y();
-    const unsigned int beta_stride_w    = _beta->info()->strides_in_bytes()[3];
+    const unsigned int out_width        = _beta->info()->dimension(1);
+    const unsigned int num_ofms         = _weights->info()->dimension(3);
     const bool         has_bias         = _biases != nullptr;
-    const unsigned int biases_stride_x  = has_bias ? _biases->info()->strides_in_bytes().x() : 0;
-    const unsigned int weights_depth    = _weights->info()->dimension(2);
-    
-    Window alpha_win = window;
-    Window beta_win  = window;
-    alpha_win.set(Window::DimY, Window::Dimension(0, 0, 0));
-    alpha_win.set(Window::DimZ, Window::Dimension(0, 0, 0));
-    alpha_win.set(3, Window::Dimension(0, 0, 0));
-    beta_win.set(Window::DimZ, Window::Dimension(0, 0, 0));
-    beta_win.set(3, Window::Dimension(0, 0, 0));
-    
-    Iterator input(_input, window);
-    Iterator output(_output, window);
-    Iterator weights(_weights, window);
-    Iterator biases(_biases, alpha_win); // TODO check nullptr
-    Iterator alpha(_alpha, alpha_win);
-    Iterator beta(_beta, beta_win);
-    
+    const bool         binarize_output  = _output_beta != nullptr;
+
+    // The packed channels of the kw consecutive locations of a kernel row are contiguous
+    const unsigned int row_bytes = kw * _input->info()->dimension(0);
+    const float        num_elems = static_cast<float>(kw * kh * _num_channels);
+
+    const uint8_t *src_base     = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *weights_base = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const auto     alpha_ptr    = reinterpret_cast<const float *>(_alpha->buffer() + _alpha->info()->offset_first_element_in_bytes());
+    const auto     biases_ptr   = has_bias ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    const uint8_t *in_ptrs[num_pixels_per_block];
+    const uint8_t *row_ptrs[num_pixels_per_block];
+    uint8_t       *out_ptrs[num_pixels_per_block];
+    float          betas[num_pixels_per_block];
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        auto       in_ptr      = input.ptr() + (id.x() / _num_elems_written_per_iteration) * src_stride_x + id.y() * src_stride_y + id[3] * src_stride_w; // TODO try remove cast in binarysign
-        const auto out_ptr     = reinterpret_cast<float *>(output.ptr());
-        auto       weights_ptr = weights.ptr() + id.z() * weights_stride_w;
-        const auto alpha_ptr   = reinterpret_cast<float *>(alpha.ptr() + id.z() * alpha_stride_x);
-        const auto beta_ptr    = reinterpret_cast<float *>(beta.ptr() + id.x() * beta_stride_x + id.y() * beta_stride_y + id[3] * beta_stride_w);
-        
-        float32x4_t out_vals0 = vdupq_n_f32(0);
-        float32x4_t out_vals1 = vdupq_n_f32(0);
-    
-        for(unsigned int d = 0; d < weights_depth; ++d)
+        const unsigned int num_pixels = std::min(num_pixels_per_block, out_width - id.y());
+        const uint8_t     *in_ptr     = src_base + id.z() * stride_h * src_stride_z + id[3] * src_stride_w;
+
+        // Pixels beyond the end of the row reuse the first pixel, their results are discarded
+        for(unsigned int p = 0; p < num_pixels_per_block; ++p)
+        {
+            in_ptrs[p] = in_ptr + (id.y() + ((p < num_pixels) ? p : 0)) * stride_w * src_stride_y;
+        }
+
+        for(unsigned int p = 0; p < num_pixels; ++p)
+        {
+            betas[p]    = *reinterpret_cast<const float *>(_beta->ptr_to_element(Coordinates(0, id.y() + p, id.z(), id[3])));
+            out_ptrs[p] = _output->ptr_to_element(Coordinates(0, id.y() + p, id.z(), id[3]));
+
+            // The signs are OR-ed in the packed channels of each pixel, which also clears the padding bytes
+            if(binarize_output)
+            {
+                std::memset(out_ptrs[p], 0, _output->info()->dimension(0));
+            }
+        }
+
+        float abs_sums[num_pixels_per_block] = { 0.f };
+
+        for(unsigned int ofm = 0; ofm < num_ofms; ++ofm)
         {
-            uint16x4_t src_vals;
-            uint16x4_t next_byte;
-            uint16x4_t tmp = vdup_n_u16(0);
-            uint16x4_t weights_vals;
-            
-            src_vals[0] = *(in_ptr + 0 * src_stride_y);
-            src_vals[1] = *(in_ptr + 1 * src_stride_y);
-            src_vals[2] = *(in_ptr + 2 * src_stride_y);
-            
-            next_byte[0] = *(in_ptr + 0 * src_stride_y + src_stride_x);
-            next_byte[1] = *(in_ptr + 1 * src_stride_y + src_stride_x);
-            next_byte[2] = *(in_ptr + 2 * src_stride_y + src_stride_x);
-            
-            tmp = vshl_s16(vshl_s16(src_vals, vdup_n_u16(-1)), vdup_n_u16(7));
-            tmp = vorr_u16(tmp, vshl_s16(vshl_u16(src_vals, vdup_n_u16(7)), vdup_n_u16(-1)));
-            tmp = vorr_u16(tmp, vshl_u16(vshl_s16(next_byte, vdup_n_u16(-7)), vdup_n_u16(5)));
-            tmp = vorr_u16(tmp, vshl_u16(vshl_s16(vshl_u16(next_byte, vdup_n_u16(1)), vdup_n_u16(-7)), vdup_n_u16(4)));
-            
-            weights_vals[0] = *(weights_ptr + 0 * weights_stride_y);
-            weights_vals[1] = *(weights_ptr + 1 * weights_stride_y);
-            weights_vals[2] = *(weights_ptr + 2 * weights_stride_y);
-            
-            weights_vals = vshl_u16(vshl_s16(weights_vals,vdup_n_u16(-5)), vdup_n_u16(5));
-            
-            uint16x8_t mask = vdupq_n_u16(255 >> 3);
-            mask[1] = (mask[0] >> 1) | 128;
-            mask[2] = (mask[1] >> 1) | 128;
-            mask[3] = (mask[2] >> 1) | 128;
-            mask[4] = (mask[3] >> 1) | 128;
-            mask[5] = (mask[4] >> 1) | 128;
-            
-            out_vals0[0] += std::bitset<8>(~(src_vals[0] ^ ((~src_vals[0] & mask[0]) | weights_vals[0]))).count();
-            out_vals0[0] += std::bitset<8>(~(src_vals[1] ^ ((~src_vals[1] & mask[0]) | weights_vals[1]))).count();
-            out_vals0[0] += std::bitset<8>(~(src_vals[2] ^ ((~src_vals[2] & mask[0]) | weights_vals[2]))).count();
-
-            out_vals1[2] += std::bitset<8>(~(tmp[0] ^ ((~tmp[0] & mask[0]) | weights_vals[0]))).count();
-            out_vals1[2] += std::bitset<8>(~(tmp[1] ^ ((~tmp[1] & mask[0]) | weights_vals[1]))).count();
-            out_vals1[2] += std::bitset<8>(~(tmp[2] ^ ((~tmp[2] & mask[0]) | weights_vals[2]))).count();
-            weights_vals >>= 1;
-
-            out_vals0[1] += std::bitset<8>(~(src_vals[0] ^ ((~src_vals[0] & mask[1]) | weights_vals[0]))).count();
-            out_vals0[1] += std::bitset<8>(~(src_vals[1] ^ ((~src_vals[1] & mask[1]) | weights_vals[1]))).count();
-            out_vals0[1] += std::bitset<8>(~(src_vals[2] ^ ((~src_vals[2] & mask[1]) | weights_vals[2]))).count();
-
-            out_vals1[3] += std::bitset<8>(~(tmp[0] ^ ((~tmp[0] & mask[1]) | weights_vals[0]))).count();
-            out_vals1[3] += std::bitset<8>(~(tmp[1] ^ ((~tmp[1] & mask[1]) | weights_vals[1]))).count();
-            out_vals1[3] += std::bitset<8>(~(tmp[2] ^ ((~tmp[2] & mask[1]) | weights_vals[2]))).count();
-            weights_vals >>= 1;
-
-            out_vals0[2] += std::bitset<8>(~(src_vals[0] ^ ((~src_vals[0] & mask[2]) | weights_vals[0]))).count();
-            out_vals0[2] += std::bitset<8>(~(src_vals[1] ^ ((~src_vals[1] & mask[2]) | weights_vals[1]))).count();
-            out_vals0[2] += std::bitset<8>(~(src_vals[2] ^ ((~src_vals[2] & mask[2]) | weights_vals[2]))).count();
-            weights_vals >>= 1;
-
-            out_vals0[3] += std::bitset<8>(~(src_vals[0] ^ ((~src_vals[0] & mask[3]) | weights_vals[0]))).count();
-            out_vals0[3] += std::bitset<8>(~(src_vals[1] ^ ((~src_vals[1] & mask[3]) | weights_vals[1]))).count();
-            out_vals0[3] += std::bitset<8>(~(src_vals[2] ^ ((~src_vals[2] & mask[3]) | weights_vals[2]))).count();
-            weights_vals >>= 1;
-
-            out_vals1[0] += std::bitset<8>(~(src_vals[0] ^ ((~src_vals[0] & mask[4]) | weights_vals[0]))).count();
-            out_vals1[0] += std::bitset<8>(~(src_vals[1] ^ ((~src_vals[1] & mask[4]) | weights_vals[1]))).count();
-            out_vals1[0] += std::bitset<8>(~(src_vals[2] ^ ((~src_vals[2] & mask[4]) | weights_vals[2]))).count();
-            weights_vals >>= 1;
-
-            out_vals1[1] += std::bitset<8>(~(src_vals[0] ^ ((~src_vals[0] & mask[5]) | weights_vals[0]))).count();
-            out_vals1[1] += std::bitset<8>(~(src_vals[1] ^ ((~src_vals[1] & mask[5]) | weights_vals[1]))).count();
-            out_vals1[1] += std::bitset<8>(~(src_vals[2] ^ ((~src_vals[2] & mask[5]) | weights_vals[2]))).count();  
-
-            in_ptr      += src_stride_z;
-            weights_ptr += weights_stride_z;
+            const uint8_t *weights_ptr = weights_base + ofm * weights_stride_w;
+
+            uint32_t mismatches[num_pixels_per_block] = { 0 };
+            for(unsigned int ky = 0; ky < kh; ++ky)
+            {
+                for(unsigned int p = 0; p < num_pixels_per_block; ++p)
+                {
+                    row_ptrs[p] = in_ptrs[p] + ky * src_stride_z;
+                }
+
+                uint32_t row_mismatches[num_pixels_per_block];
+                detail::popcount_xor_x4(weights_ptr + ky * weights_stride_z, row_ptrs, row_bytes, row_mismatches);
+
+                for(unsigned int p = 0; p < num_pixels_per_block; ++p)
+                {
+                    mismatches[p] += row_mismatches[p];
+                }
+            }
+
+            const float alpha = alpha_ptr[ofm];
+            const float bias  = has_bias ? biases_ptr[ofm] : 0.f;
+
+            for(unsigned int p = 0; p < num_pixels; ++p)
+            {
+                const float val = std::min(std::max((num_elems - 2.f * static_cast<float>(mismatches[p])) * alpha * betas[p] + bias, _act_min), _act_max);
+
+                if(binarize_output)
+                {
+                    detail::store_sign(out_ptrs[p], ofm, val);
+                    abs_sums[p] += std::abs(val);
+                }
+                else
+                {
+                    reinterpret_cast<float *>(out_ptrs[p])[ofm] = val;
+                }
+            }
         }
-        
-        float32x4_t tot_elems  = vdupq_n_f32(9 * weights_depth);
-        float32x4_t beta_vals0 = vld1q_f32(beta_ptr);
-        float32x4_t beta_vals1 = vld1q_f32(beta_ptr + 4);
-        float32x4_t alpha_vals = vdupq_n_f32(*alpha_ptr);
-
-        out_vals0 = vmulq_f32(vsubq_f32(vmulq_f32(vdupq_n_f32(2), out_vals0), tot_elems), vmulq_f32(alpha_vals, beta_vals0));
-        out_vals1 = vmulq_f32(vsubq_f32(vmulq_f32(vdupq_n_f32(2), out_vals1), tot_elems), vmulq_f32(alpha_vals, beta_vals1));
-        
-        if(has_bias)
+
+        if(binarize_output)
         {
-            const auto biases_ptr = reinterpret_cast<float *>(biases.ptr() + id.z() * biases_stride_x);
-            float32x4_t biases_val = vdupq_n_f32(*biases_ptr);
-            
-            out_vals0 = vaddq_f32(out_vals0, biases_val);
-            out_vals1 = vaddq_f32(out_vals1, biases_val);
+            for(unsigned int p = 0; p < num_pixels; ++p)
+            {
+                *reinterpret_cast<float *>(_output_beta->ptr_to_element(Coordinates(0, id.y() + p, id.z(), id[3]))) = abs_sums[p] / num_ofms;
+            }
         }
-        
-        vst1q_f32(out_ptr, out_vals0);
-        vst1q_f32(out_ptr + 4, out_vals1);
-    }, output);
+    });
+}
+
+void NEBinaryConvolutionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
 }
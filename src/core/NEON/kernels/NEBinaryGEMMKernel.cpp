@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBinaryGEMMKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/detail/NEBinaryOutputStageDetail.h"
+#include "arm_compute/core/NEON/kernels/detail/NEBinaryPopcountDetail.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+constexpr unsigned int block_rows        = 4;  /**< Number of rows of the LHS matrix processed by the micro-kernel */
+constexpr unsigned int block_cols        = 4;  /**< Number of rows of the transposed RHS matrix processed by the micro-kernel */
+constexpr unsigned int num_rows_per_tile = 16; /**< Number of output rows sharing each block of the transposed RHS matrix */
+
+Status validate_arguments(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *biases, const ITensorInfo *output, const ITensorInfo *alpha,
+                          const ITensorInfo *beta, unsigned int num_elems, unsigned int depth_output_gemm3d, const ActivationLayerInfo &act_info,
+                          const ITensorInfo *output_beta)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, output, alpha, beta);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(alpha, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(beta, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(a->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ON_ERROR(detail::validate_binary_output_stage_activation(act_info));
+
+    const size_t num_bytes   = a->dimension(0);
+    const size_t num_rows    = a->dimension(1);
+    const size_t num_cols    = alpha->tensor_shape().total_size();
+    const size_t num_batches = a->dimension(2);
+
+    if(output->data_type() == DataType::U8)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output_beta);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_beta, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_beta->tensor_shape(), beta->tensor_shape());
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != compute_binary_sign_shape(TensorShape(num_cols), DataLayout::NHWC)[0]);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != num_cols);
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON(num_elems == 0 || num_elems > num_bytes * 8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!b->padding().empty(), "The rows of the transposed RHS matrix must be contiguous in memory");
+    ARM_COMPUTE_RETURN_ERROR_ON(b->tensor_shape().total_size() != num_bytes * num_cols);
+    ARM_COMPUTE_RETURN_ERROR_ON(!alpha->padding().empty());
+
+    if(depth_output_gemm3d != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(2) != depth_output_gemm3d);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(1) * depth_output_gemm3d != num_rows);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->tensor_shape().total_size_upper(3) != num_batches);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(1) != num_rows);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->tensor_shape().total_size_upper(2) != num_batches);
+    }
+
+    TensorShape beta_shape = output->tensor_shape();
+    beta_shape.set(0, 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(beta->tensor_shape(), beta_shape);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != num_cols);
+    }
+
+    return Status{};
+}
+
+Window configure_window(const ITensorInfo *a)
+{
+    // Partial tiles are handled inside the kernel, so no padding is needed
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(a->dimension(1), num_rows_per_tile), num_rows_per_tile));
+    win.set(Window::DimZ, Window::Dimension(0, a->dimension(2), 1));
+
+    return win;
+}
+} // namespace
+
+NEBinaryGEMMKernel::NEBinaryGEMMKernel()
+    : _a(nullptr), _b(nullptr), _biases(nullptr), _output(nullptr), _alpha(nullptr), _beta(nullptr), _output_beta(nullptr), _num_elems(0), _depth_output_gemm3d(0), _act_min(0.f),
+      _act_max(0.f)
+{
+}
+
+void NEBinaryGEMMKernel::configure(const ITensor *a, const ITensor *b, const ITensor *biases, ITensor *output, const ITensor *alpha, const ITensor *beta,
+                                   unsigned int num_elems, unsigned int depth_output_gemm3d, const ActivationLayerInfo &act_info, ITensor *output_beta)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, output, alpha, beta);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(a->info(), b->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), alpha->info(), beta->info(),
+                                                  num_elems, depth_output_gemm3d, act_info, (output_beta != nullptr) ? output_beta->info() : nullptr));
+
+    _a                   = a;
+    _b                   = b;
+    _biases              = biases;
+    _output              = output;
+    _alpha               = alpha;
+    _beta                = beta;
+    _num_elems           = num_elems;
+    _depth_output_gemm3d = depth_output_gemm3d;
+    _output_beta         = (output->info()->data_type() == DataType::U8) ? output_beta : nullptr;
+
+    std::tie(_act_min, _act_max) = detail::compute_activation_bounds(act_info);
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    if(_output_beta != nullptr)
+    {
+        coord.set_num_dimensions(_output_beta->info()->num_dimensions());
+        _output_beta->info()->set_valid_region(ValidRegion(coord, _output_beta->info()->tensor_shape()));
+    }
+
+    INEKernel::configure(configure_window(a->info()));
+}
+
+Status NEBinaryGEMMKernel::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *biases, const ITensorInfo *output, const ITensorInfo *alpha,
+                                    const ITensorInfo *beta, unsigned int num_elems, unsigned int depth_output_gemm3d, const ActivationLayerInfo &act_info,
+                                    const ITensorInfo *output_beta)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(a, b, biases, output, alpha, beta, num_elems, depth_output_gemm3d, act_info, output_beta));
+    return Status{};
+}
+
+void NEBinaryGEMMKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const size_t       num_bytes       = _a->info()->dimension(0);
+    const unsigned int num_rows        = _a->info()->dimension(1);
+    const unsigned int num_cols        = _alpha->info()->tensor_shape().total_size();
+    const float        num_elems       = static_cast<float>(_num_elems);
+    const bool         has_bias        = _biases != nullptr;
+    const bool         is_output3d     = _depth_output_gemm3d != 0;
+    const bool         binarize_output = _output_beta != nullptr;
+
+    // Rows of the output are mapped to [x, y] when the output is reinterpreted as 3D
+    const unsigned int out_rows_per_plane = is_output3d ? _output->info()->dimension(1) : num_rows;
+    const Strides     &out_strides        = _output->info()->strides_in_bytes();
+    const Strides     &beta_strides       = _beta->info()->strides_in_bytes();
+    const size_t       out_stride_plane   = is_output3d ? out_strides[2] : 0;
+    const size_t       out_stride_batch   = out_strides[is_output3d ? 3 : 2];
+    const size_t       beta_stride_plane  = is_output3d ? beta_strides[2] : 0;
+    const size_t       beta_stride_batch  = beta_strides[is_output3d ? 3 : 2];
+
+    const size_t   a_stride_y = _a->info()->strides_in_bytes().y();
+    const size_t   a_stride_z = _a->info()->strides_in_bytes().z();
+    const uint8_t *a_base     = _a->buffer() + _a->info()->offset_first_element_in_bytes();
+    const uint8_t *b_base     = _b->buffer() + _b->info()->offset_first_element_in_bytes();
+    uint8_t       *out_base   = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+    const uint8_t *beta_base  = _beta->buffer() + _beta->info()->offset_first_element_in_bytes();
+    const auto     alpha_ptr  = reinterpret_cast<const float *>(_alpha->buffer() + _alpha->info()->offset_first_element_in_bytes());
+    const auto     biases_ptr = has_bias ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    const uint8_t *a_ptrs[num_rows_per_tile];
+    uint8_t       *out_ptrs[num_rows_per_tile];
+    float          row_scales[num_rows_per_tile];
+    float          abs_sums[num_rows_per_tile];
+    const uint8_t *b_ptrs[block_cols];
+    uint32_t       counts[block_rows * block_cols];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const unsigned int row_start     = id.y();
+        const unsigned int num_tile_rows = std::min(num_rows_per_tile, num_rows - row_start);
+
+        // Rows beyond the end of the matrix reuse the last valid one, their results are discarded
+        for(unsigned int r = 0; r < num_rows_per_tile; ++r)
+        {
+            const unsigned int row   = row_start + std::min(r, num_tile_rows - 1);
+            const unsigned int x     = row % out_rows_per_plane;
+            const unsigned int plane = row / out_rows_per_plane;
+
+            a_ptrs[r]     = a_base + row * a_stride_y + id.z() * a_stride_z;
+            out_ptrs[r]   = out_base + x * out_strides[1] + plane * out_stride_plane + id.z() * out_stride_batch;
+            row_scales[r] = *reinterpret_cast<const float *>(beta_base + x * beta_strides[1] + plane * beta_stride_plane + id.z() * beta_stride_batch);
+            abs_sums[r]   = 0.f;
+        }
+
+        // The signs are OR-ed in the packed row of each output, which also clears the padding bytes
+        if(binarize_output)
+        {
+            for(unsigned int r = 0; r < num_tile_rows; ++r)
+            {
+                std::memset(out_ptrs[r], 0, _output->info()->dimension(0));
+            }
+        }
+
+        for(unsigned int col_start = 0; col_start < num_cols; col_start += block_cols)
+        {
+            const unsigned int num_block_cols = std::min(block_cols, num_cols - col_start);
+
+            for(unsigned int c = 0; c < block_cols; ++c)
+            {
+                b_ptrs[c] = b_base + (col_start + std::min(c, num_block_cols - 1)) * num_bytes;
+            }
+
+            for(unsigned int r = 0; r < num_tile_rows; r += block_rows)
+            {
+                detail::popcount_xor_4x4(a_ptrs + r, b_ptrs, num_bytes, counts);
+
+                for(unsigned int i = 0; i < std::min(block_rows, num_tile_rows - r); ++i)
+                {
+                    for(unsigned int j = 0; j < num_block_cols; ++j)
+                    {
+                        const unsigned int col  = col_start + j;
+                        const float        bias = has_bias ? biases_ptr[col] : 0.f;
+                        const float        val  = std::min(std::max((num_elems - 2.f * static_cast<float>(counts[i * block_cols + j])) * alpha_ptr[col] * row_scales[r + i] + bias,
+                                                                    _act_min),
+                                                           _act_max);
+
+                        if(binarize_output)
+                        {
+                            detail::store_sign(out_ptrs[r + i], col, val);
+                            abs_sums[r + i] += std::abs(val);
+                        }
+                        else
+                        {
+                            reinterpret_cast<float *>(out_ptrs[r + i])[col] = val;
+                        }
+                    }
+                }
+            }
+        }
+
+        if(binarize_output)
+        {
+            const Strides &out_beta_strides = _output_beta->info()->strides_in_bytes();
+            uint8_t       *out_beta_base    = _output_beta->buffer() + _output_beta->info()->offset_first_element_in_bytes();
+
+            for(unsigned int r = 0; r < num_tile_rows; ++r)
+            {
+                const unsigned int row   = row_start + r;
+                const unsigned int x     = row % out_rows_per_plane;
+                const unsigned int plane = row / out_rows_per_plane;
+
+                *reinterpret_cast<float *>(out_beta_base + x * out_beta_strides[1] + plane * (is_output3d ? out_beta_strides[2] : 0)
+                                           + id.z() * out_beta_strides[is_output3d ? 3 : 2]) = abs_sums[r] / num_cols;
+            }
+        }
+    });
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBinaryIm2ColKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <cstring>
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.has_padding(), "Padding must be applied to the input before binarization");
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_dims.width == 0 || kernel_dims.height == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) < kernel_dims.width || input->dimension(2) < kernel_dims.height);
+    // The packed channels of consecutive locations along the width must be contiguous
+    ARM_COMPUTE_RETURN_ERROR_ON(input->strides_in_bytes()[1] != input->dimension(0) * input->element_size());
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_binary_im2col_shape(*input, kernel_dims, conv_info));
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(const ITensorInfo *input, ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info)
+{
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_binary_im2col_shape(*input, kernel_dims, conv_info)));
+
+    // Each iteration writes a whole row, no padding is needed
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEBinaryIm2ColKernel::NEBinaryIm2ColKernel()
+    : _input(nullptr), _output(nullptr), _kernel_dims(), _conv_info(), _convolved_width(0)
+{
+}
+
+void NEBinaryIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), kernel_dims, conv_info));
+
+    _input           = input;
+    _output          = output;
+    _kernel_dims     = kernel_dims;
+    _conv_info       = conv_info;
+    _convolved_width = scaled_dimensions(input->info()->dimension(1), input->info()->dimension(2), kernel_dims.width, kernel_dims.height, conv_info).first;
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), kernel_dims, conv_info);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEBinaryIm2ColKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, kernel_dims, conv_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input, output->clone().get(), kernel_dims, conv_info).first);
+    return Status{};
+}
+
+void NEBinaryIm2ColKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const unsigned int stride_x     = _conv_info.stride().first;
+    const unsigned int stride_y     = _conv_info.stride().second;
+    const unsigned int src_stride_y = _input->info()->strides_in_bytes().y();
+    const unsigned int src_stride_z = _input->info()->strides_in_bytes().z();
+    const unsigned int src_stride_w = _input->info()->strides_in_bytes()[3];
+    const size_t       row_bytes    = _kernel_dims.width * _input->info()->dimension(0);
+
+    const uint8_t *src_base = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const unsigned int x = id.y() % _convolved_width;
+        const unsigned int y = id.y() / _convolved_width;
+
+        const uint8_t *in_ptr  = src_base + x * stride_x * src_stride_y + y * stride_y * src_stride_z + id.z() * src_stride_w;
+        uint8_t       *out_ptr = output.ptr();
+
+        // Each kernel row is contiguous in memory
+        for(unsigned int ky = 0; ky < _kernel_dims.height; ++ky, out_ptr += row_bytes)
+        {
+            std::memcpy(out_ptr, in_ptr + ky * src_stride_z, row_bytes);
+        }
+    },
+    output);
+}
@@ -25,11 +25,13 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/detail/NEBinarySignDetail.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 
 using namespace arm_compute;
@@ -37,30 +39,35 @@ using namespace arm_compute::misc::shape_calculator;
 
 namespace
 {
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *alpha, const ITensorInfo *beta)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *partial_sums, const ITensorInfo *beta, bool is_fully_connected)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(is_fully_connected && input->num_dimensions() > 2);
+
+    // Fully connected tensors are packed along the first dimension like NHWC ones
+    const DataLayout data_layout = is_fully_connected ? DataLayout::NHWC : input->data_layout();
 
     // Checks performed when output is configured
     if(output->total_size() != 0)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_binary_sign_shape(input->tensor_shape()));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_binary_sign_shape(input->tensor_shape(), data_layout));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
     }
     
-    // Checks performed when alpha is configured
-    if(alpha != nullptr && alpha->total_size() != 0)
+    // Checks performed when the partial sums are configured
+    if(partial_sums != nullptr && partial_sums->total_size() != 0)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(alpha, 1, DataType::F32);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(alpha->tensor_shape(), TensorShape(input->tensor_shape().total_size_upper(3)));
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(partial_sums, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(partial_sums->tensor_shape(), compute_binary_sign_partial_sums_shape(input->tensor_shape(), data_layout));
     }
     
     // Checks performed when beta is configured
     if(beta != nullptr && beta->total_size() != 0)
     {
         TensorShape expected_shape = input->tensor_shape();
-        expected_shape.set(2, 1);
+        expected_shape.set(get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL), 1);
         
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(beta, 1, DataType::F32);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(beta->tensor_shape(), expected_shape);
@@ -69,210 +76,201 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
     return Status{};
 }
 
-std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, ITensorInfo *alpha, ITensorInfo *beta)
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, ITensorInfo *partial_sums, ITensorInfo *beta, bool is_fully_connected)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    const DataLayout data_layout = is_fully_connected ? DataLayout::NHWC : input->data_layout();
+
     // Output auto inizialitation if not yet initialized
-    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_binary_sign_shape(input->tensor_shape())).set_data_type(DataType::U8));
-    if(alpha != nullptr)
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_binary_sign_shape(input->tensor_shape(), data_layout)).set_data_type(DataType::U8));
+    if(partial_sums != nullptr)
     {
-        auto_init_if_empty(*alpha, input->clone()->set_tensor_shape(TensorShape(input->tensor_shape().total_size_upper(3))));
+        auto_init_if_empty(*partial_sums, input->clone()->set_tensor_shape(compute_binary_sign_partial_sums_shape(input->tensor_shape(), data_layout)));
     }
     if(beta != nullptr)
     {
         TensorShape beta_shape = input->tensor_shape();
-        beta_shape.set(2, 1);
+        beta_shape.set(get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL), 1);
         
         auto_init_if_empty(*beta, input->clone()->set_tensor_shape(beta_shape));
     }
 
-    constexpr unsigned int num_elems_read_per_iteration = 8;
-    constexpr unsigned int num_elems_written_per_iteration = num_elems_read_per_iteration / 8;
+    // Each iteration packs a whole row (NCHW) or all the channels of a spatial location (NHWC), no padding is needed
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
-    // Configure window
-    Window win = calculate_max_window(*output, Steps(num_elems_written_per_iteration));
-    
-    // Update window and padding
-    AccessWindowHorizontal input_access(input, 0, num_elems_read_per_iteration);
-    AccessWindowHorizontal output_access(output, 0, num_elems_written_per_iteration);
-    // Alpha doesn't need any padding
-    AccessWindowHorizontal beta_access(beta, 0, (beta != nullptr) ? num_elems_written_per_iteration : 0);
-    
-    bool window_changed = update_window_and_padding(win, input_access, output_access, beta_access);
-    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
+    // With NCHW, the channels are processed by the same iteration, as beta is accumulated over them
+    if(data_layout == DataLayout::NCHW)
+    {
+        win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+    }
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+
+/** Accumulate the absolute values of a row into a destination row
+ *
+ * @param[in]      in       Pointer to the values to accumulate.
+ * @param[in, out] acc      Pointer to the accumulators.
+ * @param[in]      num_vals Number of values in the row.
+ */
+inline void accumulate_abs(const float *in, float *acc, unsigned int num_vals)
+{
+    unsigned int i = 0;
+    for(; i + 4 <= num_vals; i += 4)
+    {
+        vst1q_f32(acc + i, vaddq_f32(vld1q_f32(acc + i), vabsq_f32(vld1q_f32(in + i))));
+    }
+    for(; i < num_vals; ++i)
+    {
+        acc[i] += std::abs(in[i]);
+    }
+}
 
-    Status err = (window_changed) ? ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Insufficient Padding!") : Status{};
-    return std::make_pair(err, win);
+/** Multiply all the values of a row by the same factor
+ *
+ * @param[in, out] vals     Pointer to the values to scale.
+ * @param[in]      num_vals Number of values in the row.
+ * @param[in]      scale    Scale factor.
+ */
+inline void scale_row(float *vals, unsigned int num_vals, float scale)
+{
+    unsigned int i = 0;
+    for(; i + 4 <= num_vals; i += 4)
+    {
+        vst1q_f32(vals + i, vmulq_n_f32(vld1q_f32(vals + i), scale));
+    }
+    for(; i < num_vals; ++i)
+    {
+        vals[i] *= scale;
+    }
 }
 } // namespace
 
 NEBinarySignKernel::NEBinarySignKernel()
-    : _input(nullptr), _output(nullptr), _alpha(nullptr), _beta(nullptr), _num_elems_read_per_iteration(8)
+    : _func(nullptr), _input(nullptr), _output(nullptr), _partial_sums(nullptr), _beta(nullptr)
 {
 }
 
-void NEBinarySignKernel::configure(const ITensor *input, ITensor *output, ITensor *alpha, ITensor *beta)
+void NEBinarySignKernel::configure(const ITensor *input, ITensor *output, ITensor *partial_sums, ITensor *beta, bool is_fully_connected)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), (alpha != nullptr) ? alpha->info() : nullptr,
-                              (beta != nullptr) ? beta->info() : nullptr));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), (partial_sums != nullptr) ? partial_sums->info() : nullptr,
+                              (beta != nullptr) ? beta->info() : nullptr, is_fully_connected));
 
-    _input  = input;
-    _output = output;
-    _alpha  = alpha;
-    _beta  = beta;
+    _input        = input;
+    _output       = output;
+    _partial_sums = partial_sums;
+    _beta         = beta;
+    _func         = (is_fully_connected || input->info()->data_layout() == DataLayout::NHWC) ? &NEBinarySignKernel::binary_sign_nhwc : &NEBinarySignKernel::binary_sign_nchw;
 
     // Configure kernel window    
-    auto win_config = validate_and_configure_window(input->info(), output->info(), (alpha != nullptr) ? alpha->info() : nullptr, (beta != nullptr) ? beta->info() : nullptr);
+    auto win_config = validate_and_configure_window(input->info(), output->info(), (partial_sums != nullptr) ? partial_sums->info() : nullptr, (beta != nullptr) ? beta->info() : nullptr,
+                                                    is_fully_connected);
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     
     INEKernel::configure(win_config.second);
 }
 
-Status NEBinarySignKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *alpha, const ITensorInfo *beta)
+Status NEBinarySignKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *partial_sums, const ITensorInfo *beta, bool is_fully_connected)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, alpha, beta));
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), (alpha != nullptr) ? alpha->clone().get() : nullptr, (beta != nullptr) ? beta->clone().get() : nullptr).first);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, partial_sums, beta, is_fully_connected));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), (partial_sums != nullptr) ? partial_sums->clone().get() : nullptr,
+                                                              (beta != nullptr) ? beta->clone().get() : nullptr, is_fully_connected).first);
     return Status{};
 }
 
 void NEBinarySignKernel::run(const Window &window, const ThreadInfo &info)
 {
+    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
-    
-    const unsigned int src_width      = _input->info()->dimension(0);
-    const unsigned int src_stride_x   = _input->info()->strides_in_bytes().x() * _num_elems_read_per_iteration;
-    const unsigned int src_stride_y   = _input->info()->strides_in_bytes().y();
-    const unsigned int src_stride_z   = _input->info()->strides_in_bytes().z();
-    const unsigned int src_stride_w   = _input->info()->strides_in_bytes()[3];
-    const bool         calc_alpha     = _alpha != nullptr;
-    const bool         calc_beta      = _beta != nullptr;
-    const unsigned int alpha_stride_x = calc_alpha ? _alpha->info()->strides_in_bytes().x() : 0;
-    const unsigned int beta_stride_y  = calc_beta ? _beta->info()->strides_in_bytes().y() : 0;
-    const unsigned int beta_stride_w  = calc_beta ? _beta->info()->strides_in_bytes()[3] : 0;
-    
-    const float32x4_t zerof = vdupq_n_f32(0);
-    const uint32x4_t zero   = vdupq_n_u32(0);
-    const uint32x4_t one    = vdupq_n_u32(1);
-    
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+void NEBinarySignKernel::binary_sign_nchw(const Window &window)
+{
+    const unsigned int width         = _input->info()->dimension(0);
+    const unsigned int num_channels  = _input->info()->dimension(2);
+    const unsigned int num_bytes     = _output->info()->dimension(0);
+    const size_t       src_stride_z  = _input->info()->strides_in_bytes().z();
+    const size_t       dst_stride_z  = _output->info()->strides_in_bytes().z();
+    const bool         calc_partials = _partial_sums != nullptr;
+    const bool         calc_beta     = _beta != nullptr;
+
     Iterator input(_input, window);
     Iterator output(_output, window);
-    Iterator alpha{};
-    Iterator beta{};
-    
-    if(calc_alpha)
-    {
-        Window alpha_win = window;
-        
-        alpha_win.set(Window::DimY, Window::Dimension(0, 0, 0));
-        alpha_win.set(Window::DimZ, Window::Dimension(0, 0, 0));
-        alpha_win.set(3, Window::Dimension(0, 0, 0));
-        
-        alpha = Iterator(_alpha, alpha_win);
-    }
-    if(calc_beta)
-    {
-        Window beta_win = window;
-        
-        beta_win.set(Window::DimZ, Window::Dimension(0, 0, 0));
-        beta_win.set(3, Window::Dimension(0, 0, 0));
-        
-        beta = Iterator(_beta, beta_win);
-    }
-    
-    execute_window_loop(window, [&](const Coordinates & id)
+    Iterator partial_sums = calc_partials ? Iterator(_partial_sums, window) : Iterator();
+    Iterator beta         = calc_beta ? Iterator(_beta, window) : Iterator();
+
+    execute_window_loop(window, [&](const Coordinates &)
     {
-        const auto in_ptr  = reinterpret_cast<float *>(input.ptr() + id.x() * src_stride_x + id.y() * src_stride_y + id.z() * src_stride_z + id[3] * src_stride_w);
-        const auto out_ptr = reinterpret_cast<uint8_t *>(output.ptr());
-        
-        // Load input values
-        float32x4_t src_vals0 = vld1q_f32(in_ptr);
-        float32x4_t src_vals1 = vld1q_f32(in_ptr + 4);
-        
-        // Don't consider padding
-        const uint32x4_t offs0   = {0, 1, 2, 3};
-        const uint32x4_t offs1   = {4, 5, 6, 7};
-        const uint32x4_t x_pos0 = vaddq_u32(vdupq_n_u32(id.x() * _num_elems_read_per_iteration), offs0);
-        const uint32x4_t x_pos1 = vaddq_u32(vdupq_n_u32(id.x() * _num_elems_read_per_iteration), offs1);
-        src_vals0 = vbslq_u32(vreinterpretq_u32_f32(x_pos0 < vdupq_n_u32(src_width)), src_vals0, zerof);
-        src_vals1 = vbslq_u32(vreinterpretq_u32_f32(x_pos1 < vdupq_n_u32(src_width)), src_vals1, zerof);
-        
-        // Calculate sign
-        const uint32x4_t signs0  = vbslq_u32(vreinterpretq_u32_f32(src_vals0 > zerof), one, zero);
-        const uint32x4_t signs1  = vbslq_u32(vreinterpretq_u32_f32(src_vals1 > zerof), one, zero);
-        
-        // Write to one byte
-        unsigned char dst_val = 0;
-        dst_val |= (signs0[0] << 7);
-        dst_val |= (signs0[1] << 6);
-        dst_val |= (signs0[2] << 5);
-        dst_val |= (signs0[3] << 4);
-        dst_val |= (signs1[0] << 3);
-        dst_val |= (signs1[1] << 2);
-        dst_val |= (signs1[2] << 1);
-        dst_val |= (signs1[3]);
-        
-        // Write to tensor
-        *out_ptr = dst_val;
-        
-        // Calculate alpha and beta
-        if(calc_alpha || calc_beta)
+        const auto beta_ptr = calc_beta ? reinterpret_cast<float *>(beta.ptr()) : nullptr;
+        float      sum      = 0.f;
+
+        if(calc_beta)
         {
-            const float32x4_t abs_vals0 = vabsq_f32(src_vals0);
-            const float32x4_t abs_vals1 = vabsq_f32(src_vals1);
-            
-            if(calc_alpha)
-            {
-                const auto alpha_ptr = reinterpret_cast<float *>(alpha.ptr() + id[3] * alpha_stride_x);
-                float sum = abs_vals0[0] + abs_vals0[1] + abs_vals0[2] + abs_vals0[3] +
-                            abs_vals1[0] + abs_vals1[1] + abs_vals1[2] + abs_vals1[3];
-                *alpha_ptr += sum;
-            }
+            std::fill_n(beta_ptr, width, 0.f);
+        }
+
+        for(unsigned int c = 0; c < num_channels; ++c)
+        {
+            const auto in_ptr = reinterpret_cast<const float *>(input.ptr() + c * src_stride_z);
+
+            sum += detail::pack_signs_row(in_ptr, output.ptr() + c * dst_stride_z, width, num_bytes);
+
             if(calc_beta)
             {
-                const auto beta_ptr = reinterpret_cast<float *>(beta.ptr() + id.x() * src_stride_x + id.y() * beta_stride_y + id[3] * beta_stride_w);
-                vst1q_f32(beta_ptr, vaddq_f32(vld1q_f32(beta_ptr), abs_vals0));
-                vst1q_f32(beta_ptr + 4, vaddq_f32(vld1q_f32(beta_ptr + 4), abs_vals1));
+                accumulate_abs(in_ptr, beta_ptr, width);
             }
         }
-    }, output);
-    
-    // Normalize alpha values
-    if(_alpha != nullptr)
-    {
-        for(size_t i = 0; i < _alpha->info()->dimension(0); ++i)
+
+        if(calc_beta)
         {
-            *reinterpret_cast<float *>(_alpha->ptr_to_element(Coordinates(i))) /= _input->info()->tensor_shape().total_size_lower(3);
+            scale_row(beta_ptr, width, 1.f / num_channels);
         }
-    }
-    
-    // Normalize beta values
-    if(_beta != nullptr)
-    {
-        size_t num_batches = 1;
-        Coordinates coords(0, 0);
-        if(_beta->info()->num_dimensions() > 3)
+        if(calc_partials)
         {
-            coords.set(2, 0);
-            coords.set(3, 0);
-            num_batches = _beta->info()->dimension(3);
+            *reinterpret_cast<float *>(partial_sums.ptr()) = sum;
         }
+    },
+    input, output, partial_sums, beta);
+}
 
-        for(size_t b = 0; b < num_batches; ++b)
-        {
-            for(size_t y = 0; y < _beta->info()->dimension(1); ++y)
-            {
-                coords.set(1, y);
-                for(size_t x = 0; x < _beta->info()->dimension(0); ++x)
-                {
-                    coords.set(0, x);
-                    *reinterpret_cast<float *>(_beta->ptr_to_element(coords)) /= _input->info()->dimension(2);
-                }
-            }
+void NEBinarySignKernel::binary_sign_nhwc(const Window &window)
+{
+    const unsigned int num_channels  = _input->info()->dimension(0);
+    const unsigned int num_bytes     = _output->info()->dimension(0);
+    const bool         calc_partials = _partial_sums != nullptr;
+    const bool         calc_beta     = _beta != nullptr;
 
-            coords.set(3, b + 1);
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+    Iterator partial_sums = calc_partials ? Iterator(_partial_sums, window) : Iterator();
+    Iterator beta         = calc_beta ? Iterator(_beta, window) : Iterator();
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto out_ptr = output.ptr();
+
+        const float sum = detail::pack_signs_row(in_ptr, out_ptr, num_channels, num_bytes);
+
+        if(calc_partials)
+        {
+            *reinterpret_cast<float *>(partial_sums.ptr()) = sum;
         }
-    }
+        if(calc_beta)
+        {
+            *reinterpret_cast<float *>(beta.ptr()) = sum / num_channels;
+        }
+    },
+    input, output, partial_sums, beta);
 }
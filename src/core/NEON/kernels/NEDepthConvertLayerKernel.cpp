@@ -48,8 +48,9 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, C
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8, DataType::U8, DataType::S16, DataType::U16, DataType::U32, DataType::S32, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(shift >= 8);
 
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::QASYMM8 && (output->data_type() != DataType::F16 && output->data_type() != DataType::F32),
-                                    "Only data_types supported [in] QASYMM8 -> [out] F16, F32");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::QASYMM8 && (output->data_type() != DataType::S16 && output->data_type() != DataType::F16
+                                                                               && output->data_type() != DataType::F32),
+                                    "Only data_types supported [in] QASYMM8 -> [out] S16, F16, F32");
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::U8 && (output->data_type() != DataType::S16 && output->data_type() != DataType::U16
                                                                            && output->data_type() != DataType::S32),
@@ -142,6 +143,21 @@ void NEDepthConvertLayerKernel::run(const Window &window, const ThreadInfo &info
         {
             switch(_output->info()->data_type())
             {
+                /* Up-conversion QASYMM8 -> S16, only the offset is removed */
+                case DataType::S16:
+                {
+                    const int16x8_t offset = vdupq_n_s16(static_cast<int16_t>(_input->info()->quantization_info().offset));
+
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const uint8x16_t texels_u8 = vld1q_u8(input.ptr());
+
+                        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(texels_u8))), offset));
+                        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(texels_u8))), offset));
+                    },
+                    input, output);
+                    break;
+                }
                 /* Up-conversion QASYMM8 -> F32 */
                 case DataType::F32:
                 {
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDepthwiseConvolutionLayerNativeKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Byte offsets of an input element and of the weight it is multiplied with */
+struct TapOffsets
+{
+    size_t input;   /**< Offset of the element in the input batch */
+    size_t weights; /**< Offset of the weight in the weights tensor */
+};
+
+/** Compute the range of kernel elements along one dimension that read inside the input
+ *
+ * @param[in] start       Input coordinate read by the first kernel element. Negative when it falls in the padding.
+ * @param[in] dilation    Dilation along the dimension
+ * @param[in] kernel_size Kernel size along the dimension
+ * @param[in] input_size  Input size along the dimension
+ *
+ * @return The first kernel element inside the input and one past the last one
+ */
+inline std::pair<int, int> kernel_range(int start, int dilation, int kernel_size, int input_size)
+{
+    const int first = (start < 0) ? std::min(kernel_size, (-start + dilation - 1) / dilation) : 0;
+    const int last  = std::min(kernel_size, std::max(0, (input_size - start + dilation - 1) / dilation));
+    return std::make_pair(first, std::max(first, last));
+}
+
+/** Iterate over the output pixels of the window and call @p compute with the kernel elements reading inside the input
+ *
+ * The padding never contributes to the accumulation, so the kernel elements falling in it are simply dropped.
+ */
+template <typename F>
+void depthwise_loop(const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info, const Size2D &dilation, const Window &window, const F &compute)
+{
+    const int input_w    = input->info()->dimension(1);
+    const int input_h    = input->info()->dimension(2);
+    const int kernel_w   = weights->info()->dimension(1);
+    const int kernel_h   = weights->info()->dimension(2);
+    const int stride_x   = conv_info.stride().first;
+    const int stride_y   = conv_info.stride().second;
+    const int pad_left   = conv_info.pad_left();
+    const int pad_top    = conv_info.pad_top();
+    const int dilation_x = dilation.x();
+    const int dilation_y = dilation.y();
+
+    const size_t input_stride_x   = input->info()->strides_in_bytes()[1];
+    const size_t input_stride_y   = input->info()->strides_in_bytes()[2];
+    const size_t input_stride_b   = input->info()->strides_in_bytes()[3];
+    const size_t weights_stride_x = weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_y = weights->info()->strides_in_bytes()[2];
+
+    const uint8_t *input_first = input->buffer() + input->info()->offset_first_element_in_bytes();
+
+    std::vector<TapOffsets> taps;
+    taps.reserve(kernel_w * kernel_h);
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator out(output, win);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const int  input_x = id[1] * stride_x - pad_left;
+        const int  input_y = id[2] * stride_y - pad_top;
+        const auto range_x = kernel_range(input_x, dilation_x, kernel_w, input_w);
+        const auto range_y = kernel_range(input_y, dilation_y, kernel_h, input_h);
+
+        taps.clear();
+        for(int ky = range_y.first; ky < range_y.second; ++ky)
+        {
+            for(int kx = range_x.first; kx < range_x.second; ++kx)
+            {
+                taps.push_back(TapOffsets{ (input_y + ky * dilation_y) * input_stride_y + (input_x + kx * dilation_x) * input_stride_x,
+                                           ky * weights_stride_y + kx * weights_stride_x });
+            }
+        }
+
+        compute(input_first + id[3] * input_stride_b, taps, out.ptr());
+    },
+    out);
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                          unsigned int depth_multiplier, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(depth_multiplier == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(dilation.x() < 1 || dilation.y() < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input->dimension(0) * depth_multiplier);
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(1) - 1) * dilation.x() + 1 > input->dimension(1) + conv_info.pad_left() + conv_info.pad_right());
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(2) - 1) * dilation.y() + 1 > input->dimension(2) + conv_info.pad_top() + conv_info.pad_bottom());
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->data_type());
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_quantized, "The biases of a QASYMM8 depthwise convolution are added by the output stage");
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+    }
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier, dilation);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(output, DataLayout::NHWC);
+
+        if(is_quantized)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        }
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEDepthwiseConvolutionLayerNativeKernel::NEDepthwiseConvolutionLayerNativeKernel()
+    : _func(), _input(), _weights(), _biases(), _output(), _conv_info(), _depth_multiplier(1), _dilation()
+{
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                        unsigned int depth_multiplier, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    const bool        is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+    const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier, dilation);
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape).set_data_type(is_quantized ? DataType::S32 : input->info()->data_type()));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, depth_multiplier, dilation));
+
+    _input            = input;
+    _weights          = weights;
+    _biases           = biases;
+    _output           = output;
+    _conv_info        = conv_info;
+    _depth_multiplier = depth_multiplier;
+    _dilation         = dilation;
+
+    const bool has_biases = (biases != nullptr);
+
+    switch(input->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            _func = (depth_multiplier == 1) ? &NEDepthwiseConvolutionLayerNativeKernel::run_multiplier1_qasymm8 : &NEDepthwiseConvolutionLayerNativeKernel::run_generic_qasymm8;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            if(depth_multiplier == 1)
+            {
+                _func = has_biases ? &NEDepthwiseConvolutionLayerNativeKernel::run_multiplier1_fp<float16_t, 8, true> : &NEDepthwiseConvolutionLayerNativeKernel::run_multiplier1_fp<float16_t, 8, false>;
+            }
+            else
+            {
+                _func = has_biases ? &NEDepthwiseConvolutionLayerNativeKernel::run_generic_fp<float16_t, 8, true> : &NEDepthwiseConvolutionLayerNativeKernel::run_generic_fp<float16_t, 8, false>;
+            }
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F32:
+            if(depth_multiplier == 1)
+            {
+                _func = has_biases ? &NEDepthwiseConvolutionLayerNativeKernel::run_multiplier1_fp<float, 4, true> : &NEDepthwiseConvolutionLayerNativeKernel::run_multiplier1_fp<float, 4, false>;
+            }
+            else
+            {
+                _func = has_biases ? &NEDepthwiseConvolutionLayerNativeKernel::run_generic_fp<float, 4, true> : &NEDepthwiseConvolutionLayerNativeKernel::run_generic_fp<float, 4, false>;
+            }
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+            break;
+    }
+
+    // Configure kernel window: each iteration computes all the channels of one output pixel
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEDepthwiseConvolutionLayerNativeKernel::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
+                                                         const PadStrideInfo &conv_info, unsigned int depth_multiplier, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, biases, output, conv_info, depth_multiplier, dilation));
+    return Status{};
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+template <typename T, int S, bool has_biases>
+void NEDepthwiseConvolutionLayerNativeKernel::run_multiplier1_fp(const Window &window)
+{
+    using TagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+
+    const int      num_channels  = _output->info()->dimension(0);
+    const uint8_t *weights_first = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const T       *biases_ptr    = has_biases ? reinterpret_cast<const T *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    depthwise_loop(_input, _weights, _output, _conv_info, _dilation, window, [&](const uint8_t *input_batch, const std::vector<TapOffsets> &taps, uint8_t *output_ptr)
+    {
+        auto out = reinterpret_cast<T *>(output_ptr);
+
+        int c = 0;
+        for(; c <= (num_channels - S); c += S)
+        {
+            auto acc = has_biases ? wrapper::vloadq(biases_ptr + c) : wrapper::vdup_n(static_cast<T>(0), TagType{});
+            for(const auto &tap : taps)
+            {
+                const auto in = wrapper::vloadq(reinterpret_cast<const T *>(input_batch + tap.input) + c);
+                const auto w  = wrapper::vloadq(reinterpret_cast<const T *>(weights_first + tap.weights) + c);
+                acc           = wrapper::vmla(acc, in, w);
+            }
+            wrapper::vstore(out + c, acc);
+        }
+
+        // Compute left-over elements
+        for(; c < num_channels; ++c)
+        {
+            T acc = has_biases ? biases_ptr[c] : static_cast<T>(0);
+            for(const auto &tap : taps)
+            {
+                acc += *(reinterpret_cast<const T *>(input_batch + tap.input) + c) * *(reinterpret_cast<const T *>(weights_first + tap.weights) + c);
+            }
+            out[c] = acc;
+        }
+    });
+}
+
+template <typename T, int S, bool has_biases>
+void NEDepthwiseConvolutionLayerNativeKernel::run_generic_fp(const Window &window)
+{
+    using TagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+
+    const int      num_channels  = _input->info()->dimension(0);
+    const int      multiplier    = _depth_multiplier;
+    const uint8_t *weights_first = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const T       *biases_ptr    = has_biases ? reinterpret_cast<const T *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    depthwise_loop(_input, _weights, _output, _conv_info, _dilation, window, [&](const uint8_t *input_batch, const std::vector<TapOffsets> &taps, uint8_t *output_ptr)
+    {
+        for(int c = 0; c < num_channels; ++c)
+        {
+            // The output channels generated from a same input channel are contiguous
+            auto out = reinterpret_cast<T *>(output_ptr) + c * multiplier;
+
+            int m = 0;
+            for(; m <= (multiplier - S); m += S)
+            {
+                const int oc  = c * multiplier + m;
+                auto      acc = has_biases ? wrapper::vloadq(biases_ptr + oc) : wrapper::vdup_n(static_cast<T>(0), TagType{});
+                for(const auto &tap : taps)
+                {
+                    const auto in = wrapper::vdup_n(*(reinterpret_cast<const T *>(input_batch + tap.input) + c), TagType{});
+                    const auto w  = wrapper::vloadq(reinterpret_cast<const T *>(weights_first + tap.weights) + oc);
+                    acc           = wrapper::vmla(acc, in, w);
+                }
+                wrapper::vstore(out + m, acc);
+            }
+
+            // Compute left-over elements
+            for(; m < multiplier; ++m)
+            {
+                const int oc  = c * multiplier + m;
+                T         acc = has_biases ? biases_ptr[oc] : static_cast<T>(0);
+                for(const auto &tap : taps)
+                {
+                    acc += *(reinterpret_cast<const T *>(input_batch + tap.input) + c) * *(reinterpret_cast<const T *>(weights_first + tap.weights) + oc);
+                }
+                out[m] = acc;
+            }
+        }
+    });
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::run_multiplier1_qasymm8(const Window &window)
+{
+    const int      num_channels   = _output->info()->dimension(0);
+    const uint8_t *weights_first  = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const int32_t  input_offset   = _input->info()->quantization_info().offset;
+    const int32_t  weights_offset = _weights->info()->quantization_info().offset;
+
+    const int16x8_t input_offset_s16   = vdupq_n_s16(static_cast<int16_t>(input_offset));
+    const int16x8_t weights_offset_s16 = vdupq_n_s16(static_cast<int16_t>(weights_offset));
+
+    depthwise_loop(_input, _weights, _output, _conv_info, _dilation, window, [&](const uint8_t *input_batch, const std::vector<TapOffsets> &taps, uint8_t *output_ptr)
+    {
+        auto out = reinterpret_cast<int32_t *>(output_ptr);
+
+        int c = 0;
+        for(; c <= (num_channels - 8); c += 8)
+        {
+            int32x4_t acc_low  = vdupq_n_s32(0);
+            int32x4_t acc_high = vdupq_n_s32(0);
+            for(const auto &tap : taps)
+            {
+                // Widen to 16 bit and remove the offsets: the differences fit in a signed 16 bit integer
+                const int16x8_t in = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input_batch + tap.input + c))), input_offset_s16);
+                const int16x8_t w  = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(weights_first + tap.weights + c))), weights_offset_s16);
+                acc_low            = vmlal_s16(acc_low, vget_low_s16(in), vget_low_s16(w));
+                acc_high           = vmlal_s16(acc_high, vget_high_s16(in), vget_high_s16(w));
+            }
+            vst1q_s32(out + c, acc_low);
+            vst1q_s32(out + c + 4, acc_high);
+        }
+
+        // Compute left-over elements
+        for(; c < num_channels; ++c)
+        {
+            int32_t acc = 0;
+            for(const auto &tap : taps)
+            {
+                acc += (static_cast<int32_t>(*(input_batch + tap.input + c)) - input_offset) * (static_cast<int32_t>(*(weights_first + tap.weights + c)) - weights_offset);
+            }
+            out[c] = acc;
+        }
+    });
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::run_generic_qasymm8(const Window &window)
+{
+    const int      num_channels   = _input->info()->dimension(0);
+    const int      multiplier     = _depth_multiplier;
+    const uint8_t *weights_first  = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const int32_t  input_offset   = _input->info()->quantization_info().offset;
+    const int32_t  weights_offset = _weights->info()->quantization_info().offset;
+
+    const int16x8_t weights_offset_s16 = vdupq_n_s16(static_cast<int16_t>(weights_offset));
+
+    depthwise_loop(_input, _weights, _output, _conv_info, _dilation, window, [&](const uint8_t *input_batch, const std::vector<TapOffsets> &taps, uint8_t *output_ptr)
+    {
+        for(int c = 0; c < num_channels; ++c)
+        {
+            // The output channels generated from a same input channel are contiguous
+            auto out = reinterpret_cast<int32_t *>(output_ptr) + c * multiplier;
+
+            int m = 0;
+            for(; m <= (multiplier - 8); m += 8)
+            {
+                const int oc       = c * multiplier + m;
+                int32x4_t acc_low  = vdupq_n_s32(0);
+                int32x4_t acc_high = vdupq_n_s32(0);
+                for(const auto &tap : taps)
+                {
+                    const int16_t   in = static_cast<int16_t>(static_cast<int32_t>(*(input_batch + tap.input + c)) - input_offset);
+                    const int16x8_t w  = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(weights_first + tap.weights + oc))), weights_offset_s16);
+                    acc_low            = vmlal_n_s16(acc_low, vget_low_s16(w), in);
+                    acc_high           = vmlal_n_s16(acc_high, vget_high_s16(w), in);
+                }
+                vst1q_s32(out + m, acc_low);
+                vst1q_s32(out + m + 4, acc_high);
+            }
+
+            // Compute left-over elements
+            for(; m < multiplier; ++m)
+            {
+                const int oc  = c * multiplier + m;
+                int32_t   acc = 0;
+                for(const auto &tap : taps)
+                {
+                    acc += (static_cast<int32_t>(*(input_batch + tap.input + c)) - input_offset) * (static_cast<int32_t>(*(weights_first + tap.weights + oc)) - weights_offset);
+                }
+                out[m] = acc;
+            }
+        }
+    });
+}
+} // namespace arm_compute
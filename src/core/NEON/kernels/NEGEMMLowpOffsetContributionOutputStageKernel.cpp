@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMMLowpOffsetContributionOutputStageKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEAsymm.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *mm_result, const ITensorInfo *vector_sum_col, const ITensorInfo *vector_sum_row, const ITensorInfo *bias, const ITensorInfo *output,
+                          int32_t a_offset, int32_t b_offset, const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mm_result, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_stage.type != GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, "Only QUANTIZE_DOWN_FIXEDPOINT output stage is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_max_bound > 255);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_min_bound < 0 || output_stage.gemmlowp_min_bound > output_stage.gemmlowp_max_bound);
+
+    // Check biases if exist
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(mm_result, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(mm_result->dimension(0) != bias->dimension(0));
+    }
+
+    // If a_offset == 0, vector_sum_col can be a nullptr
+    if(a_offset != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(vector_sum_col);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(vector_sum_col, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(vector_sum_col->dimension(0) != mm_result->dimension(0));
+    }
+
+    // If b_offset == 0, vector_sum_row can be a nullptr
+    if(b_offset != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(vector_sum_row);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(vector_sum_row, 1, DataType::S32);
+
+        // Check if input is a 3D reinterpretation
+        const bool reinterpret_as_3d = mm_result->num_dimensions() > 1 && mm_result->tensor_shape().y() != vector_sum_row->tensor_shape().x();
+
+        // Validate input
+        ARM_COMPUTE_RETURN_ERROR_ON(reinterpret_as_3d && vector_sum_row->dimension(0) != (mm_result->dimension(1) * mm_result->dimension(2)));
+        ARM_COMPUTE_RETURN_ERROR_ON(!reinterpret_as_3d && vector_sum_row->dimension(0) != mm_result->dimension(1));
+
+        TensorShape output_shape = mm_result->tensor_shape();
+        if(output_shape.num_dimensions() > 1)
+        {
+            const unsigned int output_batch_idx = reinterpret_as_3d ? 3 : 2;
+
+            TensorShape vector_sum_row_shape = vector_sum_row->tensor_shape();
+            vector_sum_row_shape.collapse_from(1);
+            output_shape.collapse_from(output_batch_idx);
+
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(vector_sum_row_shape[1] != output_shape[output_batch_idx],
+                                            "mm_result tensor must have the same number of batches of output tensor");
+
+            if(a_offset != 0)
+            {
+                TensorShape vector_sum_col_shape = vector_sum_col->tensor_shape();
+                vector_sum_col_shape.collapse_from(1);
+
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(vector_sum_col_shape[1] != 1 && vector_sum_col_shape[1] != vector_sum_row_shape[1],
+                                                "vector_sum_col tensor must have the same number of batches of vector_sum_row_shape or the number of batches must be set to 1");
+            }
+        }
+    }
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(mm_result, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *mm_result, ITensorInfo *output)
+{
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, mm_result->clone()->set_data_type(DataType::QASYMM8));
+
+    // Configure kernel window
+    Window win = calculate_max_window(*mm_result, Steps());
+
+    // NEGEMMLowpOffsetContributionOutputStageKernel doesn't need padding so update_window_and_padding() can be skipped
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+template <bool is_gemm3d, bool is_bounded_relu>
+void NEGEMMLowpOffsetContributionOutputStageKernel::run_internal(const Window &window)
+{
+    const int32x4_t  result_offset_s32 = vdupq_n_s32(_output_stage.gemmlowp_offset);
+    const int        multiplier        = _output_stage.gemmlowp_multiplier;
+    const int32_t    shift             = _output_stage.gemmlowp_shift;
+    const uint8x16_t min_u8            = vdupq_n_u8(static_cast<uint8_t>(_output_stage.gemmlowp_min_bound));
+    const uint8x16_t max_u8            = vdupq_n_u8(static_cast<uint8_t>(_output_stage.gemmlowp_max_bound));
+
+    ARM_COMPUTE_UNUSED(min_u8);
+    ARM_COMPUTE_UNUSED(max_u8);
+
+    const int  window_step_x  = 16;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    const int height_input = is_gemm3d ? _mm_result->info()->dimension(1) : 0;
+    const int depth_input  = is_gemm3d ? _mm_result->info()->dimension(2) : 1;
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator mm_result_it(_mm_result, win_collapsed);
+    Iterator out_it(_output, win_collapsed);
+
+    // The reduction vectors and the bias are indexed directly as they are not sliced like the output
+    const uint8_t *sum_col_base = (_vector_sum_col != nullptr) ? _vector_sum_col->buffer() + _vector_sum_col->info()->offset_first_element_in_bytes() : nullptr;
+    const uint8_t *sum_row_base = (_vector_sum_row != nullptr) ? _vector_sum_row->buffer() + _vector_sum_row->info()->offset_first_element_in_bytes() : nullptr;
+    const auto     bias_ptr     = (_bias != nullptr) ? reinterpret_cast<const int32_t *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    const size_t sum_col_batch_stride = (_vector_sum_col != nullptr && _slide_vector_sum_col) ? _vector_sum_col->info()->strides_in_bytes().y() : 0;
+    const size_t sum_row_batch_stride = (_vector_sum_row != nullptr) ? _vector_sum_row->info()->strides_in_bytes().y() : 0;
+
+    execute_window_loop(win_collapsed, [&](const Coordinates & id)
+    {
+        const int batch_id = id.z() / depth_input;
+
+        const auto sum_col_ptr = (_a_offset != 0) ? reinterpret_cast<const int32_t *>(sum_col_base + batch_id * sum_col_batch_stride) : nullptr;
+
+        // The b_offset term, like the k_offset term, is constant along the row
+        int32_t row_offset = _k_offset;
+        if(_b_offset != 0)
+        {
+            const auto sum_row_ptr = reinterpret_cast<const int32_t *>(sum_row_base + batch_id * sum_row_batch_stride);
+            row_offset += *(sum_row_ptr + id.y() + (id.z() % depth_input) * height_input) * _b_offset;
+        }
+        const int32x4_t row_offset_s32 = vdupq_n_s32(row_offset);
+
+        const auto mm_result_ptr = reinterpret_cast<const int32_t *>(mm_result_it.ptr());
+
+        // Compute 16 elements per iteration
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            int32x4x4_t in_s32 =
+            {
+                {
+                    vaddq_s32(vld1q_s32(mm_result_ptr + x + 0), row_offset_s32),
+                    vaddq_s32(vld1q_s32(mm_result_ptr + x + 4), row_offset_s32),
+                    vaddq_s32(vld1q_s32(mm_result_ptr + x + 8), row_offset_s32),
+                    vaddq_s32(vld1q_s32(mm_result_ptr + x + 12), row_offset_s32)
+                }
+            };
+
+            // Add the a_offset term
+            if(sum_col_ptr != nullptr)
+            {
+                in_s32.val[0] = vmlaq_n_s32(in_s32.val[0], vld1q_s32(sum_col_ptr + x + 0), _a_offset);
+                in_s32.val[1] = vmlaq_n_s32(in_s32.val[1], vld1q_s32(sum_col_ptr + x + 4), _a_offset);
+                in_s32.val[2] = vmlaq_n_s32(in_s32.val[2], vld1q_s32(sum_col_ptr + x + 8), _a_offset);
+                in_s32.val[3] = vmlaq_n_s32(in_s32.val[3], vld1q_s32(sum_col_ptr + x + 12), _a_offset);
+            }
+
+            // Add the bias
+            if(bias_ptr != nullptr)
+            {
+                in_s32.val[0] = vaddq_s32(in_s32.val[0], vld1q_s32(bias_ptr + x + 0));
+                in_s32.val[1] = vaddq_s32(in_s32.val[1], vld1q_s32(bias_ptr + x + 4));
+                in_s32.val[2] = vaddq_s32(in_s32.val[2], vld1q_s32(bias_ptr + x + 8));
+                in_s32.val[3] = vaddq_s32(in_s32.val[3], vld1q_s32(bias_ptr + x + 12));
+            }
+
+            vst1q_u8(out_it.ptr() + x, finalize_quantization<is_bounded_relu>(in_s32, multiplier, shift, result_offset_s32, min_u8, max_u8));
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            int32_t in_value = *(mm_result_ptr + x) + row_offset;
+
+            if(sum_col_ptr != nullptr)
+            {
+                in_value += *(sum_col_ptr + x) * _a_offset;
+            }
+
+            if(bias_ptr != nullptr)
+            {
+                in_value += *(bias_ptr + x);
+            }
+
+            // Finalize and store the result
+            *(out_it.ptr() + x) = finalize_quantization<is_bounded_relu>(vdupq_n_s32(in_value), multiplier, shift, result_offset_s32,
+                                                                         static_cast<uint8_t>(_output_stage.gemmlowp_min_bound),
+                                                                         static_cast<uint8_t>(_output_stage.gemmlowp_max_bound));
+        }
+    },
+    mm_result_it, out_it);
+}
+
+NEGEMMLowpOffsetContributionOutputStageKernel::NEGEMMLowpOffsetContributionOutputStageKernel()
+    : _func(nullptr), _mm_result(nullptr), _vector_sum_col(nullptr), _vector_sum_row(nullptr), _bias(nullptr), _output(nullptr), _a_offset(0), _b_offset(0), _k_offset(0), _slide_vector_sum_col(true),
+      _output_stage()
+{
+}
+
+void NEGEMMLowpOffsetContributionOutputStageKernel::configure(const ITensor *mm_result, const ITensor *vector_sum_col, const ITensor *vector_sum_row, const ITensor *bias, ITensor *output,
+                                                              int32_t k, int32_t a_offset, int32_t b_offset, const GEMMLowpOutputStageInfo &output_stage)
+{
+    // Perform validate step
+    ARM_COMPUTE_ERROR_ON_NULLPTR(mm_result, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(mm_result->info(),
+                                                  vector_sum_col != nullptr ? vector_sum_col->info() : nullptr, // NOLINT
+                                                  vector_sum_row != nullptr ? vector_sum_row->info() : nullptr, // NOLINT
+                                                  bias != nullptr ? bias->info() : nullptr,                     // NOLINT
+                                                  output->info(), a_offset, b_offset, output_stage));           // NOLINT
+
+    _mm_result      = mm_result;
+    _vector_sum_col = vector_sum_col;
+    _vector_sum_row = vector_sum_row;
+    _bias           = bias;
+    _output         = output;
+    _a_offset       = a_offset;
+    _b_offset       = b_offset;
+    _k_offset       = a_offset * b_offset * k;
+    _output_stage   = output_stage;
+
+    // If a_offset == 0, vector_sum_col can be a nullptr
+    if(a_offset != 0)
+    {
+        // Check if vector_sum_col_shape should be slidden or not
+        // Don't slide vector_sum_col_shape along the y dimension if vector_sum_col_shape has just 1 dimension and vector_sum_row_shape more than 1
+        // This scenario can happen when the the matrix multiplication is used to perform a convolution operation
+        _slide_vector_sum_col = vector_sum_col->info()->tensor_shape().num_dimensions() > 1;
+    }
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(mm_result->info(), output->info());
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+
+    // Check if input is a 3D reinterpretation
+    const bool reinterpret_as_3d = vector_sum_row != nullptr
+                                   && mm_result->info()->num_dimensions() > 1
+                                   && mm_result->info()->tensor_shape().y() != vector_sum_row->info()->tensor_shape().x();
+
+    // Check if we need to clamp the result using min and max
+    const int  min             = output_stage.gemmlowp_min_bound;
+    const int  max             = output_stage.gemmlowp_max_bound;
+    const bool is_bounded_relu = ((min != max) && !(min == 0 && max == 255));
+
+    if(reinterpret_as_3d)
+    {
+        _func = is_bounded_relu ? &NEGEMMLowpOffsetContributionOutputStageKernel::run_internal<true, true> : &NEGEMMLowpOffsetContributionOutputStageKernel::run_internal<true, false>;
+    }
+    else
+    {
+        _func = is_bounded_relu ? &NEGEMMLowpOffsetContributionOutputStageKernel::run_internal<false, true> : &NEGEMMLowpOffsetContributionOutputStageKernel::run_internal<false, false>;
+    }
+}
+
+Status NEGEMMLowpOffsetContributionOutputStageKernel::validate(const ITensorInfo *mm_result, const ITensorInfo *vector_sum_col, const ITensorInfo *vector_sum_row, const ITensorInfo *bias,
+                                                               const ITensorInfo *output, int32_t a_offset, int32_t b_offset, const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(mm_result, output);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(mm_result, vector_sum_col, vector_sum_row, bias, output, a_offset, b_offset, output_stage));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(mm_result->clone().get(), output->clone().get()).first);
+
+    return Status{};
+}
+
+void NEGEMMLowpOffsetContributionOutputStageKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    (this->*_func)(window);
+}
@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+/** Pointers to the data of one batch of the cell, nullptr for the optional inputs which are not used */
+template <typename T>
+struct CellRow
+{
+    const T *input_gate;
+    const T *forget_gate;
+    const T *cell_gate;
+    const T *output_gate;
+    const T *input_gate_bias;
+    const T *forget_gate_bias;
+    const T *cell_bias;
+    const T *output_gate_bias;
+    const T *cell_to_input_weights;
+    const T *cell_to_forget_weights;
+    const T *cell_to_output_weights;
+    const T *cell_state_in;
+    T       *cell_state_out;
+    T       *output_state;
+    T       *scratch_input_gate;
+    T       *scratch_cell_state;
+    T       *scratch_forget_gate;
+    T       *scratch_output_gate;
+};
+
+inline float activate(float x, const ActivationLayerInfo &info)
+{
+    if(!info.enabled())
+    {
+        return x;
+    }
+
+    const float a = info.a();
+    const float b = info.b();
+    switch(info.activation())
+    {
+        case ActivationFunction::ABS:
+            return std::abs(x);
+        case ActivationFunction::LINEAR:
+            return a * x + b;
+        case ActivationFunction::LOGISTIC:
+            return 1.f / (1.f + std::exp(-x));
+        case ActivationFunction::RELU:
+            return std::max(0.f, x);
+        case ActivationFunction::BOUNDED_RELU:
+            return std::min(a, std::max(0.f, x));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return std::min(a, std::max(b, x));
+        case ActivationFunction::LEAKY_RELU:
+            return (x > 0.f) ? x : a * x;
+        case ActivationFunction::SOFT_RELU:
+            return std::log(1.f + std::exp(x));
+        case ActivationFunction::SQRT:
+            return std::sqrt(x);
+        case ActivationFunction::SQUARE:
+            return x * x;
+        case ActivationFunction::TANH:
+            return a * std::tanh(b * x);
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+            return x;
+    }
+}
+
+inline float logistic(float x)
+{
+    return 1.f / (1.f + std::exp(-x));
+}
+
+template <typename T>
+inline void compute_cell(const CellRow<T> &row, int u, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    const float cell_state_in = row.cell_state_in[u];
+
+    float forget_gate = static_cast<float>(row.forget_gate[u]) + static_cast<float>(row.forget_gate_bias[u]);
+    if(row.cell_to_forget_weights != nullptr)
+    {
+        forget_gate += cell_state_in * static_cast<float>(row.cell_to_forget_weights[u]);
+    }
+    forget_gate = logistic(forget_gate);
+
+    float input_gate = 1.f - forget_gate;
+    if(row.input_gate != nullptr)
+    {
+        input_gate = static_cast<float>(row.input_gate[u]) + static_cast<float>(row.input_gate_bias[u]);
+        if(row.cell_to_input_weights != nullptr)
+        {
+            input_gate += cell_state_in * static_cast<float>(row.cell_to_input_weights[u]);
+        }
+        input_gate = logistic(input_gate);
+    }
+
+    float cell_state = activate(static_cast<float>(row.cell_gate[u]) + static_cast<float>(row.cell_bias[u]), activation_info) * input_gate + cell_state_in * forget_gate;
+    if(cell_threshold != 0.f)
+    {
+        cell_state = std::min(std::max(cell_state, -cell_threshold), cell_threshold);
+    }
+
+    float output_gate = static_cast<float>(row.output_gate[u]) + static_cast<float>(row.output_gate_bias[u]);
+    if(row.cell_to_output_weights != nullptr)
+    {
+        output_gate += cell_state * static_cast<float>(row.cell_to_output_weights[u]);
+    }
+    output_gate = logistic(output_gate);
+
+    row.cell_state_out[u]      = static_cast<T>(cell_state);
+    row.output_state[u]        = static_cast<T>(output_gate * activate(cell_state, activation_info));
+    row.scratch_cell_state[u]  = static_cast<T>(cell_state);
+    row.scratch_forget_gate[u] = static_cast<T>(forget_gate);
+    row.scratch_output_gate[u] = static_cast<T>(output_gate);
+    if(row.scratch_input_gate != nullptr)
+    {
+        row.scratch_input_gate[u] = static_cast<T>(input_gate);
+    }
+}
+
+inline bool is_vectorizable(const ActivationLayerInfo &info)
+{
+    switch(info.activation())
+    {
+        case ActivationFunction::LINEAR:
+        case ActivationFunction::LOGISTIC:
+        case ActivationFunction::RELU:
+        case ActivationFunction::BOUNDED_RELU:
+        case ActivationFunction::LU_BOUNDED_RELU:
+        case ActivationFunction::TANH:
+            return true;
+        default:
+            return !info.enabled();
+    }
+}
+
+inline float32x4_t vlogistic(float32x4_t x)
+{
+    return vinvq_f32(vaddq_f32(vdupq_n_f32(1.f), vexpq_f32(vnegq_f32(x))));
+}
+
+inline float32x4_t vactivate(float32x4_t x, const ActivationLayerInfo &info)
+{
+    if(!info.enabled())
+    {
+        return x;
+    }
+
+    const float32x4_t a = vdupq_n_f32(info.a());
+    const float32x4_t b = vdupq_n_f32(info.b());
+    switch(info.activation())
+    {
+        case ActivationFunction::LINEAR:
+            return vmlaq_f32(b, a, x);
+        case ActivationFunction::LOGISTIC:
+            return vlogistic(x);
+        case ActivationFunction::RELU:
+            return vmaxq_f32(vdupq_n_f32(0.f), x);
+        case ActivationFunction::BOUNDED_RELU:
+            return vminq_f32(a, vmaxq_f32(vdupq_n_f32(0.f), x));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return vminq_f32(a, vmaxq_f32(b, x));
+        case ActivationFunction::TANH:
+            return vmulq_f32(a, vtanhq_f32(vmulq_f32(b, x)));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+            return x;
+    }
+}
+
+/** Computes the cells of a row four at a time
+ *
+ * @return the number of cells computed
+ */
+inline int compute_cells_vector(const CellRow<float> &row, int num_units, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    if(!is_vectorizable(activation_info))
+    {
+        return 0;
+    }
+
+    const float32x4_t one           = vdupq_n_f32(1.f);
+    const float32x4_t max_threshold = vdupq_n_f32(cell_threshold);
+    const float32x4_t min_threshold = vdupq_n_f32(-cell_threshold);
+
+    int u = 0;
+    for(; u <= num_units - 4; u += 4)
+    {
+        const float32x4_t cell_state_in = vld1q_f32(row.cell_state_in + u);
+
+        float32x4_t forget_gate = vaddq_f32(vld1q_f32(row.forget_gate + u), vld1q_f32(row.forget_gate_bias + u));
+        if(row.cell_to_forget_weights != nullptr)
+        {
+            forget_gate = vmlaq_f32(forget_gate, cell_state_in, vld1q_f32(row.cell_to_forget_weights + u));
+        }
+        forget_gate = vlogistic(forget_gate);
+
+        float32x4_t input_gate = vsubq_f32(one, forget_gate);
+        if(row.input_gate != nullptr)
+        {
+            input_gate = vaddq_f32(vld1q_f32(row.input_gate + u), vld1q_f32(row.input_gate_bias + u));
+            if(row.cell_to_input_weights != nullptr)
+            {
+                input_gate = vmlaq_f32(input_gate, cell_state_in, vld1q_f32(row.cell_to_input_weights + u));
+            }
+            input_gate = vlogistic(input_gate);
+        }
+
+        const float32x4_t cell_input = vactivate(vaddq_f32(vld1q_f32(row.cell_gate + u), vld1q_f32(row.cell_bias + u)), activation_info);
+        float32x4_t       cell_state = vmlaq_f32(vmulq_f32(cell_state_in, forget_gate), cell_input, input_gate);
+        if(cell_threshold != 0.f)
+        {
+            cell_state = vminq_f32(vmaxq_f32(cell_state, min_threshold), max_threshold);
+        }
+
+        float32x4_t output_gate = vaddq_f32(vld1q_f32(row.output_gate + u), vld1q_f32(row.output_gate_bias + u));
+        if(row.cell_to_output_weights != nullptr)
+        {
+            output_gate = vmlaq_f32(output_gate, cell_state, vld1q_f32(row.cell_to_output_weights + u));
+        }
+        output_gate = vlogistic(output_gate);
+
+        vst1q_f32(row.cell_state_out + u, cell_state);
+        vst1q_f32(row.output_state + u, vmulq_f32(output_gate, vactivate(cell_state, activation_info)));
+        vst1q_f32(row.scratch_cell_state + u, cell_state);
+        vst1q_f32(row.scratch_forget_gate + u, forget_gate);
+        vst1q_f32(row.scratch_output_gate + u, output_gate);
+        if(row.scratch_input_gate != nullptr)
+        {
+            vst1q_f32(row.scratch_input_gate + u, input_gate);
+        }
+    }
+    return u;
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline int compute_cells_vector(const CellRow<float16_t> &row, int num_units, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_UNUSED(row, num_units, activation_info, cell_threshold);
+    return 0;
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+template <typename T>
+inline const T *vector_ptr(const ITensor *tensor)
+{
+    return (tensor != nullptr) ? reinterpret_cast<const T *>(tensor->ptr_to_element(Coordinates(0))) : nullptr;
+}
+
+Status validate_arguments(const ITensorInfo *gates,
+                          const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                          const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                          const ITensorInfo *cell_state_in, const ITensorInfo *cell_state_out, const ITensorInfo *output_state, const ITensorInfo *scratch_buffer,
+                          float cell_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(gates, forget_gate_bias, cell_bias, output_gate_bias, cell_state_in, cell_state_out, output_state, scratch_buffer);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gates, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, forget_gate_bias, cell_bias, output_gate_bias, cell_state_in, cell_state_out, output_state, scratch_buffer);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_gate_bias == nullptr && cell_to_input_weights != nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_threshold < 0.f);
+
+    const size_t num_units = cell_state_in->dimension(0);
+    const size_t num_gates = (input_gate_bias != nullptr) ? 4 : 3;
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(0) != num_gates * num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(1) != cell_state_in->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(gates, scratch_buffer);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, cell_state_out, output_state);
+
+    for(const ITensorInfo *vector : { input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias, cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights })
+    {
+        if(vector != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, vector);
+            ARM_COMPUTE_RETURN_ERROR_ON(vector->num_dimensions() > 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(vector->dimension(0) != num_units);
+        }
+    }
+
+    return Status{};
+}
+} // namespace
+
+NELSTMCellKernel::NELSTMCellKernel()
+    : _func(nullptr), _gates(nullptr), _input_gate_bias(nullptr), _forget_gate_bias(nullptr), _cell_bias(nullptr), _output_gate_bias(nullptr), _cell_to_input_weights(nullptr),
+      _cell_to_forget_weights(nullptr), _cell_to_output_weights(nullptr), _cell_state_in(nullptr), _cell_state_out(nullptr), _output_state(nullptr), _scratch_buffer(nullptr), _activation_info(),
+      _cell_threshold(0.f)
+{
+}
+
+void NELSTMCellKernel::configure(const ITensor *gates,
+                                 const ITensor *input_gate_bias, const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                                 const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights, const ITensor *cell_to_output_weights,
+                                 const ITensor *cell_state_in, ITensor *cell_state_out, ITensor *output_state, ITensor *scratch_buffer,
+                                 const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(gates, forget_gate_bias, cell_bias, output_gate_bias, cell_state_in, cell_state_out, output_state, scratch_buffer);
+    ARM_COMPUTE_ERROR_THROW_ON(NELSTMCellKernel::validate(gates->info(),
+                                                          (input_gate_bias != nullptr) ? input_gate_bias->info() : nullptr, forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(),
+                                                          (cell_to_input_weights != nullptr) ? cell_to_input_weights->info() : nullptr,
+                                                          (cell_to_forget_weights != nullptr) ? cell_to_forget_weights->info() : nullptr,
+                                                          (cell_to_output_weights != nullptr) ? cell_to_output_weights->info() : nullptr,
+                                                          cell_state_in->info(), cell_state_out->info(), output_state->info(), scratch_buffer->info(),
+                                                          activation_info, cell_threshold));
+
+    _gates                  = gates;
+    _input_gate_bias        = input_gate_bias;
+    _forget_gate_bias       = forget_gate_bias;
+    _cell_bias              = cell_bias;
+    _output_gate_bias       = output_gate_bias;
+    _cell_to_input_weights  = cell_to_input_weights;
+    _cell_to_forget_weights = cell_to_forget_weights;
+    _cell_to_output_weights = cell_to_output_weights;
+    _cell_state_in          = cell_state_in;
+    _cell_state_out         = cell_state_out;
+    _output_state           = output_state;
+    _scratch_buffer         = scratch_buffer;
+    _activation_info        = activation_info;
+    _cell_threshold         = cell_threshold;
+
+    switch(gates->info()->data_type())
+    {
+        case DataType::F32:
+            _func = &NELSTMCellKernel::run_cell<float>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NELSTMCellKernel::run_cell<float16_t>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+            break;
+    }
+
+    // Configure kernel window: each iteration computes all the cells of a batch
+    Window win = calculate_max_window(*cell_state_out->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    INEKernel::configure(win);
+}
+
+Status NELSTMCellKernel::validate(const ITensorInfo *gates,
+                                  const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                                  const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                                  const ITensorInfo *cell_state_in, const ITensorInfo *cell_state_out, const ITensorInfo *output_state, const ITensorInfo *scratch_buffer,
+                                  const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_UNUSED(activation_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(gates, input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias,
+                                                   cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights,
+                                                   cell_state_in, cell_state_out, output_state, scratch_buffer, cell_threshold));
+    return Status{};
+}
+
+template <typename T>
+void NELSTMCellKernel::run_cell(const Window &window)
+{
+    const int num_units = _cell_state_in->info()->dimension(0);
+    const int has_input = (_input_gate_bias != nullptr) ? 1 : 0;
+
+    CellRow<T> row{};
+    row.input_gate_bias        = vector_ptr<T>(_input_gate_bias);
+    row.forget_gate_bias       = vector_ptr<T>(_forget_gate_bias);
+    row.cell_bias              = vector_ptr<T>(_cell_bias);
+    row.output_gate_bias       = vector_ptr<T>(_output_gate_bias);
+    row.cell_to_input_weights  = vector_ptr<T>(_cell_to_input_weights);
+    row.cell_to_forget_weights = vector_ptr<T>(_cell_to_forget_weights);
+    row.cell_to_output_weights = vector_ptr<T>(_cell_to_output_weights);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const Coordinates row_id(0, id.y());
+
+        // Gates are stacked as [input, forget, cell, output] and the scratch buffer as [input, cell, forget, output]
+        const T *gates          = reinterpret_cast<const T *>(_gates->ptr_to_element(row_id));
+        T       *scratch        = reinterpret_cast<T *>(_scratch_buffer->ptr_to_element(row_id));
+        row.input_gate          = has_input ? gates : nullptr;
+        row.forget_gate         = gates + has_input * num_units;
+        row.cell_gate           = gates + (has_input + 1) * num_units;
+        row.output_gate         = gates + (has_input + 2) * num_units;
+        row.cell_state_in       = reinterpret_cast<const T *>(_cell_state_in->ptr_to_element(row_id));
+        row.cell_state_out      = reinterpret_cast<T *>(_cell_state_out->ptr_to_element(row_id));
+        row.output_state        = reinterpret_cast<T *>(_output_state->ptr_to_element(row_id));
+        row.scratch_input_gate  = has_input ? scratch : nullptr;
+        row.scratch_cell_state  = scratch + has_input * num_units;
+        row.scratch_forget_gate = scratch + (has_input + 1) * num_units;
+        row.scratch_output_gate = scratch + (has_input + 2) * num_units;
+
+        int u = compute_cells_vector(row, num_units, _activation_info, _cell_threshold);
+        for(; u < num_units; ++u)
+        {
+            compute_cell(row, u, _activation_info, _cell_threshold);
+        }
+    });
+}
+
+void NELSTMCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEPadLayerKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const PaddingList &padding, PaddingMode mode)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S8, DataType::QASYMM8,
+                                                         DataType::U16, DataType::S16, DataType::F16,
+                                                         DataType::U32, DataType::S32, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(padding.size() > TensorShape::num_max_dimensions);
+
+    for(size_t dim = 0; dim < padding.size() && mode != PaddingMode::CONSTANT; ++dim)
+    {
+        const size_t size    = input->dimension(dim);
+        const size_t max_pad = (mode == PaddingMode::REFLECT) ? size - 1 : size;
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(padding[dim].first > max_pad || padding[dim].second > max_pad, "Padding is too large for the selected mode");
+    }
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape expected_output_shape = arm_compute::misc::shape_calculator::compute_padded_shape(input->tensor_shape(), padding);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), expected_output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(input, output);
+    }
+
+    return Status{};
+}
+
+/** Maps a coordinate of the output, relative to the start of the input, to the input element it is mirrored from
+ *
+ * @param[in] coord Coordinate in the range [-size, 2 * size)
+ * @param[in] size  Size of the input in the dimension
+ * @param[in] mode  Either REFLECT or SYMMETRIC
+ *
+ * @return the coordinate of the input element
+ */
+inline int map_coordinate(int coord, int size, PaddingMode mode)
+{
+    const int repeat = (mode == PaddingMode::SYMMETRIC) ? 1 : 0;
+    if(coord < 0)
+    {
+        return -coord - repeat;
+    }
+    if(coord >= size)
+    {
+        return 2 * size - 2 + repeat - coord;
+    }
+    return coord;
+}
+} // namespace
+
+NEPadLayerKernel::NEPadLayerKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _padding(), _mode(PaddingMode::CONSTANT), _constant_row()
+{
+}
+
+void NEPadLayerKernel::configure(const ITensor *input, ITensor *output, const PaddingList &padding, const PixelValue &constant_value, PaddingMode mode)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    // Auto initialize output if not initialized
+    const TensorShape expected_output_shape = arm_compute::misc::shape_calculator::compute_padded_shape(input->info()->tensor_shape(), padding);
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(expected_output_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), padding, mode));
+
+    _input   = input;
+    _output  = output;
+    _padding = padding;
+    _padding.resize(TensorShape::num_max_dimensions, PaddingInfo(0, 0));
+    _mode    = mode;
+
+    switch(input->info()->element_size())
+    {
+        case 1:
+            _func = &NEPadLayerKernel::pad_rows<uint8_t>;
+            break;
+        case 2:
+            _func = &NEPadLayerKernel::pad_rows<uint16_t>;
+            break;
+        case 4:
+            _func = &NEPadLayerKernel::pad_rows<uint32_t>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+            break;
+    }
+
+    // Row of constants the borders are copied from
+    const size_t element_size = output->info()->element_size();
+    _constant_row.resize(output->info()->dimension(0) * element_size);
+    for(size_t i = 0; i < output->info()->dimension(0); ++i)
+    {
+        std::memcpy(_constant_row.data() + i * element_size, &constant_value.value, element_size);
+    }
+
+    // Configure kernel window: each iteration writes a whole row of the output
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    INEKernel::configure(win);
+}
+
+Status NEPadLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const PaddingList &padding, const PixelValue &constant_value, PaddingMode mode)
+{
+    ARM_COMPUTE_UNUSED(constant_value);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, padding, mode));
+    return Status{};
+}
+
+template <typename T>
+void NEPadLayerKernel::pad_rows(const Window &window)
+{
+    const ITensorInfo *input_info  = _input->info();
+    const ITensorInfo *output_info = _output->info();
+    const int          input_width = input_info->dimension(0);
+    const int          pad_left    = _padding[0].first;
+    const int          pad_right   = _padding[0].second;
+    const T           *constants   = reinterpret_cast<const T *>(_constant_row.data());
+
+    // The input is a view of the interior of the output, its rows are already in place
+    bool in_place = _input->buffer() == _output->buffer();
+    if(in_place)
+    {
+        size_t interior_offset = output_info->offset_first_element_in_bytes();
+        for(size_t dim = 0; dim < output_info->num_dimensions(); ++dim)
+        {
+            interior_offset += _padding[dim].first * output_info->strides_in_bytes()[dim];
+            in_place = in_place && (dim >= input_info->num_dimensions() || input_info->strides_in_bytes()[dim] == output_info->strides_in_bytes()[dim]);
+        }
+        in_place = in_place && interior_offset == input_info->offset_first_element_in_bytes();
+    }
+
+    Coordinates input_id;
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        T *output_row = reinterpret_cast<T *>(_output->ptr_to_element(id));
+
+        // Find the input row this output row is made of
+        bool is_border = false;
+        for(size_t dim = 1; dim < Coordinates::num_max_dimensions; ++dim)
+        {
+            const int size  = input_info->dimension(dim);
+            const int coord = id[dim] - static_cast<int>(_padding[dim].first);
+            if(coord < 0 || coord >= size)
+            {
+                is_border = true;
+                input_id.set(dim, (_mode == PaddingMode::CONSTANT) ? 0 : map_coordinate(coord, size, _mode));
+            }
+            else
+            {
+                input_id.set(dim, coord);
+            }
+        }
+        const bool is_mapped = is_border && _mode != PaddingMode::CONSTANT;
+
+        if(is_border && !is_mapped)
+        {
+            std::memcpy(output_row, constants, output_info->dimension(0) * sizeof(T));
+            return;
+        }
+
+        const T *input_row = reinterpret_cast<const T *>(_input->ptr_to_element(input_id));
+        if(is_mapped || !in_place)
+        {
+            std::memcpy(output_row + pad_left, input_row, input_width * sizeof(T));
+        }
+
+        if(_mode == PaddingMode::CONSTANT)
+        {
+            std::memcpy(output_row, constants, pad_left * sizeof(T));
+            std::memcpy(output_row + pad_left + input_width, constants, pad_right * sizeof(T));
+        }
+        else
+        {
+            for(int x = 0; x < pad_left; ++x)
+            {
+                output_row[x] = input_row[map_coordinate(x - pad_left, input_width, _mode)];
+            }
+            for(int x = 0; x < pad_right; ++x)
+            {
+                output_row[pad_left + input_width + x] = input_row[map_coordinate(input_width + x, input_width, _mode)];
+            }
+        }
+    });
+}
+
+void NEPadLayerKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/convolution/common/arm.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/winograd/winograd_gemm.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/winograd/transforms/kernel.hpp"
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+namespace winograd
+{
+  /* Float implementation for kernel transform F(4x4, 3x3) */
+  template <>
+  template <>
+  void WinogradGEMM<4, 4, 3, 3>::WeightsTransform<float16_t>::execute(
+    const int n_output_channels,
+    const int n_input_channels,
+    const float16_t* const input,  // NOTE: Data in HWIO order
+    float16_t* const output,
+    const int matrix_stride,
+    const int matrix_row_stride
+  )
+  {
+    // Get pointers to each cell of the weight tensor
+    const auto weight_col_stride = n_input_channels * n_output_channels;
+    const auto weight_row_stride = 3 * weight_col_stride;
+    const float16_t *inptrs[3][3];
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        inptrs[i][j] = input + i*weight_row_stride + j*weight_col_stride;
+      }
+    }
+
+    // For each input channel
+    for (int ic = 0; ic < n_input_channels; ic++)
+    {
+      float16_t *outptr = output + ic * matrix_row_stride;
+
+      // For each output channel
+      int channels_remaining = n_output_channels;
+#ifdef __aarch64__
+      for (; channels_remaining >= 8; channels_remaining -= 8)
+      {
+        // Matrices used and computed in this kernel
+        float16x8_t w[3][3], Ww[6][3], V[6][6];
+
+        // Read weights
+        for (int i = 0; i < 3; i++)
+        {
+          for (int j = 0; j < 3; j++)
+          {
+            w[i][j] = vld1q_f16(inptrs[i][j]);
+            inptrs[i][j] += 8;
+          }
+        }
+
+        // Compute the matrix W w
+        for (int j = 0; j < 3; j++)
+        {
+          // Ww[0][j] =  6*w[0][j];
+          Ww[0][j] = vmulq_n_f16(w[0][j], 6.0);
+
+          // Ww[1][j] = -4*w[0][j] + -4*w[1][j] + -4*w[2][j];
+          Ww[1][j] = vmulq_n_f16(vaddq_f16(vaddq_f16(w[0][j], w[1][j]), w[2][j]), -4.0);
+
+          // Ww[2][j] = -4*w[0][j] +  4*w[1][j] + -4*w[2][j];
+          Ww[2][j] = vmulq_n_f16(vsubq_f16(vsubq_f16(w[1][j], w[0][j]), w[2][j]), 4.0);
+
+          // Ww[3][j] =  1*w[0][j] +  2*w[1][j] +  4*w[2][j];
+          Ww[3][j] = vaddq_f16(vaddq_f16(w[0][j], vmulq_n_f16(w[1][j], 2.0f)), vmulq_n_f16(w[2][j], 4.0f));
+
+          // Ww[4][j] =  1*w[0][j] + -2*w[1][j] +  4*w[2][j];
+          Ww[4][j] = vaddq_f16(vsubq_f16(w[0][j], vmulq_n_f16(w[1][j], 2.0f)), vmulq_n_f16(w[2][j], 4.0f));
+
+          // Ww[5][j] = 24*w[2][j];
+          Ww[5][j] = vmulq_n_f16(w[2][j], 24.0f);
+        }
+
+        // Compute V = W w WT
+        for (int i = 0; i < 6; i++)
+        {
+          const float16_t recip576 = 1.0f / 576.0f;
+
+          // V[i][0] =  6*Ww[i][0];
+          V[i][0] = vmulq_n_f16(vmulq_n_f16(Ww[i][0], 6.0), recip576);
+
+          // V[i][1] = -4*Ww[i][0] + -4*Ww[i][1] + -4*Ww[i][2];
+          V[i][1] = vmulq_n_f16(vmulq_n_f16(vaddq_f16(vaddq_f16(Ww[i][0], Ww[i][1]), Ww[i][2]), -4.0), recip576);
+
+          // V[i][2] = -4*Ww[i][0] +  4*Ww[i][1] + -4*Ww[i][2];
+          V[i][2] = vmulq_n_f16(vmulq_n_f16(vsubq_f16(vsubq_f16(Ww[i][1], Ww[i][0]), Ww[i][2]), 4.0), recip576);
+
+          // V[i][3] =  1*Ww[i][0] +  2*Ww[i][1] +  4*Ww[i][2];
+          V[i][3] = vmulq_n_f16(vaddq_f16(vaddq_f16(Ww[i][0], vmulq_n_f16(Ww[i][1], 2.0f)), vmulq_n_f16(Ww[i][2], 4.0f)), recip576);
+
+          // V[i][4] =  1*Ww[i][0] + -2*Ww[i][1] +  4*Ww[i][2];
+          V[i][4] = vmulq_n_f16(vaddq_f16(vsubq_f16(Ww[i][0], vmulq_n_f16(Ww[i][1], 2.0f)), vmulq_n_f16(Ww[i][2], 4.0f)), recip576);
+
+          // V[i][5] = 24*Ww[i][2];
+          V[i][5] = vmulq_n_f16(vmulq_n_f16(Ww[i][2], 24.0f), recip576);
+        }
+
+        // Store the transformed weights
+        for (int i = 0, m = 0; i < 6; i++)
+        {
+          for (int j = 0; j < 6; j++, m++)
+          {
+            vst1q_f16(outptr + m*matrix_stride, V[i][j]);
+          }
+        }
+        outptr += 8;
+      }
+#endif  // __aarch64__
+#ifdef __arm_any__
+      for (; channels_remaining >= 4; channels_remaining -= 4)
+      {
+        // Matrices used and computed in this kernel
+        float16x4_t w[3][3], Ww[6][3], V[6][6];
+
+        // Read weights
+        for (int i = 0; i < 3; i++)
+        {
+          for (int j = 0; j < 3; j++)
+          {
+            w[i][j] = vld1_f16(inptrs[i][j]);
+            inptrs[i][j] += 4;
+          }
+        }
+
+        // Compute the matrix W w
+        for (int j = 0; j < 3; j++)
+        {
+          // Ww[0][j] =  6*w[0][j];
+          Ww[0][j] = vmul_n_f16(w[0][j], 6.0);
+
+          // Ww[1][j] = -4*w[0][j] + -4*w[1][j] + -4*w[2][j];
+          Ww[1][j] = vmul_n_f16(vadd_f16(vadd_f16(w[0][j], w[1][j]), w[2][j]), -4.0);
+
+          // Ww[2][j] = -4*w[0][j] +  4*w[1][j] + -4*w[2][j];
+          Ww[2][j] = vmul_n_f16(vsub_f16(vsub_f16(w[1][j], w[0][j]), w[2][j]), 4.0);
+
+          // Ww[3][j] =  1*w[0][j] +  2*w[1][j] +  4*w[2][j];
+          Ww[3][j] = vadd_f16(vadd_f16(w[0][j], vmul_n_f16(w[1][j], 2.0f)), vmul_n_f16(w[2][j], 4.0f));
+
+          // Ww[4][j] =  1*w[0][j] + -2*w[1][j] +  4*w[2][j];
+          Ww[4][j] = vadd_f16(vsub_f16(w[0][j], vmul_n_f16(w[1][j], 2.0f)), vmul_n_f16(w[2][j], 4.0f));
+
+          // Ww[5][j] = 24*w[2][j];
+          Ww[5][j] = vmul_n_f16(w[2][j], 24.0f);
+        }
+
+        // Compute V = W w WT
+        for (int i = 0; i < 6; i++)
+        {
+          const float16_t recip576 = 1.0f / 576.0f;
+
+          // V[i][0] =  6*Ww[i][0];
+          V[i][0] = vmul_n_f16(vmul_n_f16(Ww[i][0], 6.0), recip576);
+
+          // V[i][1] = -4*Ww[i][0] + -4*Ww[i][1] + -4*Ww[i][2];
+          V[i][1] = vmul_n_f16(vmul_n_f16(vadd_f16(vadd_f16(Ww[i][0], Ww[i][1]), Ww[i][2]), -4.0), recip576);
+
+          // V[i][2] = -4*Ww[i][0] +  4*Ww[i][1] + -4*Ww[i][2];
+          V[i][2] = vmul_n_f16(vmul_n_f16(vsub_f16(vsub_f16(Ww[i][1], Ww[i][0]), Ww[i][2]), 4.0), recip576);
+
+          // V[i][3] =  1*Ww[i][0] +  2*Ww[i][1] +  4*Ww[i][2];
+          V[i][3] = vmul_n_f16(vadd_f16(vadd_f16(Ww[i][0], vmul_n_f16(Ww[i][1], 2.0f)), vmul_n_f16(Ww[i][2], 4.0f)), recip576);
+
+          // V[i][4] =  1*Ww[i][0] + -2*Ww[i][1] +  4*Ww[i][2];
+          V[i][4] = vmul_n_f16(vadd_f16(vsub_f16(Ww[i][0], vmul_n_f16(Ww[i][1], 2.0f)), vmul_n_f16(Ww[i][2], 4.0f)), recip576);
+
+          // V[i][5] = 24*Ww[i][2];
+          V[i][5] = vmul_n_f16(vmul_n_f16(Ww[i][2], 24.0f), recip576);
+        }
+
+        // Store the transformed weights
+        for (int i = 0, m = 0; i < 6; i++)
+        {
+          for (int j = 0; j < 6; j++, m++)
+          {
+            vst1_f16(outptr + m*matrix_stride, V[i][j]);
+          }
+        }
+        outptr += 4;
+      }
+#endif  // __arm_any__
+      for (; channels_remaining; channels_remaining--)
+      {
+        // Matrices used and computed in this kernel
+        float16_t w[3][3], Ww[6][3], V[6][6];
+
+        // Read weights
+        for (int i = 0; i < 3; i++)
+        {
+          for (int j = 0; j < 3; j++)
+          {
+            w[i][j] = *(inptrs[i][j]++);
+          }
+        }
+
+        // Compute the matrix W w
+        for (int j = 0; j < 3; j++)
+        {
+          Ww[0][j] =  6*w[0][j];
+          Ww[1][j] = -4*w[0][j] + -4*w[1][j] + -4*w[2][j];
+          Ww[2][j] = -4*w[0][j] +  4*w[1][j] + -4*w[2][j];
+          Ww[3][j] =  1*w[0][j] +  2*w[1][j] +  4*w[2][j];
+          Ww[4][j] =  1*w[0][j] + -2*w[1][j] +  4*w[2][j];
+          Ww[5][j] = 24*w[2][j];
+        }
+
+        // Compute V = W w WT
+        for (int i = 0; i < 6; i++)
+        {
+          V[i][0] = ( 6*Ww[i][0]) / 576.0;
+          V[i][1] = (-4*Ww[i][0] + -4*Ww[i][1] + -4*Ww[i][2]) / 576.0;
+          V[i][2] = (-4*Ww[i][0] +  4*Ww[i][1] + -4*Ww[i][2]) / 576.0;
+          V[i][3] = ( 1*Ww[i][0] +  2*Ww[i][1] +  4*Ww[i][2]) / 576.0;
+          V[i][4] = ( 1*Ww[i][0] + -2*Ww[i][1] +  4*Ww[i][2]) / 576.0;
+          V[i][5] = (24*Ww[i][2]) / 576.0;
+        }
+
+        // Store the transformed weights
+        for (int i = 0, m = 0; i < 6; i++)
+        {
+          for (int j = 0; j < 6; j++, m++)
+          {
+            *(outptr + m*matrix_stride) = V[i][j];
+          }
+        }
+        outptr++;
+      }
+    }
+  }
+
+  template <>
+  template <>
+  int WinogradGEMM<4, 4, 3, 3>::WeightsTransform<float16_t>::ops_performed(const KernelShape &shape)
+  {
+    const int channel_prod = shape.n_input_channels * shape.n_output_channels;
+    return 9 * 16 * channel_prod;
+  }
+
+  template struct WinogradGEMM<4, 4, 3, 3>::WeightsTransform<float16_t>;
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
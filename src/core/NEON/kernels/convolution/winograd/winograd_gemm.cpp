@@ -238,3 +238,12 @@ template class WinogradGEMM<2, 1, 7, 1>::Convolution<float, float>;
 
 
 
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class WinogradGEMM<2, 2, 3, 3>::Convolution<float16_t, float16_t>;
+template class WinogradGEMM<4, 4, 3, 3>::Convolution<float16_t, float16_t>;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+// Integer F(2x2, 3x3): 16-bit transformed input and weights, 32-bit products
+template class WinogradGEMM<2, 2, 3, 3>::Convolution<int16_t, int16_t>;
+template class WinogradGEMM<2, 2, 3, 3>::Convolution<int32_t, int32_t>;
@@ -168,6 +168,76 @@ NodeID GraphBuilder::add_batch_normalization_node(Graph &g, NodeParams params, N
     return batch_norm_nid;
 }
 
+NodeID GraphBuilder::add_binary_convolution_node(Graph &g, NodeParams params, NodeIdxPair input,
+                                                 Size2D kernel_spatial_extend, unsigned int depth, PadStrideInfo conv_info,
+                                                 ITensorAccessorUPtr weights_accessor, ITensorAccessorUPtr bias_accessor,
+                                                 ITensorAccessorUPtr scale_accessor, ITensorAccessorUPtr shift_accessor,
+                                                 ActivationLayerInfo fused_act)
+{
+    CHECK_NODEIDX_PAIR(input, g);
+    ARM_COMPUTE_ERROR_ON(depth == 0);
+    ARM_COMPUTE_ERROR_ON((kernel_spatial_extend.width == 0) || (kernel_spatial_extend.height == 0));
+
+    bool has_bias  = (bias_accessor != nullptr);
+    bool has_scale = (scale_accessor != nullptr);
+    bool has_shift = (shift_accessor != nullptr);
+
+    // Get input tensor descriptor
+    const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+
+    // Create weights node
+    TensorDescriptor w_desc = input_tensor_desc;
+    w_desc.shape.set(get_dimension_idx(input_tensor_desc, DataLayoutDimension::WIDTH), kernel_spatial_extend.width);
+    w_desc.shape.set(get_dimension_idx(input_tensor_desc, DataLayoutDimension::HEIGHT), kernel_spatial_extend.height);
+    w_desc.shape.set(get_dimension_idx(input_tensor_desc, DataLayoutDimension::CHANNEL),
+                     get_dimension_size(input_tensor_desc, DataLayoutDimension::CHANNEL));
+    w_desc.shape.set(get_dimension_idx(input_tensor_desc, DataLayoutDimension::BATCHES), depth);
+
+    NodeID w_nid = add_const_node_with_name(g, params, "Weights", w_desc, std::move(weights_accessor));
+
+    // Create bias, scale and shift nodes
+    TensorDescriptor common_desc = input_tensor_desc;
+    common_desc.shape            = TensorShape(depth);
+
+    NodeID b_nid = EmptyNodeID;
+    if(has_bias)
+    {
+        b_nid = add_const_node_with_name(g, params, "Bias", common_desc, std::move(bias_accessor));
+    }
+
+    NodeID scale_nid = EmptyNodeID;
+    if(has_scale)
+    {
+        scale_nid = add_const_node_with_name(g, params, "Scale", common_desc, std::move(scale_accessor));
+    }
+
+    NodeID shift_nid = EmptyNodeID;
+    if(has_shift)
+    {
+        shift_nid = add_const_node_with_name(g, params, "Shift", common_desc, std::move(shift_accessor));
+    }
+
+    // Create binary convolution node and connect
+    NodeID conv_nid = g.add_node<BinaryConvolutionLayerNode>(conv_info, fused_act);
+    g.add_connection(input.node_id, input.index, conv_nid, 0);
+    g.add_connection(w_nid, 0, conv_nid, 1);
+    if(has_bias)
+    {
+        g.add_connection(b_nid, 0, conv_nid, 2);
+    }
+    if(has_scale)
+    {
+        g.add_connection(scale_nid, 0, conv_nid, 3);
+    }
+    if(has_shift)
+    {
+        g.add_connection(shift_nid, 0, conv_nid, 4);
+    }
+    set_node_params(g, conv_nid, params);
+
+    return conv_nid;
+}
+
 NodeID GraphBuilder::add_bounding_box_transform_node(Graph &g, NodeParams params, NodeIdxPair input, NodeIdxPair deltas, BoundingBoxTransformInfo info)
 {
     CHECK_NODEIDX_PAIR(input, g);
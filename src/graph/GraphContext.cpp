@@ -32,7 +32,7 @@ namespace arm_compute
 namespace graph
 {
 GraphContext::GraphContext()
-    : _config(), _memory_managers()
+    : _config(), _memory_managers(), _memory_tracker(std::make_shared<HostMemoryTracker>()), _memory_trackers()
 {
 }
 
@@ -74,9 +74,8 @@ std::map<Target, MemoryManagerContext> &GraphContext::memory_managers()
     return _memory_managers;
 }
 
-void GraphContext::finalize()
+void GraphContext::finalize(size_t num_pools)
 {
-    const size_t num_pools = 1;
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -93,5 +92,75 @@ void GraphContext::finalize()
         }
     }
 }
+
+std::shared_ptr<HostMemoryTracker> GraphContext::memory_tracker()
+{
+    return _memory_tracker;
+}
+
+std::shared_ptr<HostMemoryTracker> GraphContext::memory_tracker(MemoryCategory category, NodeID nid)
+{
+    if(category != MemoryCategory::FunctionBuffers)
+    {
+        nid = EmptyNodeID;
+    }
+
+    std::shared_ptr<HostMemoryTracker> &tracker = _memory_trackers[std::make_pair(category, nid)];
+    if(tracker == nullptr)
+    {
+        // The buffers of each node are also accounted for in the function buffers category
+        const bool is_node = (nid != EmptyNodeID);
+        tracker            = std::make_shared<HostMemoryTracker>(is_node ? memory_tracker(category) : _memory_tracker);
+    }
+    return tracker;
+}
+
+GraphMemoryUsage GraphContext::memory_usage() const
+{
+    GraphMemoryUsage usage;
+    for(const auto &tracker : _memory_trackers)
+    {
+        const MemoryCategory category = tracker.first.first;
+        const NodeID         nid      = tracker.first.second;
+        if(nid != EmptyNodeID)
+        {
+            usage.nodes[nid] = tracker.second->usage();
+        }
+        else if(category == MemoryCategory::ConstTensors)
+        {
+            usage.const_tensors = tracker.second->usage();
+        }
+        else if(category == MemoryCategory::Tensors)
+        {
+            usage.tensors = tracker.second->usage();
+        }
+        else
+        {
+            usage.function_buffers = tracker.second->usage();
+        }
+    }
+
+    for(const auto &mm_obj : _memory_managers)
+    {
+        auto pools_usage = [](const std::shared_ptr<arm_compute::IMemoryManager> &mm)
+        {
+            MemoryPoolsUsage pools;
+            pools.pool_size = mm->pool_size();
+            pools.num_pools = mm->pool_manager()->num_pools();
+            return pools;
+        };
+        if(mm_obj.second.intra_mm != nullptr)
+        {
+            usage.function_pools[mm_obj.first] = pools_usage(mm_obj.second.intra_mm);
+        }
+        if(mm_obj.second.cross_mm != nullptr)
+        {
+            usage.transition_pools[mm_obj.first] = pools_usage(mm_obj.second.cross_mm);
+        }
+    }
+
+    usage.host = _memory_tracker->usage();
+    return usage;
+}
 } // namespace graph
 } // namespace arm_compute
@@ -30,7 +30,12 @@
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
+#include "arm_compute/graph/detail/DataflowExecutor.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/detail/PipelineExecutor.h"
+#include "arm_compute/runtime/HostMemoryTracker.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
 
@@ -48,6 +53,9 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Setup graph context if not done manually
     setup_default_graph_context(ctx);
 
+    // Account for all the host memory allocated for the graph
+    HostMemoryTracker::Scope memory_scope(ctx.memory_tracker().get());
+
     // Check if graph has been registered
     if(_workloads.find(graph.id()) != std::end(_workloads))
     {
@@ -76,29 +84,99 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Validate all nodes
     detail::validate_all_nodes(graph);
 
+    // Split the graph in pipeline stages if requested: the tensors crossing the stages are rebound before the nodes are configured
+    std::shared_ptr<detail::PipelineExecutor> pipeline = nullptr;
+    if(ctx.config().execution_strategy == ExecutionStrategy::Pipelined)
+    {
+        if(detail::PipelineExecutor::is_supported(graph))
+        {
+            pipeline = std::make_shared<detail::PipelineExecutor>(graph, topological_sorted_nodes, ctx.config().pipeline_stages, Scheduler::get().num_threads());
+            if(pipeline->num_stages() < 2)
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("Graph can't be split in pipeline stages, switching to sequential execution" << std::endl);
+                pipeline = nullptr;
+            }
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Pipelined execution is not supported for this graph, switching to sequential execution" << std::endl);
+        }
+    }
+
     // Configure all nodes
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Allocate the buffers of the tensors crossing the pipeline stages
+    if(pipeline != nullptr)
+    {
+        HostMemoryTracker::Scope tensors_scope(ctx.memory_tracker(MemoryCategory::Tensors).get());
+        pipeline->configure(workload);
+        workload.pipeline = pipeline;
+    }
+
     // Allocate const tensors and call accessors
-    detail::allocate_const_tensors(graph);
-    detail::call_all_const_node_accessors(graph);
+    {
+        HostMemoryTracker::Scope const_tensors_scope(ctx.memory_tracker(MemoryCategory::ConstTensors).get());
+        if(ctx.config().weights_cache != nullptr)
+        {
+            detail::share_const_tensors(graph, *ctx.config().weights_cache);
+        }
+        detail::allocate_const_tensors(graph);
+        detail::call_all_const_node_accessors(graph);
+    }
 
     // Prepare graph
     detail::prepare_all_tasks(workload);
+    if(ctx.config().weights_cache != nullptr)
+    {
+        detail::release_unused_shared_tensors(graph, *ctx.config().weights_cache);
+    }
 
-    // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // Run independent nodes concurrently if requested
+    if(ctx.config().execution_strategy == ExecutionStrategy::Dataflow)
     {
-        detail::configure_transition_manager(graph, ctx, workload);
+        if(detail::DataflowExecutor::is_supported(workload))
+        {
+            workload.executor = std::make_shared<detail::DataflowExecutor>(workload, Scheduler::get().num_threads());
+            if(workload.executor->num_lanes() < 2)
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("No independent nodes to run concurrently, switching to sequential execution" << std::endl);
+                workload.executor = nullptr;
+            }
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Dataflow execution is not supported for this graph, switching to sequential execution" << std::endl);
+        }
     }
-    else
+
+    // Setup tensor memory (Allocate all tensors or setup transition manager)
+    // The lifetimes computed by the transition manager assume that the nodes run in topological order on one input at a time,
+    // so the transition buffers of a dataflow or pipelined execution can't share memory
     {
-        detail::allocate_all_tensors(graph);
+        HostMemoryTracker::Scope tensors_scope(ctx.memory_tracker(MemoryCategory::Tensors).get());
+        if(ctx.config().use_transition_memory_manager && workload.executor == nullptr && workload.pipeline == nullptr)
+        {
+            detail::configure_transition_manager(graph, ctx, workload);
+        }
+        else
+        {
+            detail::allocate_all_tensors(graph);
+        }
     }
 
-    // Finalize Graph context
-    ctx.finalize();
+    // Finalize Graph context: each running function needs its own pool for its auxiliary memory
+    unsigned int num_pools = 1;
+    if(workload.executor != nullptr)
+    {
+        num_pools = workload.executor->num_lanes();
+    }
+    else if(workload.pipeline != nullptr)
+    {
+        num_pools = workload.pipeline->num_compute_stages();
+    }
+    ctx.finalize(num_pools);
 
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
@@ -111,6 +189,13 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Stream the inputs through the stages of the pipeline
+    if(it->second.pipeline != nullptr)
+    {
+        it->second.pipeline->run(it->second);
+        return;
+    }
+
     while(true)
     {
         // Call input accessors
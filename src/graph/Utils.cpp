@@ -88,6 +88,7 @@ PassManager create_default_pass_manager(Target target)
     // Passes that mutate backend information
     pm.append(support::cpp14::make_unique<DepthConcatSubTensorMutator>(), !is_target_gc);
     pm.append(support::cpp14::make_unique<SplitLayerSubTensorMutator>(), !is_target_gc);
+    pm.append(support::cpp14::make_unique<PadLayerSubTensorMutator>(), target == Target::NEON);
     pm.append(support::cpp14::make_unique<NodeExecutionMethodMutator>());
 
     return pm;
@@ -172,6 +172,8 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
             return detail::create_activation_layer<CLActivationLayer, CLTargetInfo>(*polymorphic_downcast<ActivationLayerNode *>(node));
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<CLBatchNormalizationLayer, CLTargetInfo>(*polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::BinaryConvolutionLayer:
+            return detail::create_binary_convolution_layer<CLBinaryConvolutionLayer, CLTargetInfo>(*polymorphic_downcast<BinaryConvolutionLayerNode *>(node), ctx);
         case NodeType::BoundingBoxTransformLayer:
             return detail::create_bounding_box_transform_layer<CLBoundingBoxTransform, CLTargetInfo>(*polymorphic_downcast<BoundingBoxTransformLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
@@ -48,6 +48,8 @@ Status CLNodeValidator::validate(INode *node)
     NodeType type = node->type();
     switch(type)
     {
+        case NodeType::BinaryConvolutionLayer:
+            return detail::validate_binary_convolution_layer<CLBinaryConvolutionLayer>(*polymorphic_downcast<BinaryConvolutionLayerNode *>(node));
         case NodeType::BoundingBoxTransformLayer:
             return detail::validate_bounding_box_transform_layer<CLBoundingBoxTransform>(*polymorphic_downcast<BoundingBoxTransformLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
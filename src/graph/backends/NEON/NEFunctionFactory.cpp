@@ -147,6 +147,45 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     return func;
 }
 
+template <>
+std::unique_ptr<IFunction> create_binary_convolution_layer<NEBinaryConvolutionLayer, NETargetInfo>(BinaryConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 5 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *scale   = get_backing_tensor<NETargetInfo>(node.input(3));
+    NETargetInfo::TensorType *shift   = get_backing_tensor<NETargetInfo>(node.input(4));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const ActivationLayerInfo fused_act = node.fused_activation();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, NETargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+
+    std::tie(func, std::ignore) = create_named_memory_managed_function<NEBinaryConvolutionLayer>(
+                                      std::string(), mm,
+                                      input, weights, biases, output, conv_info, WeightsInfo(), nullptr, scale, shift, fused_act);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (scale != nullptr || shift != nullptr ? " Fused scale/shift" : "")
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
+                               << std::endl);
+    return func;
+}
+
 template <>
 std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETargetInfo>(NormalizationLayerNode &node, GraphContext &ctx)
 {
@@ -192,6 +231,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_activation_layer<NEActivationLayer, NETargetInfo>(*polymorphic_downcast<ActivationLayerNode *>(node));
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<NEBatchNormalizationLayer, NETargetInfo>(*polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::BinaryConvolutionLayer:
+            return detail::create_binary_convolution_layer<NEBinaryConvolutionLayer, NETargetInfo>(*polymorphic_downcast<BinaryConvolutionLayerNode *>(node), ctx);
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(*polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
@@ -212,6 +253,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fully_connected_layer<NEFullyConnectedLayer, NETargetInfo>(*polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
         case NodeType::NormalizationLayer:
             return detail::create_normalization_layer<NENormalizationLayer, NETargetInfo>(*polymorphic_downcast<NormalizationLayerNode *>(node), ctx);
+        case NodeType::PadLayer:
+            return detail::create_pad_layer<NEPadLayer, NETargetInfo>(*polymorphic_downcast<PadLayerNode *>(node));
         case NodeType::PermuteLayer:
             return detail::create_permute_layer<NEPermute, NETargetInfo>(*polymorphic_downcast<PermuteLayerNode *>(node));
         case NodeType::PoolingLayer:
@@ -38,6 +38,29 @@ namespace graph
 {
 namespace backends
 {
+namespace detail
+{
+// Specialized functions
+template <>
+Status validate_binary_convolution_layer<NEBinaryConvolutionLayer>(BinaryConvolutionLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating BinaryConvolutionLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input     = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights   = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases    = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *scale     = get_backing_tensor_info(node.input(3));
+    arm_compute::ITensorInfo *shift     = get_backing_tensor_info(node.input(4));
+    arm_compute::ITensorInfo *output    = get_backing_tensor_info(node.output(0));
+    const PadStrideInfo       conv_info = node.convolution_info();
+
+    return NEBinaryConvolutionLayer::validate(input, weights, biases, output, conv_info, WeightsInfo(), nullptr, scale, shift, node.fused_activation());
+}
+} // namespace detail
+
 Status NENodeValidator::validate(INode *node)
 {
     if(node == nullptr)
@@ -48,6 +71,8 @@ Status NENodeValidator::validate(INode *node)
     NodeType type = node->type();
     switch(type)
     {
+        case NodeType::BinaryConvolutionLayer:
+            return detail::validate_binary_convolution_layer<NEBinaryConvolutionLayer>(*polymorphic_downcast<BinaryConvolutionLayerNode *>(node));
         case NodeType::BoundingBoxTransformLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR, "Unsupported operation : BoundingBoxTransformLayer");
         case NodeType::ChannelShuffleLayer:
@@ -67,7 +92,7 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::NormalizePlanarYUVLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR, "Unsupported operation : NormalizePlanarYUVLayer");
         case NodeType::PadLayer:
-            return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR, "Unsupported operation : PadLayer");
+            return detail::validate_pad_layer<NEPadLayer>(*polymorphic_downcast<PadLayerNode *>(node));
         case NodeType::PermuteLayer:
             return detail::validate_permute_layer<NEPermute>(*polymorphic_downcast<PermuteLayerNode *>(node));
         case NodeType::PriorBoxLayer:
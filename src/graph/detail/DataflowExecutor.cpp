@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/DataflowExecutor.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerUtils.h"
+#include "support/ToolchainSupport.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPUUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+namespace
+{
+/** Scheduler running the kernels of a task on the threads of its lane */
+class LaneScheduler final : public IScheduler
+{
+public:
+    /** Constructor
+     *
+     * @param[in] cores Cores the threads of the lane are pinned to, one thread per core.
+     */
+    explicit LaneScheduler(std::vector<unsigned int> cores)
+        : _pool(), _num_threads(0)
+    {
+        _pool.set_cores(std::move(cores));
+        _num_threads = _pool.num_threads();
+    }
+    void set_num_threads(unsigned int num_threads) override
+    {
+        _num_threads = (num_threads == 0) ? _pool.num_threads() : std::min(num_threads, _pool.num_threads());
+    }
+    unsigned int num_threads() const override
+    {
+        return _num_threads;
+    }
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+        const Window      &max_window     = kernel->window();
+        const unsigned int num_iterations = scheduler_utils::num_iterations(max_window, hints);
+        const unsigned int num_threads    = std::min(num_iterations, _num_threads);
+
+        if(num_iterations == 0)
+        {
+            return;
+        }
+
+        if(!kernel->is_parallelisable() || num_threads == 1)
+        {
+            ThreadInfo info;
+            info.cpu_info = &_cpu_info;
+            kernel->run(max_window, info);
+            return;
+        }
+
+        // Smaller windows balance the load better for dynamic strategies, but each of them has a fixed cost
+        const unsigned int max_windows = (hints.strategy() == StrategyHint::DYNAMIC) ? std::min(num_iterations, num_threads * 3) : num_threads;
+
+        const std::pair<unsigned int, unsigned int> grid = scheduler_utils::split_grid(max_window, hints, max_windows, num_threads);
+
+        std::vector<Workload> workloads(grid.first * grid.second);
+        for(unsigned int t = 0; t < workloads.size(); ++t)
+        {
+            workloads[t] = [t, &hints, &max_window, &grid, &kernel](const ThreadInfo & info)
+            {
+                Window win = scheduler_utils::split_window(max_window, hints, t, grid);
+                win.validate();
+                kernel->run(win, info);
+            };
+        }
+        run_workloads(workloads);
+    }
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        if(workloads.size() <= _num_threads)
+        {
+            _pool.run_tagged_workloads(workloads, nullptr);
+            return;
+        }
+
+        // The pool would use as many threads as workloads: use the share of the lane instead and let each thread pick the next workload to run
+        std::atomic<unsigned int> next_workload(0);
+        std::vector<Workload>     feeders(_num_threads, [&](const ThreadInfo & info)
+        {
+            for(unsigned int w = next_workload++; w < workloads.size(); w = next_workload++)
+            {
+                workloads[w](info);
+            }
+        });
+        _pool.run_tagged_workloads(feeders, nullptr);
+    }
+
+private:
+    CPPScheduler _pool;
+    unsigned int _num_threads;
+};
+} // namespace
+
+/** Worker thread running one task at a time on its own pool of threads */
+class DataflowExecutor::Lane
+{
+public:
+    /** Constructor
+     *
+     * @param[in] cores Cores the threads of the lane are pinned to, one thread per core.
+     */
+    explicit Lane(std::vector<unsigned int> cores)
+        : scheduler(std::move(cores)), thread(), task(0), has_task(false), cv()
+    {
+    }
+
+    LaneScheduler           scheduler; /**< Scheduler of the functions run by the lane */
+    std::thread             thread;    /**< Thread running the tasks */
+    unsigned int            task;      /**< Index of the task to run */
+    bool                    has_task;  /**< True if a task has been dispatched to the lane, protected by the executor's mutex */
+    std::condition_variable cv;        /**< Signalled when a task is dispatched to the lane */
+};
+
+namespace
+{
+/** Collects the tasks producing the inputs of a node
+ *
+ * Nodes without a task (e.g. concatenations of sub-tensors) are looked through.
+ *
+ * @param[in]  node         Node to inspect
+ * @param[in]  task_indices Index of the task of each node, -1 for nodes without a task
+ * @param[out] dependencies Indices of the producing tasks
+ */
+void find_dependencies(const INode &node, const std::vector<int> &task_indices, std::vector<unsigned int> &dependencies)
+{
+    for(unsigned int i = 0; i < node.input_edges().size(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if(edge == nullptr || edge->producer() == nullptr)
+        {
+            continue;
+        }
+
+        const INode *producer = edge->producer();
+        const int    task_idx = task_indices[producer->id()];
+        if(task_idx >= 0)
+        {
+            if(std::find(dependencies.begin(), dependencies.end(), task_idx) == dependencies.end())
+            {
+                dependencies.push_back(task_idx);
+            }
+        }
+        else
+        {
+            find_dependencies(*producer, task_indices, dependencies);
+        }
+    }
+}
+} // namespace
+
+DataflowExecutor::DataflowExecutor(const ExecutionWorkload &workload, unsigned int num_threads)
+    : _successors(workload.tasks.size()), _num_dependencies(workload.tasks.size(), 0), _lanes(), _num_threads(std::max(num_threads, 1U)), _workload(nullptr), _pending_dependencies(), _ready_tasks(),
+      _free_lanes(), _num_running(0), _num_completed(0), _error(nullptr), _stop(false), _mutex(), _cv()
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+
+    const unsigned int num_tasks = workload.tasks.size();
+
+    std::vector<int> task_indices(workload.graph->nodes().size(), -1);
+    for(unsigned int i = 0; i < num_tasks; ++i)
+    {
+        task_indices[workload.tasks[i].node->id()] = i;
+    }
+
+    // Build the dependency graph of the tasks, and find how many of them can run at the same time:
+    // tasks at the same depth are independent of each other
+    std::vector<unsigned int> depths(num_tasks, 0);
+    std::vector<unsigned int> tasks_per_depth;
+    std::vector<unsigned int> dependencies;
+    for(unsigned int i = 0; i < num_tasks; ++i)
+    {
+        dependencies.clear();
+        find_dependencies(*workload.tasks[i].node, task_indices, dependencies);
+
+        _num_dependencies[i] = dependencies.size();
+        for(const unsigned int dep : dependencies)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(dep >= i, "Tasks are not in topological order");
+            _successors[dep].push_back(i);
+            depths[i] = std::max(depths[i], depths[dep] + 1);
+        }
+
+        if(depths[i] >= tasks_per_depth.size())
+        {
+            tasks_per_depth.resize(depths[i] + 1, 0);
+        }
+        ++tasks_per_depth[depths[i]];
+    }
+
+    const unsigned int max_width = tasks_per_depth.empty() ? 1 : *std::max_element(tasks_per_depth.begin(), tasks_per_depth.end());
+    const unsigned int num_lanes = std::min(max_width, _num_threads);
+
+    // Split the threads among the lanes, each lane pinning its threads to its own cores so that the lanes never compete for a core.
+    // The cores are dealt round-robin by decreasing capacity, so that every lane gets the same mix of big and little cores
+    const std::vector<unsigned int> capacities = get_cpu_capacities(Scheduler::get().cpu_info());
+    std::vector<unsigned int>       cores(capacities.size());
+    std::iota(cores.begin(), cores.end(), 0U);
+    std::stable_sort(cores.begin(), cores.end(), [&](unsigned int a, unsigned int b)
+    {
+        return capacities[a] > capacities[b];
+    });
+
+    std::vector<std::vector<unsigned int>> lane_cores(num_lanes);
+    for(unsigned int t = 0; t < _num_threads; ++t)
+    {
+        lane_cores[t % num_lanes].push_back(cores[t % cores.size()]);
+    }
+
+    _lanes.reserve(num_lanes);
+    for(unsigned int l = 0; l < num_lanes; ++l)
+    {
+        _lanes.emplace_back(support::cpp14::make_unique<Lane>(std::move(lane_cores[l])));
+        Lane &lane  = *_lanes.back();
+        lane.thread = std::thread(&DataflowExecutor::lane_thread, this, std::ref(lane));
+    }
+}
+
+DataflowExecutor::~DataflowExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    for(auto &lane : _lanes)
+    {
+        lane->cv.notify_one();
+        lane->thread.join();
+    }
+}
+
+bool DataflowExecutor::is_supported(const ExecutionWorkload &workload)
+{
+    return std::all_of(workload.tasks.begin(), workload.tasks.end(), [](const ExecutionTask & task)
+    {
+        return task.node != nullptr && task.node->assigned_target() == Target::NEON;
+    });
+}
+
+unsigned int DataflowExecutor::num_lanes() const
+{
+    return _lanes.size();
+}
+
+void DataflowExecutor::run(ExecutionWorkload &workload)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    _workload             = &workload;
+    _pending_dependencies = _num_dependencies;
+    _num_running          = 0;
+    _num_completed        = 0;
+    _error                = nullptr;
+    _free_lanes.clear();
+    for(auto &lane : _lanes)
+    {
+        _free_lanes.push_back(lane.get());
+    }
+    for(unsigned int i = 0; i < _num_dependencies.size(); ++i)
+    {
+        if(_num_dependencies[i] == 0)
+        {
+            _ready_tasks.push(i);
+        }
+    }
+
+    const unsigned int num_tasks = workload.tasks.size();
+    while(_num_completed < num_tasks)
+    {
+        if(_error == nullptr)
+        {
+            dispatch_ready_tasks();
+        }
+        else if(_num_running == 0)
+        {
+            // Stop at the first error once the running tasks are done
+            break;
+        }
+        _cv.wait(lock);
+    }
+
+    _ready_tasks = TaskQueue();
+    _workload    = nullptr;
+
+    if(_error != nullptr)
+    {
+        std::rethrow_exception(_error);
+    }
+}
+
+void DataflowExecutor::dispatch_ready_tasks()
+{
+    while(!_ready_tasks.empty() && !_free_lanes.empty())
+    {
+        Lane *lane = _free_lanes.back();
+        _free_lanes.pop_back();
+
+        lane->task     = _ready_tasks.top();
+        lane->has_task = true;
+        _ready_tasks.pop();
+
+        ++_num_running;
+        lane->cv.notify_one();
+    }
+}
+
+void DataflowExecutor::lane_thread(Lane &lane)
+{
+    // All the functions run by this thread use the lane's threads
+    Scheduler::set_thread_scheduler(&lane.scheduler);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true)
+    {
+        lane.cv.wait(lock, [&] { return lane.has_task || _stop; });
+        if(_stop)
+        {
+            break;
+        }
+
+        const unsigned int task = lane.task;
+        lock.unlock();
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        std::exception_ptr error = nullptr;
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            _workload->tasks[task]();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        lock.lock();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        if(error != nullptr && _error == nullptr)
+        {
+            _error = error;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        // Release the lane, and unlock the tasks consuming the outputs of this one
+        for(const unsigned int successor : _successors[task])
+        {
+            if(--_pending_dependencies[successor] == 0)
+            {
+                _ready_tasks.push(successor);
+            }
+        }
+        lane.has_task = false;
+        _free_lanes.push_back(&lane);
+        --_num_running;
+        ++_num_completed;
+        _cv.notify_one();
+    }
+
+    Scheduler::set_thread_scheduler(nullptr);
+}
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+class DataflowExecutor::Lane
+{
+};
+
+DataflowExecutor::DataflowExecutor(const ExecutionWorkload &workload, unsigned int num_threads)
+    : _successors(), _num_dependencies(), _lanes(), _num_threads(num_threads), _workload(nullptr), _pending_dependencies(), _ready_tasks(), _free_lanes(), _num_running(0),
+      _num_completed(0), _error(nullptr), _stop(false), _mutex(), _cv()
+{
+    ARM_COMPUTE_UNUSED(workload);
+    ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use the dataflow executor.");
+}
+
+DataflowExecutor::~DataflowExecutor() = default;
+
+bool DataflowExecutor::is_supported(const ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_UNUSED(workload);
+    return false;
+}
+
+unsigned int DataflowExecutor::num_lanes() const
+{
+    return 0;
+}
+
+void DataflowExecutor::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_UNUSED(workload);
+}
+
+void DataflowExecutor::dispatch_ready_tasks()
+{
+}
+
+void DataflowExecutor::lane_thread(Lane &lane)
+{
+    ARM_COMPUTE_UNUSED(lane);
+}
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -23,11 +23,17 @@
  */
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
+#include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/DataflowExecutor.h"
+#include "arm_compute/runtime/HostMemoryTracker.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/WeightsCache.h"
+#include "support/ToolchainSupport.h"
 
 namespace arm_compute
 {
@@ -77,6 +83,11 @@ void allocate_all_input_tensors(INode &node)
         if(tensor != nullptr && !tensor->bound_edges().empty())
         {
             ARM_COMPUTE_ERROR_ON_MSG(!tensor->handle(), "Tensor handle is not configured!");
+            // Skip tensors backed by imported memory
+            if(!tensor->handle()->tensor().info()->is_resizable())
+            {
+                continue;
+            }
             tensor->handle()->allocate();
         }
     }
@@ -90,6 +101,11 @@ void allocate_all_output_tensors(INode &node)
         if(tensor != nullptr && !tensor->bound_edges().empty())
         {
             ARM_COMPUTE_ERROR_ON_MSG(!tensor->handle(), "Tensor handle is not configured!");
+            // Skip tensors backed by imported memory
+            if(!tensor->handle()->tensor().info()->is_resizable())
+            {
+                continue;
+            }
             tensor->handle()->allocate();
         }
     }
@@ -116,6 +132,52 @@ void allocate_const_tensors(Graph &g)
     }
 }
 
+void share_const_tensors(Graph &g, WeightsCache &cache)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || node->type() != NodeType::Const)
+        {
+            continue;
+        }
+
+        Tensor *tensor = node->output(0);
+        if(tensor == nullptr || tensor->bound_edges().empty() || tensor->handle() == nullptr)
+        {
+            continue;
+        }
+
+        ITensorHandle *handle = tensor->handle();
+        if(handle->target() != Target::NEON || handle->is_subtensor() || !handle->tensor().info()->is_resizable())
+        {
+            continue;
+        }
+
+        WeightsCache::Scope scope(&cache, support::cpp11::to_string(node->id()));
+        auto               *backend_tensor = arm_compute::utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&handle->tensor());
+        if(!WeightsCache::acquire(*backend_tensor))
+        {
+            call_tensor_accessor(tensor);
+        }
+        tensor->extract_accessor();
+    }
+}
+
+void release_unused_shared_tensors(Graph &g, WeightsCache &cache)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr && node->type() == NodeType::Const)
+        {
+            Tensor *tensor = node->output(0);
+            if(tensor != nullptr && tensor->handle() != nullptr && !tensor->handle()->tensor().is_used())
+            {
+                cache.release(support::cpp11::to_string(node->id()));
+            }
+        }
+    }
+}
+
 void allocate_all_tensors(Graph &g)
 {
     auto &tensors = g.tensors();
@@ -144,6 +206,9 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
         auto node = g.node(node_id);
         if(node != nullptr)
         {
+            // Account for the buffers the function allocates to its node
+            HostMemoryTracker::Scope memory_scope(ctx.memory_tracker(MemoryCategory::FunctionBuffers, node_id).get());
+
             Target                     assigned_target = node->assigned_target();
             backends::IDeviceBackend &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
             std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
@@ -215,6 +280,22 @@ void prepare_all_tasks(ExecutionWorkload &workload)
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
     for(auto &task : workload.tasks)
     {
+        // Account for the buffers the function allocates (e.g. reshaped weights) to its node
+        HostMemoryTracker *tracker = nullptr;
+        if(workload.ctx != nullptr && task.node != nullptr)
+        {
+            tracker = workload.ctx->memory_tracker(MemoryCategory::FunctionBuffers, task.node->id()).get();
+        }
+        HostMemoryTracker::Scope memory_scope(tracker);
+
+        // Share the weights prepared by the function with the other graphs built from the same model
+        WeightsCache *cache = nullptr;
+        if(workload.ctx != nullptr && task.node != nullptr)
+        {
+            cache = workload.ctx->config().weights_cache.get();
+        }
+        WeightsCache::Scope weights_scope(cache, (cache != nullptr) ? support::cpp11::to_string(task.node->id()) : std::string());
+
         task.prepare();
         release_unused_tensors(*workload.graph);
     }
@@ -234,9 +315,16 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for(auto &task : workload.tasks)
+    if(workload.executor != nullptr)
+    {
+        workload.executor->run(workload);
+    }
+    else
     {
-        task();
+        for(auto &task : workload.tasks)
+        {
+            task();
+        }
     }
 
     // Release memory for the transition buffers
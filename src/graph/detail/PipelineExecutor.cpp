@@ -0,0 +1,734 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/PipelineExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPUUtils.h"
+#include "arm_compute/runtime/Memory.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <set>
+#include <thread>
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+/** Thread running a range of the tasks of a workload on its own group of threads */
+class PipelineExecutor::Stage
+{
+public:
+    /** Tensor of a boundary used by the stage */
+    struct Binding
+    {
+        arm_compute::Tensor *tensor; /**< Backing tensor */
+        std::vector<Memory>  ring;   /**< Non-owning views of the buffers of the boundary, indexed by input modulo the ring size */
+    };
+
+    /** Constructor
+     *
+     * @param[in] cores Cores the threads running the functions of the stage are pinned to, one thread per core.
+     *                  If empty, the functions run unpinned on the thread of the stage.
+     */
+    explicit Stage(std::vector<unsigned int> cores)
+        : scheduler(), thread(), tasks(), bindings(), waits(), calls_input_accessors(false), calls_output_accessors(false)
+    {
+        if(cores.empty())
+        {
+            scheduler.set_num_threads(1);
+        }
+        else
+        {
+            scheduler.set_cores(std::move(cores));
+        }
+    }
+
+    CPPScheduler                                       scheduler;              /**< Scheduler of the functions run by the stage */
+    std::thread                                        thread;                 /**< Thread running the stage */
+    std::vector<unsigned int>                          tasks;                  /**< Indices of the tasks run by the stage, in topological order */
+    std::vector<Binding>                               bindings;               /**< Tensors to point to the buffers of the input being processed */
+    std::vector<std::pair<unsigned int, unsigned int>> waits;                  /**< Stages which must be done with the input processed that many inputs ago before the stage overwrites their buffers */
+    bool                                               calls_input_accessors;  /**< True if the stage loads the inputs */
+    bool                                               calls_output_accessors; /**< True if the stage consumes the outputs */
+};
+
+namespace
+{
+/** Estimates the amount of work of a node
+ *
+ * @param[in] node Node to inspect
+ *
+ * @return Number of multiply-accumulates for layers with weights, number of output elements otherwise
+ */
+uint64_t estimate_cost(const INode &node)
+{
+    uint64_t num_outputs = 0;
+    for(unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        const Tensor *output = node.output(i);
+        num_outputs += (output != nullptr) ? output->desc().shape.total_size() : 0;
+    }
+
+    const Tensor *weights = (node.num_inputs() > 1) ? node.input(1) : nullptr;
+    const Tensor *output  = (node.num_outputs() > 0) ? node.output(0) : nullptr;
+    if(weights == nullptr || output == nullptr)
+    {
+        return num_outputs;
+    }
+
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::BinaryConvolutionLayer:
+        case NodeType::DeconvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            // Each output spatial position goes through all the weights
+            const uint64_t num_positions = num_outputs / std::max<size_t>(get_dimension_size(output->desc(), DataLayoutDimension::CHANNEL), 1);
+            return num_positions * weights->desc().shape.total_size();
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            // Each batch goes through all the weights
+            const uint64_t num_batches = num_outputs / std::max<size_t>(output->desc().shape[0], 1);
+            return num_batches * weights->desc().shape.total_size();
+        }
+        default:
+            return num_outputs;
+    }
+}
+
+/** Splits a sequence of nodes in contiguous segments minimising the amount of work of the largest one
+ *
+ * @param[in] costs        Amount of work of each node
+ * @param[in] valid_splits Nodes a segment can start with
+ * @param[in] max_segments Maximum number of segments
+ *
+ * @return Index of the first node of each segment. The fewest segments achieving the smallest maximum are used.
+ */
+std::vector<unsigned int> split_in_segments(const std::vector<uint64_t> &costs, const std::vector<bool> &valid_splits, unsigned int max_segments)
+{
+    const unsigned int num_nodes = costs.size();
+
+    // Candidate segment boundaries, including the start and the end of the sequence
+    std::vector<unsigned int> points{ 0 };
+    for(unsigned int i = 1; i < num_nodes; ++i)
+    {
+        if(valid_splits[i])
+        {
+            points.push_back(i);
+        }
+    }
+    points.push_back(num_nodes);
+
+    std::vector<uint64_t> prefix(num_nodes + 1, 0);
+    for(unsigned int i = 0; i < num_nodes; ++i)
+    {
+        prefix[i + 1] = prefix[i] + costs[i];
+    }
+
+    const unsigned int num_points  = points.size();
+    const unsigned int num_levels  = std::max(std::min<unsigned int>(max_segments, num_points - 1), 1U);
+    const uint64_t     unreachable = std::numeric_limits<uint64_t>::max();
+
+    // largest[k][p]: smallest maximum cost of covering the nodes before points[p] with k + 1 segments
+    std::vector<std::vector<uint64_t>>     largest(num_levels, std::vector<uint64_t>(num_points, unreachable));
+    std::vector<std::vector<unsigned int>> previous(num_levels, std::vector<unsigned int>(num_points, 0));
+    for(unsigned int p = 1; p < num_points; ++p)
+    {
+        largest[0][p] = prefix[points[p]];
+    }
+    for(unsigned int k = 1; k < num_levels; ++k)
+    {
+        for(unsigned int p = k + 1; p < num_points; ++p)
+        {
+            for(unsigned int q = k; q < p; ++q)
+            {
+                const uint64_t cost = std::max(largest[k - 1][q], prefix[points[p]] - prefix[points[q]]);
+                if(cost < largest[k][p])
+                {
+                    largest[k][p]  = cost;
+                    previous[k][p] = q;
+                }
+            }
+        }
+    }
+
+    unsigned int best = 0;
+    for(unsigned int k = 1; k < num_levels; ++k)
+    {
+        if(largest[k][num_points - 1] < largest[best][num_points - 1])
+        {
+            best = k;
+        }
+    }
+
+    std::vector<unsigned int> starts(best + 1, 0);
+    for(unsigned int k = best, p = num_points - 1; k > 0; --k)
+    {
+        p         = previous[k][p];
+        starts[k] = points[p];
+    }
+    return starts;
+}
+
+/** Returns the backing tensor of a NEON graph tensor */
+arm_compute::Tensor *backing_tensor(Tensor *tensor)
+{
+    ARM_COMPUTE_ERROR_ON(tensor == nullptr || tensor->handle() == nullptr);
+    return arm_compute::utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&tensor->handle()->tensor());
+}
+} // namespace
+
+PipelineExecutor::PipelineExecutor(Graph &g, const std::vector<NodeID> &node_order, unsigned int num_stages, unsigned int num_threads)
+    : _node_stages(g.nodes().size(), -1), _boundaries(), _stages(), _workload(nullptr), _completed_frames(), _end_frame(0), _num_finished(0), _run_id(0), _error(nullptr), _stop(false), _mutex(), _cv()
+{
+    // Tensors which can be split: the ones written by a single node, and neither sub-tensors nor parents of sub-tensors
+    std::map<const Tensor *, const INode *> producers;
+    std::set<const Tensor *>                shared;
+    for(auto &node : g.nodes())
+    {
+        for(unsigned int i = 0; node != nullptr && i < node->num_outputs(); ++i)
+        {
+            const Tensor *output = node->output(i);
+            if(output != nullptr && !producers.insert(std::make_pair(output, node.get())).second)
+            {
+                shared.insert(output);
+            }
+        }
+    }
+    std::set<const ITensorHandle *> parent_handles;
+    for(auto &tensor : g.tensors())
+    {
+        if(tensor != nullptr && tensor->handle() != nullptr && tensor->handle()->is_subtensor())
+        {
+            parent_handles.insert(tensor->handle()->parent_handle());
+        }
+    }
+    auto is_splittable = [&](Tensor * tensor)
+    {
+        return tensor != nullptr && tensor->handle() != nullptr && !tensor->handle()->is_subtensor() && parent_handles.count(tensor->handle()) == 0 && shared.count(tensor) == 0;
+    };
+
+    // Position of each node in the sequence of nodes to split, inputs come before it and outputs after it
+    std::vector<NodeID> compute_nodes;
+    bool                split_inputs  = false;
+    bool                split_outputs = false;
+    for(const NodeID nid : node_order)
+    {
+        const INode *node = g.node(nid);
+        if(node == nullptr)
+        {
+            continue;
+        }
+        switch(node->type())
+        {
+            case NodeType::Input:
+                split_inputs = true;
+                break;
+            case NodeType::Output:
+                split_outputs = true;
+                break;
+            case NodeType::Const:
+                break;
+            default:
+                compute_nodes.push_back(nid);
+                break;
+        }
+    }
+    if(compute_nodes.empty())
+    {
+        return;
+    }
+
+    const int             num_compute_nodes = compute_nodes.size();
+    std::map<NodeID, int> positions;
+    for(int i = 0; i < num_compute_nodes; ++i)
+    {
+        positions[compute_nodes[i]] = i;
+    }
+    auto position = [&](const INode & node)
+    {
+        return (node.type() == NodeType::Input) ? -1 : (node.type() == NodeType::Output) ? num_compute_nodes : positions.at(node.id());
+    };
+
+    // A segment can't start with a node if a tensor which can't be split is produced before it and consumed from it onwards
+    std::vector<bool> valid_splits(num_compute_nodes, true);
+    for(auto &edge : g.edges())
+    {
+        if(edge == nullptr || edge->producer() == nullptr || edge->consumer() == nullptr || edge->producer()->type() == NodeType::Const || is_splittable(edge->tensor()))
+        {
+            continue;
+        }
+
+        const int first = std::max(position(*edge->producer()) + 1, 0);
+        const int last  = std::min(position(*edge->consumer()), num_compute_nodes - 1);
+        for(int i = first; i <= last; ++i)
+        {
+            valid_splits[i] = false;
+        }
+        split_inputs  = split_inputs && (edge->producer()->type() != NodeType::Input);
+        split_outputs = split_outputs && (edge->consumer()->type() != NodeType::Output);
+    }
+
+    std::vector<uint64_t> costs(num_compute_nodes);
+    for(int i = 0; i < num_compute_nodes; ++i)
+    {
+        costs[i] = estimate_cost(*g.node(compute_nodes[i]));
+    }
+    const std::vector<unsigned int> starts = split_in_segments(costs, valid_splits, std::max(num_stages, 1U));
+
+    const unsigned int num_segments   = starts.size();
+    const unsigned int first_stage    = split_inputs ? 1 : 0;
+    const unsigned int last_stage     = first_stage + num_segments - 1;
+    const unsigned int output_stage   = split_outputs ? last_stage + 1 : last_stage;
+    const unsigned int num_all_stages = output_stage + 1;
+    if(num_all_stages < 2)
+    {
+        return;
+    }
+
+    // Assign the nodes to the stages
+    for(unsigned int s = 0; s < num_segments; ++s)
+    {
+        const unsigned int end = (s + 1 < num_segments) ? starts[s + 1] : num_compute_nodes;
+        for(unsigned int i = starts[s]; i < end; ++i)
+        {
+            _node_stages[compute_nodes[i]] = first_stage + s;
+        }
+    }
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr && node->type() == NodeType::Input)
+        {
+            _node_stages[node->id()] = 0;
+        }
+        else if(node != nullptr && node->type() == NodeType::Output)
+        {
+            _node_stages[node->id()] = output_stage;
+        }
+    }
+
+    // Split the tensors crossing stages: the consumers of each following stage get their own tensor
+    std::vector<Tensor *> candidates;
+    for(auto &tensor : g.tensors())
+    {
+        if(is_splittable(tensor.get()) && producers.count(tensor.get()) != 0 && producers[tensor.get()]->type() != NodeType::Const)
+        {
+            candidates.push_back(tensor.get());
+        }
+    }
+    for(Tensor *tensor : candidates)
+    {
+        const unsigned int producer_stage = _node_stages[producers[tensor]->id()];
+
+        Boundary boundary;
+        boundary.tensors.push_back(tensor);
+        boundary.stage = producer_stage;
+        for(const EdgeID eid : tensor->bound_edges())
+        {
+            Edge *edge = g.edge(eid);
+            ARM_COMPUTE_ERROR_ON(edge == nullptr || edge->consumer() == nullptr);
+            const unsigned int consumer_stage = _node_stages[edge->consumer_id()];
+            ARM_COMPUTE_ERROR_ON(consumer_stage < producer_stage);
+
+            const unsigned int distance = consumer_stage - producer_stage;
+            if(distance == 0)
+            {
+                continue;
+            }
+            if(distance >= boundary.tensors.size())
+            {
+                boundary.tensors.resize(distance + 1, nullptr);
+            }
+            if(boundary.tensors[distance] == nullptr)
+            {
+                boundary.tensors[distance] = g.tensor(g.create_tensor(tensor->desc()));
+            }
+
+            Tensor *split_tensor = boundary.tensors[distance];
+            tensor->unbind_edge(eid);
+            edge->update_bound_tensor(split_tensor);
+            split_tensor->bind_edge(eid);
+
+            // The output accessors read the tensor of the last stage
+            if(edge->consumer()->type() == NodeType::Output)
+            {
+                split_tensor->set_accessor(tensor->extract_accessor());
+            }
+        }
+
+        if(boundary.tensors.size() > 1)
+        {
+            _boundaries.emplace_back(std::move(boundary));
+        }
+    }
+    configure_all_tensors(g);
+
+    // Share the threads among the compute stages, each stage pinning its threads to its own cores so that the stages never compete for a core.
+    // The cores are dealt round-robin by decreasing capacity, so that the balanced stages also get the same mix of big and little cores.
+    // The accessors run unpinned on the thread of their stage
+    const std::vector<unsigned int> capacities = get_cpu_capacities(Scheduler::get().cpu_info());
+    std::vector<unsigned int>       cores(capacities.size());
+    std::iota(cores.begin(), cores.end(), 0U);
+    std::stable_sort(cores.begin(), cores.end(), [&](unsigned int a, unsigned int b)
+    {
+        return capacities[a] > capacities[b];
+    });
+
+    const unsigned int                     total_threads = std::max(num_threads, num_segments);
+    std::vector<std::vector<unsigned int>> stage_cores(num_all_stages);
+    for(unsigned int t = 0; t < total_threads; ++t)
+    {
+        stage_cores[first_stage + t % num_segments].push_back(cores[t % cores.size()]);
+    }
+
+    _stages.reserve(num_all_stages);
+    for(unsigned int s = 0; s < num_all_stages; ++s)
+    {
+        _stages.emplace_back(support::cpp14::make_unique<Stage>(std::move(stage_cores[s])));
+    }
+    _stages[0]->calls_input_accessors             = true;
+    _stages[output_stage]->calls_output_accessors = true;
+
+    for(unsigned int s = 0; s < num_all_stages; ++s)
+    {
+        _stages[s]->thread = std::thread(&PipelineExecutor::stage_thread, this, s);
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Split graph in " << num_all_stages << " pipeline stages (" << num_segments << " running functions) and " << _boundaries.size() << " tensors"
+                               << std::endl);
+}
+
+PipelineExecutor::~PipelineExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    for(auto &stage : _stages)
+    {
+        stage->thread.join();
+    }
+}
+
+bool PipelineExecutor::is_supported(const Graph &g)
+{
+    return std::all_of(g.nodes().begin(), g.nodes().end(), [](const std::unique_ptr<INode> &node)
+    {
+        return node == nullptr || node->assigned_target() == Target::NEON;
+    });
+}
+
+unsigned int PipelineExecutor::num_stages() const
+{
+    return _stages.size();
+}
+
+unsigned int PipelineExecutor::num_compute_stages() const
+{
+    return std::count_if(_stages.begin(), _stages.end(), [](const std::unique_ptr<Stage> &stage)
+    {
+        return !stage->tasks.empty();
+    });
+}
+
+void PipelineExecutor::configure(const ExecutionWorkload &workload)
+{
+    for(unsigned int i = 0; i < workload.tasks.size(); ++i)
+    {
+        const int stage = _node_stages[workload.tasks[i].node->id()];
+        ARM_COMPUTE_ERROR_ON(stage < 0 || static_cast<unsigned int>(stage) >= _stages.size());
+        _stages[stage]->tasks.push_back(i);
+    }
+
+    for(auto &boundary : _boundaries)
+    {
+        // The tensors of a boundary exchange their buffers, so they all need the padding requested by any of their functions
+        PaddingSize padding;
+        for(Tensor *tensor : boundary.tensors)
+        {
+            if(tensor != nullptr)
+            {
+                const PaddingSize &tensor_padding = backing_tensor(tensor)->info()->padding();
+                padding.top                       = std::max(padding.top, tensor_padding.top);
+                padding.right                     = std::max(padding.right, tensor_padding.right);
+                padding.bottom                    = std::max(padding.bottom, tensor_padding.bottom);
+                padding.left                      = std::max(padding.left, tensor_padding.left);
+            }
+        }
+
+        size_t size      = 0;
+        size_t alignment = 0;
+        for(Tensor *tensor : boundary.tensors)
+        {
+            if(tensor != nullptr)
+            {
+                arm_compute::Tensor *backing = backing_tensor(tensor);
+                backing->info()->extend_padding(padding);
+                ARM_COMPUTE_ERROR_ON(size != 0 && size != backing->info()->total_size());
+                size      = backing->info()->total_size();
+                alignment = backing->allocator()->alignment();
+            }
+        }
+
+        boundary.buffers.resize(boundary.tensors.size());
+        for(auto &buffer : boundary.buffers)
+        {
+            buffer = support::cpp14::make_unique<MemoryRegion>(size, alignment);
+        }
+
+        // Import the memory right away so that the tensors don't get allocated with the other ones
+        for(unsigned int distance = 0; distance < boundary.tensors.size(); ++distance)
+        {
+            if(boundary.tensors[distance] != nullptr)
+            {
+                arm_compute::Tensor *backing = backing_tensor(boundary.tensors[distance]);
+                const Status         status  = backing->allocator()->import_memory(boundary.buffers[0]->buffer(), size);
+                ARM_COMPUTE_ERROR_THROW_ON(status);
+                ARM_COMPUTE_UNUSED(status);
+
+                // Views of the ring of buffers created once here, so that switching buffers between inputs doesn't allocate
+                Stage::Binding binding{ backing, std::vector<Memory>() };
+                binding.ring.reserve(boundary.buffers.size());
+                for(auto &buffer : boundary.buffers)
+                {
+                    binding.ring.emplace_back(buffer.get());
+                }
+                _stages[boundary.stage + distance]->bindings.emplace_back(std::move(binding));
+            }
+        }
+
+        // The producing stage can't overwrite a buffer before the last stage reading it is done with it
+        _stages[boundary.stage]->waits.emplace_back(boundary.stage + boundary.tensors.size() - 1, boundary.tensors.size() - 1);
+    }
+}
+
+void PipelineExecutor::run(ExecutionWorkload &workload)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    _workload         = &workload;
+    _completed_frames = std::vector<unsigned int>(_stages.size(), 0);
+    _end_frame        = std::numeric_limits<unsigned int>::max();
+    _num_finished     = 0;
+    _error            = nullptr;
+    ++_run_id;
+    _cv.notify_all();
+
+    _cv.wait(lock, [&] { return _num_finished == _stages.size(); });
+    _workload = nullptr;
+
+    if(_error != nullptr)
+    {
+        std::rethrow_exception(_error);
+    }
+}
+
+bool PipelineExecutor::can_start(unsigned int stage, unsigned int frame) const
+{
+    if(stage > 0 && _completed_frames[stage - 1] <= frame)
+    {
+        return false;
+    }
+    return std::all_of(_stages[stage]->waits.begin(), _stages[stage]->waits.end(), [&](const std::pair<unsigned int, unsigned int> &wait)
+    {
+        return _completed_frames[wait.first] + wait.second >= frame;
+    });
+}
+
+void PipelineExecutor::run_frame(Stage &stage, unsigned int frame, unsigned int &end_frame)
+{
+    // Point the tensors crossing the stage to the buffers of this input
+    for(auto &binding : stage.bindings)
+    {
+        const Status status = binding.tensor->allocator()->import_memory(binding.ring[frame % binding.ring.size()]);
+        ARM_COMPUTE_ERROR_THROW_ON(status);
+        ARM_COMPUTE_UNUSED(status);
+    }
+
+    if(stage.calls_input_accessors && !call_all_input_node_accessors(*_workload))
+    {
+        end_frame = frame;
+        return;
+    }
+
+    for(const unsigned int task : stage.tasks)
+    {
+        _workload->tasks[task]();
+    }
+
+    if(stage.calls_output_accessors && !call_all_output_node_accessors(*_workload))
+    {
+        end_frame = frame + 1;
+    }
+}
+
+void PipelineExecutor::stage_thread(unsigned int stage_idx)
+{
+    Stage &stage = *_stages[stage_idx];
+
+    // All the functions run by this thread use the stage's threads
+    Scheduler::set_thread_scheduler(&stage.scheduler);
+
+    unsigned int                 last_run = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true)
+    {
+        _cv.wait(lock, [&] { return _run_id != last_run || _stop; });
+        if(_stop)
+        {
+            break;
+        }
+        last_run = _run_id;
+
+        for(unsigned int frame = 0;; ++frame)
+        {
+            _cv.wait(lock, [&] { return frame >= _end_frame || can_start(stage_idx, frame); });
+            if(frame >= _end_frame)
+            {
+                break;
+            }
+            lock.unlock();
+
+            unsigned int end_frame = std::numeric_limits<unsigned int>::max();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            std::exception_ptr error = nullptr;
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                run_frame(stage, frame, end_frame);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch(...)
+            {
+                error     = std::current_exception();
+                end_frame = 0;
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+            lock.lock();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            if(error != nullptr && _error == nullptr)
+            {
+                _error = error;
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            _end_frame = std::min(_end_frame, end_frame);
+            if(frame < end_frame)
+            {
+                _completed_frames[stage_idx] = frame + 1;
+            }
+            _cv.notify_all();
+        }
+
+        ++_num_finished;
+        _cv.notify_all();
+    }
+
+    Scheduler::set_thread_scheduler(nullptr);
+}
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+class PipelineExecutor::Stage
+{
+};
+
+PipelineExecutor::PipelineExecutor(Graph &g, const std::vector<NodeID> &node_order, unsigned int num_stages, unsigned int num_threads)
+    : _node_stages(), _boundaries(), _stages(), _workload(nullptr), _completed_frames(), _end_frame(0), _num_finished(0), _run_id(0), _error(nullptr), _stop(false), _mutex(), _cv()
+{
+    ARM_COMPUTE_UNUSED(g, node_order, num_stages, num_threads);
+    ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use the pipeline executor.");
+}
+
+PipelineExecutor::~PipelineExecutor() = default;
+
+bool PipelineExecutor::is_supported(const Graph &g)
+{
+    ARM_COMPUTE_UNUSED(g);
+    return false;
+}
+
+unsigned int PipelineExecutor::num_stages() const
+{
+    return 0;
+}
+
+unsigned int PipelineExecutor::num_compute_stages() const
+{
+    return 0;
+}
+
+void PipelineExecutor::configure(const ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_UNUSED(workload);
+}
+
+void PipelineExecutor::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_UNUSED(workload);
+}
+
+bool PipelineExecutor::can_start(unsigned int stage, unsigned int frame) const
+{
+    ARM_COMPUTE_UNUSED(stage, frame);
+    return false;
+}
+
+void PipelineExecutor::run_frame(Stage &stage, unsigned int frame, unsigned int &end_frame)
+{
+    ARM_COMPUTE_UNUSED(stage, frame, end_frame);
+}
+
+void PipelineExecutor::stage_thread(unsigned int stage)
+{
+    ARM_COMPUTE_UNUSED(stage);
+}
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -49,6 +49,11 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+GraphMemoryUsage Stream::memory_usage() const
+{
+    return _ctx.memory_usage();
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -29,7 +29,11 @@
 #include "arm_compute/graph/nodes/Nodes.h"
 
 #include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/Tensor.h"
 
+#include "support/ToolchainSupport.h"
+
+#include <cmath>
 #include <set>
 
 namespace arm_compute
@@ -38,6 +42,223 @@ namespace graph
 {
 namespace detail
 {
+/** Folds the parameters of a batch normalization layer into a per-channel scale and shift:
+ *  scale = gamma / sqrt(var + epsilon) and shift = beta - mean * scale
+ *
+ * The parameters are loaded through the accessors of the batch normalization layer the first time the scale or the shift is accessed.
+ */
+class BatchNormalizationFolder final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] mean    Accessor of the mean. Zero if nullptr.
+     * @param[in] var     Accessor of the variance. One if nullptr.
+     * @param[in] beta    Accessor of beta. Zero if nullptr.
+     * @param[in] gamma   Accessor of gamma. One if nullptr.
+     * @param[in] epsilon Epsilon parameter of the batch normalization layer.
+     */
+    BatchNormalizationFolder(ITensorAccessorUPtr mean, ITensorAccessorUPtr var, ITensorAccessorUPtr beta, ITensorAccessorUPtr gamma, float epsilon)
+        : _mean(std::move(mean)), _var(std::move(var)), _beta(std::move(beta)), _gamma(std::move(gamma)), _epsilon(epsilon), _scale(), _shift(), _is_folded(false), _is_valid(false)
+    {
+    }
+    /** Writes the folded scale or shift to a tensor
+     *
+     * @param[in] tensor   F32 1D tensor with one element per channel.
+     * @param[in] is_scale True to write the scale, false to write the shift.
+     *
+     * @return True if all the parameters of the batch normalization layer were accessed successfully
+     */
+    bool access(ITensor &tensor, bool is_scale)
+    {
+        if(!_is_folded)
+        {
+            fold(tensor.info()->tensor_shape());
+        }
+
+        const std::vector<float> &values = is_scale ? _scale : _shift;
+        std::copy(values.begin(), values.end(), reinterpret_cast<float *>(tensor.ptr_to_element(Coordinates(0))));
+
+        return _is_valid;
+    }
+
+private:
+    bool load(ITensorAccessor *accessor, const TensorShape &shape, float default_value, std::vector<float> &values)
+    {
+        if(accessor == nullptr)
+        {
+            values.assign(shape.total_size(), default_value);
+            return true;
+        }
+
+        arm_compute::Tensor tmp;
+        tmp.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+        tmp.allocator()->allocate();
+
+        const bool is_valid = accessor->access_tensor(tmp);
+        const auto tmp_ptr  = reinterpret_cast<const float *>(tmp.buffer());
+        values.assign(tmp_ptr, tmp_ptr + shape.total_size());
+
+        return is_valid;
+    }
+
+    void fold(const TensorShape &shape)
+    {
+        std::vector<float> mean;
+        std::vector<float> var;
+        std::vector<float> beta;
+        std::vector<float> gamma;
+
+        _is_valid = load(_mean.get(), shape, 0.f, mean);
+        _is_valid = load(_var.get(), shape, 1.f, var) && _is_valid;
+        _is_valid = load(_beta.get(), shape, 0.f, beta) && _is_valid;
+        _is_valid = load(_gamma.get(), shape, 1.f, gamma) && _is_valid;
+
+        _scale.resize(shape.total_size());
+        _shift.resize(shape.total_size());
+        for(size_t i = 0; i < shape.total_size(); ++i)
+        {
+            _scale[i] = gamma[i] / std::sqrt(var[i] + _epsilon);
+            _shift[i] = beta[i] - mean[i] * _scale[i];
+        }
+
+        _is_folded = true;
+    }
+
+    ITensorAccessorUPtr _mean;
+    ITensorAccessorUPtr _var;
+    ITensorAccessorUPtr _beta;
+    ITensorAccessorUPtr _gamma;
+    float               _epsilon;
+    std::vector<float>  _scale;
+    std::vector<float>  _shift;
+    bool                _is_folded;
+    bool                _is_valid;
+};
+
+/** Accessor of the scale or the shift computed by a @ref BatchNormalizationFolder */
+class FoldedBatchNormalizationAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] folder   Folder shared by the scale and shift accessors.
+     * @param[in] is_scale True to access the scale, false to access the shift.
+     */
+    FoldedBatchNormalizationAccessor(std::shared_ptr<BatchNormalizationFolder> folder, bool is_scale)
+        : _folder(std::move(folder)), _is_scale(is_scale)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        return _folder->access(tensor, _is_scale);
+    }
+
+private:
+    std::shared_ptr<BatchNormalizationFolder> _folder;
+    bool                                      _is_scale;
+};
+
+void fuse_binary_convolution_with_batch_normalization(Graph &g, const std::set<Activation> &supported_fused_activations)
+{
+    // Not interested in the order of nodes
+    for(auto &node : g.nodes())
+    {
+        // Only the NEON binary convolution has a fused scale and shift
+        if(node && node->type() == NodeType::BinaryConvolutionLayer && node->assigned_target() == Target::NEON && node->output_edges().size() == 1)
+        {
+            auto output_edge = g.edge(*node->output_edges().begin());
+            // Check if following node is a batch normalization layer node
+            if((output_edge == nullptr) || (output_edge->consumer() == nullptr) || (output_edge->consumer()->type() != NodeType::BatchNormalizationLayer))
+            {
+                continue;
+            }
+
+            auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<BinaryConvolutionLayerNode *>(output_edge->producer());
+            auto *bn_node   = arm_compute::utils::cast::polymorphic_downcast<BatchNormalizationLayerNode *>(output_edge->consumer());
+
+            ARM_COMPUTE_ERROR_ON(bn_node->output(0) == nullptr || conv_node->output(0) == nullptr);
+
+            // The scale and shift must be free, and applied before the activation
+            if(conv_node->input_edge(3) != nullptr || conv_node->input_edge(4) != nullptr || conv_node->fused_activation().enabled())
+            {
+                continue;
+            }
+            const ActivationLayerInfo bn_act = bn_node->fused_activation();
+            if(bn_act.enabled() && supported_fused_activations.count(bn_act.activation()) == 0)
+            {
+                continue;
+            }
+            // The mean and variance nodes become the scale and shift nodes, so they must not be shared
+            const Edge *mean_edge = bn_node->input_edge(1);
+            const Edge *var_edge  = bn_node->input_edge(2);
+            if(mean_edge == nullptr || var_edge == nullptr || mean_edge->producer()->output_edges().size() != 1 || var_edge->producer()->output_edges().size() != 1)
+            {
+                continue;
+            }
+
+            // Prevent fusion if fused node has an output accessor
+            if(conv_node->output(0)->accessor() != nullptr)
+            {
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of binary convolution with batch normalization due to the presence of an output accessor\n");
+                continue;
+            }
+
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing Binary Convolution Layer node with ID : " << output_edge->producer_id()
+                                          << " with Batch Normalization Layer node with ID : " << output_edge->consumer_id() << std::endl);
+
+            // Get driving nodes of batch normalization node
+            std::vector<NodeIdxPair> bn_driving_nodes = get_driving_nodes(*bn_node);
+
+            // Extract the accessors of the parameters and of the output
+            auto extract_param_accessor = [&](size_t idx) -> ITensorAccessorUPtr
+            {
+                return (bn_node->input(idx) != nullptr) ? bn_node->input(idx)->extract_accessor() : nullptr;
+            };
+            auto folder = std::make_shared<BatchNormalizationFolder>(extract_param_accessor(1), extract_param_accessor(2),
+                                                                     extract_param_accessor(3), extract_param_accessor(4), bn_node->epsilon());
+            auto bn_node_accessor = bn_node->output(0)->extract_accessor();
+
+            const NodeID        conv_nid  = conv_node->id();
+            const NodeID        scale_nid = mean_edge->producer_id();
+            const NodeID        shift_nid = var_edge->producer_id();
+            std::vector<NodeID> unused_nids;
+            for(size_t idx = 3; idx < bn_node->num_inputs(); ++idx)
+            {
+                if(bn_node->input_edge(idx) != nullptr)
+                {
+                    unused_nids.push_back(bn_node->input_edge(idx)->producer_id());
+                }
+            }
+
+            // Remove batch normalization node and its beta and gamma nodes
+            g.remove_node(bn_node->id());
+            for(auto &nid : unused_nids)
+            {
+                g.remove_node(nid);
+            }
+
+            // Reuse the mean and variance nodes to provide the folded scale and shift
+            g.node(scale_nid)->output(0)->set_accessor(support::cpp14::make_unique<FoldedBatchNormalizationAccessor>(folder, true));
+            g.node(shift_nid)->output(0)->set_accessor(support::cpp14::make_unique<FoldedBatchNormalizationAccessor>(folder, false));
+            g.add_connection(scale_nid, 0, conv_nid, 3);
+            g.add_connection(shift_nid, 0, conv_nid, 4);
+            conv_node->set_fused_activation(bn_act);
+
+            // Update fused node outputs
+            for(auto &driving_node : bn_driving_nodes)
+            {
+                g.add_connection(conv_nid, 0, driving_node.node_id, driving_node.index);
+            }
+
+            // Update accessor to fused node
+            conv_node->output(0)->set_accessor(std::move(bn_node_accessor));
+        }
+    }
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph                              &g,
                                const std::set<Activation>         &supported_fused_activations,
@@ -127,11 +348,18 @@ void NodeFusionMutator::mutate(Graph &g)
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
         return n.output(0)->desc().data_type == DataType::QASYMM8;
     };
+    auto binary_conv_prec = [](INode & n)
+    {
+        // Only the NEON binary convolution has a fused activation, which might have been set by the batch normalization fusion
+        return n.assigned_target() == Target::NEON && !arm_compute::utils::cast::polymorphic_downcast<BinaryConvolutionLayerNode *>(&n)->fused_activation().enabled();
+    };
 
     // Fusion mutations
+    detail::fuse_binary_convolution_with_batch_normalization(g, supported_fused_activations);
     detail::fuse_node_with_activation<BatchNormalizationLayerNode>(g, supported_fused_activations, empty_prec);
     detail::fuse_node_with_activation<ConvolutionLayerNode>(g, supported_fused_activations, empty_prec);
     detail::fuse_node_with_activation<DepthwiseConvolutionLayerNode>(g, supported_fused_activations, qs8_prec);
+    detail::fuse_node_with_activation<BinaryConvolutionLayerNode>(g, supported_fused_activations, binary_conv_prec);
 }
 } // namespace graph
 } // namespace arm_compute
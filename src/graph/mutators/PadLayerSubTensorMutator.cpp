@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/PadLayerSubTensorMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/nodes/PadLayerNode.h"
+
+#include "arm_compute/core/utils/misc/Cast.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+const char *PadLayerSubTensorMutator::name()
+{
+    return "PadLayerSubTensorMutator";
+}
+
+void PadLayerSubTensorMutator::mutate(Graph &g)
+{
+    for(auto &node_id : g.nodes(NodeType::PadLayer))
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr || node->input(0) == nullptr || node->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        Tensor *input_tensor  = node->input(0);
+        Tensor *output_tensor = node->output(0);
+        if(input_tensor->handle() == nullptr || output_tensor->handle() == nullptr
+           || input_tensor->handle()->is_subtensor() || output_tensor->handle()->is_subtensor()
+           || input_tensor->desc().target != Target::NEON || output_tensor->desc().target != Target::NEON)
+        {
+            continue;
+        }
+
+        // Inputs and constants are filled by accessors and split layers already use the input as a parent
+        const Edge *input_edge = node->input_edge(0);
+        if(input_edge == nullptr || input_edge->producer() == nullptr
+           || input_edge->producer()->type() == NodeType::Input || input_edge->producer()->type() == NodeType::Const)
+        {
+            continue;
+        }
+        const bool is_split_input = std::any_of(input_tensor->bound_edges().cbegin(), input_tensor->bound_edges().cend(), [&](const EdgeID & eid)
+        {
+            return (g.edge(eid) != nullptr) && (g.edge(eid)->consumer() != nullptr) && (g.edge(eid)->consumer()->type() == NodeType::SplitLayer);
+        });
+        if(is_split_input)
+        {
+            continue;
+        }
+
+        // Replacing a handle other tensors already use as a parent (e.g. the output of a concatenation) would leave them dangling
+        if(input_edge->producer()->type() == NodeType::ConcatenateLayer)
+        {
+            continue;
+        }
+        ITensorHandle *input_handle = input_tensor->handle();
+        const bool     is_parent    = std::any_of(g.tensors().cbegin(), g.tensors().cend(), [&](const std::unique_ptr<Tensor> &tensor)
+        {
+            return (tensor != nullptr) && (tensor.get() != input_tensor) && (tensor->handle() != nullptr) && (tensor->handle()->parent_handle() == input_handle);
+        });
+        if(is_parent)
+        {
+            continue;
+        }
+
+        // Sub-tensors can only be written safely if their rows are whole rows of the parent (same as concatenation)
+        auto              *pad_node = arm_compute::utils::cast::polymorphic_downcast<PadLayerNode *>(node);
+        const PaddingList &padding  = pad_node->padding();
+        Coordinates        coords;
+        bool               is_valid = true;
+        for(unsigned int i = 0; i < padding.size(); ++i)
+        {
+            is_valid = is_valid && (i >= 2 || (padding[i].first == 0 && padding[i].second == 0));
+            coords.set(i, padding[i].first);
+        }
+        if(!is_valid)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the input of the node with ID : "
+                                      << node->id() << " and name : " << node->name() << std::endl);
+
+        backends::IDeviceBackend      &backend = backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
+        std::unique_ptr<ITensorHandle> handle  = backend.create_subtensor(output_tensor->handle(), input_tensor->desc().shape, coords, false);
+        input_tensor->set_handle(std::move(handle));
+    }
+}
+} // namespace graph
+} // namespace arm_compute
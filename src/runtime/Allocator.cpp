@@ -31,6 +31,11 @@
 
 using namespace arm_compute;
 
+Allocator::Allocator(HostMemoryPolicy policy)
+    : _has_policy(true), _policy(policy)
+{
+}
+
 void *Allocator::allocate(size_t size, size_t alignment)
 {
     ARM_COMPUTE_UNUSED(alignment);
@@ -44,5 +49,5 @@ void Allocator::free(void *ptr)
 
 std::unique_ptr<IMemoryRegion> Allocator::make_region(size_t size, size_t alignment)
 {
-    return arm_compute::support::cpp14::make_unique<MemoryRegion>(size, alignment);
+    return arm_compute::support::cpp14::make_unique<MemoryRegion>(size, alignment, _has_policy ? _policy : MemoryRegion::default_policy());
 }
\ No newline at end of file
@@ -51,6 +51,16 @@ MappingType BlobLifetimeManager::mapping_type() const
     return MappingType::BLOBS;
 }
 
+size_t BlobLifetimeManager::pool_size() const
+{
+    size_t size = 0;
+    for(const auto &blob : _blobs)
+    {
+        size += blob.size;
+    }
+    return size;
+}
+
 void BlobLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
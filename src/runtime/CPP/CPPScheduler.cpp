@@ -28,11 +28,14 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/CPUUtils.h"
+#include "arm_compute/runtime/SchedulerUtils.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <iostream>
 #include <mutex>
+#include <numeric>
 #include <system_error>
 #include <thread>
 
@@ -93,8 +96,11 @@ void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeede
 class CPPScheduler::Thread
 {
 public:
-    /** Start a new thread. */
-    Thread();
+    /** Start a new thread.
+     *
+     * @param[in] core (Optional) Core to pin the thread to, or -1 to let the system place it.
+     */
+    explicit Thread(int core = -1);
 
     Thread(const Thread &) = delete;
     Thread &operator=(const Thread &) = delete;
@@ -122,6 +128,7 @@ public:
 
 private:
     std::thread                        _thread{};
+    int                                _core{ -1 };
     ThreadInfo                         _info{};
     std::vector<IScheduler::Workload> *_workloads{ nullptr };
     ThreadFeeder                      *_feeder{ nullptr };
@@ -132,7 +139,8 @@ private:
     std::exception_ptr                 _current_exception{ nullptr };
 };
 
-CPPScheduler::Thread::Thread()
+CPPScheduler::Thread::Thread(int core)
+    : _core(core)
 {
     _thread = std::thread(&Thread::worker_thread, this);
 }
@@ -176,6 +184,12 @@ void CPPScheduler::Thread::wait()
 
 void CPPScheduler::Thread::worker_thread()
 {
+    if(_core >= 0)
+    {
+        // Pinning is best effort: the thread still works, just without a fixed placement
+        set_thread_affinity(_core);
+    }
+
     while(true)
     {
         std::unique_lock<std::mutex> lock(_m);
@@ -217,14 +231,20 @@ CPPScheduler &CPPScheduler::get()
 
 CPPScheduler::CPPScheduler()
     : _num_threads(num_threads_hint()),
+      _requested_threads(_num_threads),
+      _core_policy(CorePolicy::ANY),
+      _cores(),
+      _thread_capacities(),
       _threads(_num_threads - 1)
 {
 }
 
+CPPScheduler::~CPPScheduler() = default;
+
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
-    _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
-    _threads.resize(_num_threads - 1);
+    _requested_threads = num_threads == 0 ? num_threads_hint() : num_threads;
+    create_threads();
 }
 
 unsigned int CPPScheduler::num_threads() const
@@ -232,6 +252,87 @@ unsigned int CPPScheduler::num_threads() const
     return _num_threads;
 }
 
+void CPPScheduler::set_core_policy(CorePolicy policy)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(policy == CorePolicy::CUSTOM, "Use set_cores() to pin the threads to given cores");
+    if(policy != _core_policy)
+    {
+        _core_policy = policy;
+        create_threads();
+    }
+}
+
+void CPPScheduler::set_cores(std::vector<unsigned int> cores)
+{
+    ARM_COMPUTE_ERROR_ON(cores.empty());
+    ARM_COMPUTE_ERROR_ON(*std::max_element(cores.begin(), cores.end()) >= get_cpu_capacities(_cpu_info).size());
+
+    _core_policy = CorePolicy::CUSTOM;
+    _cores       = std::move(cores);
+    create_threads();
+}
+
+CPPScheduler::CorePolicy CPPScheduler::core_policy() const
+{
+    return _core_policy;
+}
+
+void CPPScheduler::create_threads()
+{
+    _num_threads = _requested_threads;
+    _thread_capacities.clear();
+
+    // Recreate the threads, as the ones already running may be pinned to cores the new policy doesn't use
+    _threads.clear();
+
+    if(_core_policy == CorePolicy::ANY)
+    {
+        _threads.resize(_num_threads - 1);
+        return;
+    }
+
+    // Sort the cores by decreasing capacity so that the first threads, which get work even for small kernels, run on the biggest cores
+    const std::vector<unsigned int> capacities = get_cpu_capacities(_cpu_info);
+    std::vector<unsigned int>       cores(capacities.size());
+    std::iota(cores.begin(), cores.end(), 0U);
+    if(_core_policy == CorePolicy::CUSTOM)
+    {
+        cores        = _cores;
+        _num_threads = cores.size();
+    }
+    std::stable_sort(cores.begin(), cores.end(), [&](unsigned int a, unsigned int b)
+    {
+        return capacities[a] > capacities[b];
+    });
+
+    if(_core_policy == CorePolicy::BIG_CORES)
+    {
+        const unsigned int max_capacity = capacities[cores.front()];
+        cores.erase(std::find_if(cores.begin(), cores.end(), [&](unsigned int core)
+        {
+            return capacities[core] < max_capacity;
+        }),
+        cores.end());
+        _num_threads = std::min(_num_threads, static_cast<unsigned int>(cores.size()));
+    }
+
+    for(unsigned int t = 0; t < _num_threads; ++t)
+    {
+        const unsigned int core = cores[t % cores.size()];
+        _threads.emplace_back(static_cast<int>(core));
+        _thread_capacities.push_back(capacities[core]);
+    }
+
+    // No need to weight the splits if all the threads run on equivalent cores
+    if(std::all_of(_thread_capacities.begin(), _thread_capacities.end(), [&](unsigned int capacity)
+    {
+        return capacity == _thread_capacities.front();
+    }))
+    {
+        _thread_capacities.clear();
+    }
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
@@ -240,20 +341,26 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     {
         return;
     }
-    ThreadFeeder feeder(num_threads, workloads.size());
-    ThreadInfo   info;
+    // With pinning policies every share of the work goes to a pinned worker and the calling thread only waits
+    const bool         caller_works = (_core_policy == CorePolicy::ANY);
+    const unsigned int num_workers  = caller_works ? num_threads - 1 : num_threads;
+    ThreadFeeder       feeder(num_threads, workloads.size());
+    ThreadInfo         info;
     info.cpu_info          = &_cpu_info;
     info.num_threads       = num_threads;
     unsigned int t         = 0;
     auto         thread_it = _threads.begin();
-    for(; t < num_threads - 1; ++t, ++thread_it)
+    for(; t < num_workers; ++t, ++thread_it)
     {
         info.thread_id = t;
         thread_it->start(&workloads, feeder, info);
     }
 
-    info.thread_id = t;
-    process_workloads(workloads, feeder, info);
+    if(caller_works)
+    {
+        info.thread_id = t;
+        process_workloads(workloads, feeder, info);
+    }
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
     try
     {
@@ -277,7 +384,7 @@ void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
     const Window      &max_window     = kernel->window();
-    const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
+    const unsigned int num_iterations = scheduler_utils::num_iterations(max_window, hints);
     const unsigned int num_threads    = std::min(num_iterations, _num_threads);
 
     if(num_iterations == 0)
@@ -309,13 +416,23 @@ void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
             default:
                 ARM_COMPUTE_ERROR("Unknown strategy");
         }
+        const std::pair<unsigned int, unsigned int> grid = scheduler_utils::split_grid(max_window, hints, num_windows, num_threads);
+        num_windows                                      = grid.first * grid.second;
+
+        // A static 1D split gives exactly one window to each thread: size them according to the capacity of the threads' cores
+        std::vector<unsigned int> weights;
+        if(!_thread_capacities.empty() && hints.strategy() == StrategyHint::STATIC && grid.first == num_threads && grid.second == 1)
+        {
+            weights.assign(_thread_capacities.begin(), _thread_capacities.begin() + num_threads);
+        }
+
         std::vector<IScheduler::Workload> workloads(num_windows);
         for(unsigned int t = 0; t < num_windows; t++)
         {
             //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            workloads[t] = [t, &hints, &max_window, &grid, &weights, &kernel](const ThreadInfo & info)
             {
-                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                Window win = weights.empty() ? scheduler_utils::split_window(max_window, hints, t, grid) : scheduler_utils::split_window_weighted(max_window, hints, t, weights);
                 win.validate();
                 kernel->run(win, info);
             };
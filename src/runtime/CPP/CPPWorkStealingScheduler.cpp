@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/SchedulerUtils.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr std::chrono::microseconds spin_duration(100); /**< Time an idle thread spins for before parking */
+constexpr unsigned int              num_busy_spins = 64; /**< Number of spins before a waiting thread starts yielding its core */
+
+inline uint64_t pack_range(unsigned int begin, unsigned int end)
+{
+    return (static_cast<uint64_t>(begin) << 32) | end;
+}
+
+inline unsigned int range_begin(uint64_t range)
+{
+    return static_cast<unsigned int>(range >> 32);
+}
+
+inline unsigned int range_end(uint64_t range)
+{
+    return static_cast<unsigned int>(range);
+}
+
+/** Busy-wait for a short while, then yield the core in case it is oversubscribed
+ *
+ * @param[in] num_spins Number of times the calling thread has already waited.
+ */
+inline void cpu_relax(unsigned int num_spins)
+{
+    if(num_spins < num_busy_spins)
+    {
+#if defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+        __asm__ __volatile__("pause" ::: "memory");
+#endif /* defined(__aarch64__) || defined(__arm__) */
+    }
+    else
+    {
+        std::this_thread::yield();
+    }
+}
+} // namespace
+
+CPPWorkStealingScheduler &CPPWorkStealingScheduler::get()
+{
+    static CPPWorkStealingScheduler scheduler;
+    return scheduler;
+}
+
+constexpr size_t CPPWorkStealingScheduler::cache_line_size;
+
+CPPWorkStealingScheduler::CPPWorkStealingScheduler()
+    : _num_threads(num_threads_hint()), _workers(), _queues_memory(), _queues(nullptr), _kernel(nullptr), _max_window(), _hints(0), _grid(0, 0), _workloads(nullptr), _epoch(0), _busy_workers(0),
+      _has_error(false), _error(nullptr), _mutex(), _cv(), _num_parked(0), _stop(false)
+{
+    start_workers();
+}
+
+CPPWorkStealingScheduler::~CPPWorkStealingScheduler()
+{
+    stop_workers();
+}
+
+void CPPWorkStealingScheduler::start_workers()
+{
+    // Each queue owns a whole cache line, so that the threads popping from their own queue don't invalidate each other's.
+    // new[] doesn't guarantee an alignment larger than the fundamental one before C++17, so the queues are aligned manually
+    const size_t queues_size  = _num_threads * sizeof(RangeQueue);
+    size_t       queues_space = queues_size + cache_line_size;
+    _queues_memory.reset(new uint8_t[queues_space]);
+
+    void *queues_ptr = _queues_memory.get();
+    support::cpp11::align(cache_line_size, queues_size, queues_ptr, queues_space);
+    _queues = reinterpret_cast<RangeQueue *>(queues_ptr);
+    static_assert(sizeof(RangeQueue) == cache_line_size, "Each queue must fill exactly one cache line");
+    for(unsigned int t = 0; t < _num_threads; ++t)
+    {
+        new(_queues + t) RangeQueue();
+    }
+    _stop = false;
+
+    // The calling thread takes part in every job as the last thread
+    const unsigned int epoch = _epoch.load(std::memory_order_relaxed);
+    _workers.reserve(_num_threads - 1);
+    for(unsigned int t = 0; t < _num_threads - 1; ++t)
+    {
+        _workers.emplace_back(&CPPWorkStealingScheduler::worker_thread, this, t, epoch);
+    }
+}
+
+void CPPWorkStealingScheduler::stop_workers()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+
+    for(auto &worker : _workers)
+    {
+        worker.join();
+    }
+    _workers.clear();
+}
+
+void CPPWorkStealingScheduler::set_num_threads(unsigned int num_threads)
+{
+    stop_workers();
+    _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
+    start_workers();
+}
+
+unsigned int CPPWorkStealingScheduler::num_threads() const
+{
+    return _num_threads;
+}
+
+void CPPWorkStealingScheduler::worker_thread(unsigned int thread_id, unsigned int last_epoch)
+{
+    while(true)
+    {
+        // Spin for a while, as the next kernel usually follows closely, then park
+        const auto   spin_start = std::chrono::steady_clock::now();
+        unsigned int num_spins  = 0;
+        while(_epoch.load(std::memory_order_acquire) == last_epoch && (num_spins < num_busy_spins || std::chrono::steady_clock::now() - spin_start < spin_duration))
+        {
+            cpu_relax(num_spins++);
+        }
+
+        if(_epoch.load(std::memory_order_acquire) == last_epoch)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            ++_num_parked;
+            _cv.wait(lock, [&] { return _stop || _epoch.load(std::memory_order_relaxed) != last_epoch; });
+            --_num_parked;
+
+            if(_stop)
+            {
+                return;
+            }
+        }
+
+        last_epoch = _epoch.load(std::memory_order_acquire);
+        process_items(thread_id);
+        _busy_workers.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+bool CPPWorkStealingScheduler::pop(unsigned int thread_id, unsigned int &item)
+{
+    std::atomic<uint64_t> &queue = _queues[thread_id].range;
+    uint64_t               range = queue.load(std::memory_order_relaxed);
+
+    while(range_begin(range) < range_end(range))
+    {
+        if(queue.compare_exchange_weak(range, pack_range(range_begin(range) + 1, range_end(range)), std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            item = range_begin(range);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CPPWorkStealingScheduler::steal(unsigned int thread_id, unsigned int &item)
+{
+    // Visit the other queues starting from the next thread, so that thieves spread over the victims
+    for(unsigned int i = 1; i < _num_threads; ++i)
+    {
+        std::atomic<uint64_t> &queue = _queues[(thread_id + i) % _num_threads].range;
+        uint64_t               range = queue.load(std::memory_order_relaxed);
+
+        while(range_begin(range) < range_end(range))
+        {
+            if(queue.compare_exchange_weak(range, pack_range(range_begin(range), range_end(range) - 1), std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                item = range_end(range) - 1;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void CPPWorkStealingScheduler::process_items(unsigned int thread_id)
+{
+    ThreadInfo info;
+    info.thread_id   = thread_id;
+    info.num_threads = _num_threads;
+    info.cpu_info    = &_cpu_info;
+
+    unsigned int item = 0;
+    while(pop(thread_id, item) || steal(thread_id, item))
+    {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            if(_workloads != nullptr)
+            {
+                (*_workloads)[item](info);
+            }
+            else
+            {
+                Window win = scheduler_utils::split_window(_max_window, _hints, item, _grid);
+                win.validate();
+                _kernel->run(win, info);
+            }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            // Only the first error is reported
+            if(!_has_error.exchange(true))
+            {
+                _error = std::current_exception();
+            }
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    }
+}
+
+void CPPWorkStealingScheduler::run_job(unsigned int num_items)
+{
+    // Spread the items evenly among the queues
+    for(unsigned int t = 0; t < _num_threads; ++t)
+    {
+        _queues[t].range.store(pack_range(t * num_items / _num_threads, (t + 1) * num_items / _num_threads), std::memory_order_relaxed);
+    }
+    _has_error.store(false, std::memory_order_relaxed);
+    _error = nullptr;
+    _busy_workers.store(_num_threads - 1, std::memory_order_relaxed);
+
+    // Publish the job. The epoch is incremented under the lock so that no parked thread misses it
+    bool wake_up = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _epoch.fetch_add(1, std::memory_order_release);
+        wake_up = _num_parked != 0;
+    }
+    if(wake_up)
+    {
+        _cv.notify_all();
+    }
+
+    process_items(_num_threads - 1);
+
+    // The job description can't be modified until every worker is done with it
+    for(unsigned int num_spins = 0; _busy_workers.load(std::memory_order_acquire) != 0; ++num_spins)
+    {
+        cpu_relax(num_spins);
+    }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    if(_has_error.load(std::memory_order_relaxed))
+    {
+        std::rethrow_exception(_error);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void CPPWorkStealingScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    if(workloads.empty())
+    {
+        return;
+    }
+
+    _workloads = &workloads;
+    run_job(workloads.size());
+    _workloads = nullptr;
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void CPPWorkStealingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    const Window      &max_window     = kernel->window();
+    const unsigned int num_iterations = scheduler_utils::num_iterations(max_window, hints);
+    const unsigned int num_threads    = std::min(num_iterations, _num_threads);
+
+    if(num_iterations == 0)
+    {
+        return;
+    }
+
+    if(!kernel->is_parallelisable() || num_threads == 1)
+    {
+        ThreadInfo info;
+        info.cpu_info = &_cpu_info;
+        kernel->run(max_window, info);
+        return;
+    }
+
+    unsigned int num_windows = 0;
+    switch(hints.strategy())
+    {
+        case StrategyHint::STATIC:
+            num_windows = num_threads;
+            break;
+        case StrategyHint::DYNAMIC:
+        {
+            // Smaller windows balance the load better, but each of them has a fixed cost
+            const unsigned int max_iterations = _num_threads * 3;
+            num_windows                       = std::min(num_iterations, max_iterations);
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unknown strategy");
+    }
+
+    _kernel     = kernel;
+    _max_window = max_window;
+    _hints      = hints;
+    _grid       = scheduler_utils::split_grid(max_window, hints, num_windows, num_threads);
+    run_job(_grid.first * _grid.second);
+    _kernel = nullptr;
+}
+} // namespace arm_compute
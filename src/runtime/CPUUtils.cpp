@@ -27,6 +27,7 @@
 #include "arm_compute/core/Error.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdlib>
 #include <cstring>
@@ -34,6 +35,7 @@
 #include <fstream>
 #include <map>
 #include <sched.h>
+#include <string>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -346,6 +348,19 @@ int get_max_cpus()
 }
 #endif /* !defined(BARE_METAL) && (defined(__arm__) || defined(__aarch64__)) */
 
+/* Cores which are paired with bigger ones in big.LITTLE systems */
+bool model_is_little(CPUModel model)
+{
+    switch(model)
+    {
+        case CPUModel::A53:
+        case CPUModel::A55r0:
+        case CPUModel::A55r1:
+            return true;
+        default:
+            return false;
+    }
+}
 } // namespace
 
 namespace arm_compute
@@ -459,4 +474,63 @@ unsigned int get_threads_hint()
     return num_threads_hint;
 }
 
+std::vector<unsigned int> get_cpu_capacities(const CPUInfo &cpuinfo)
+{
+    unsigned int num_cpus = cpuinfo.get_cpu_num();
+#ifndef BARE_METAL
+    if(num_cpus == 0)
+    {
+        num_cpus = std::thread::hardware_concurrency();
+    }
+#endif /* BARE_METAL */
+    num_cpus = std::max(num_cpus, 1U);
+
+    std::vector<unsigned int> capacities(num_cpus, 0U);
+    bool                      success = false;
+
+#ifndef BARE_METAL
+    success = true;
+    for(unsigned int cpu = 0; cpu < num_cpus && success; ++cpu)
+    {
+        std::ifstream file;
+        file.open("/sys/devices/system/cpu/cpu" + support::cpp11::to_string(cpu) + "/cpu_capacity", std::ios::in);
+        std::string line;
+        success = file.is_open() && bool(getline(file, line)) && !line.empty();
+        if(success)
+        {
+            capacities[cpu] = static_cast<unsigned int>(support::cpp11::stoi(line, nullptr));
+        }
+    }
+#endif /* BARE_METAL */
+
+    if(!success)
+    {
+        for(unsigned int cpu = 0; cpu < num_cpus; ++cpu)
+        {
+            capacities[cpu] = model_is_little(cpuinfo.get_cpu_model(cpu)) ? 512U : 1024U;
+        }
+    }
+
+    // Rescale the capacities so that the most capable core is at 1024
+    const unsigned int max_capacity = std::max(*std::max_element(capacities.begin(), capacities.end()), 1U);
+    for(auto &capacity : capacities)
+    {
+        capacity = std::max(capacity * 1024U / max_capacity, 1U);
+    }
+
+    return capacities;
+}
+
+bool set_thread_affinity(unsigned int core)
+{
+#if !defined(BARE_METAL) && defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else  /* !defined(BARE_METAL) && defined(__linux__) */
+    ARM_COMPUTE_UNUSED(core);
+    return false;
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+}
 } // namespace arm_compute
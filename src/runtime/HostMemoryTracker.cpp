@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HostMemoryTracker.h"
+
+#include "arm_compute/core/Error.h"
+
+namespace arm_compute
+{
+namespace
+{
+#ifndef NO_MULTI_THREADING
+thread_local
+#endif /* NO_MULTI_THREADING */
+HostMemoryTracker *active_tracker = nullptr;
+} // namespace
+
+HostMemoryTracker::Scope::Scope(HostMemoryTracker *tracker)
+    : _previous(active_tracker)
+{
+    active_tracker = tracker;
+}
+
+HostMemoryTracker::Scope::~Scope()
+{
+    active_tracker = _previous;
+}
+
+HostMemoryTracker::HostMemoryTracker(std::shared_ptr<HostMemoryTracker> parent)
+    : _parent(std::move(parent)), _resident(0), _peak(0)
+{
+}
+
+void HostMemoryTracker::allocated(size_t size)
+{
+    const size_t resident = _resident.fetch_add(size) + size;
+    size_t       peak     = _peak.load();
+    while(resident > peak && !_peak.compare_exchange_weak(peak, resident))
+    {
+    }
+
+    if(_parent != nullptr)
+    {
+        _parent->allocated(size);
+    }
+}
+
+void HostMemoryTracker::freed(size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(_resident.load() < size);
+    _resident.fetch_sub(size);
+
+    if(_parent != nullptr)
+    {
+        _parent->freed(size);
+    }
+}
+
+MemoryUsage HostMemoryTracker::usage() const
+{
+    MemoryUsage usage;
+    usage.resident = _resident.load();
+    usage.peak     = _peak.load();
+    return usage;
+}
+
+std::shared_ptr<HostMemoryTracker> HostMemoryTracker::current()
+{
+    return (active_tracker != nullptr) ? active_tracker->shared_from_this() : nullptr;
+}
+} // namespace arm_compute
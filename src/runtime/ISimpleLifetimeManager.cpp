@@ -38,7 +38,7 @@
 using namespace arm_compute;
 
 ISimpleLifetimeManager::ISimpleLifetimeManager()
-    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups()
+    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups(), _time(0)
 {
 }
 
@@ -68,7 +68,9 @@ void ISimpleLifetimeManager::start_lifetime(void *obj)
     }
 
     // Insert object in groups and mark its finalized state to false
-    _active_elements.insert(std::make_pair(obj, obj));
+    Element el(obj);
+    el.start = _time++;
+    _active_elements.insert(std::make_pair(obj, el));
 }
 
 void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
@@ -85,6 +87,7 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
     el.size      = size;
     el.alignment = alignment;
     el.status    = true;
+    el.end       = _time++;
 
     // Find object in the occupied lists
     auto occupied_blob_it = std::find_if(std::begin(_occupied_blobs), std::end(_occupied_blobs), [&obj](const Blob & b)
@@ -35,8 +35,7 @@ Memory::Memory()
 Memory::Memory(std::shared_ptr<IMemoryRegion> memory)
     : _region(nullptr), _region_owned(std::move(memory))
 {
-    _region_owned = memory;
-    _region       = _region_owned.get();
+    _region = _region_owned.get();
 }
 
 Memory::Memory(IMemoryRegion *memory)
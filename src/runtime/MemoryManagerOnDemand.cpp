@@ -70,4 +70,10 @@ void MemoryManagerOnDemand::clear()
     ARM_COMPUTE_ERROR_ON_MSG(!_pool_mgr, "Pool manager not specified correctly!");
     _pool_mgr->clear_pools();
 }
+
+size_t MemoryManagerOnDemand::pool_size() const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_lifetime_mgr, "Lifetime manager not specified correctly!");
+    return _lifetime_mgr->pool_size();
+}
 } //namespace arm_compute
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/HostMemoryTracker.h"
+
+#include <atomic>
+
+#if !defined(BARE_METAL) && defined(__linux__)
+#include <sys/mman.h>
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
+namespace arm_compute
+{
+namespace
+{
+std::atomic<HostMemoryPolicy> default_host_policy{ HostMemoryPolicy::ZERO_INITIALIZED };
+
+#if !defined(BARE_METAL) && defined(__linux__)
+/** Most common huge page size, regions smaller than this aren't worth mapping on huge pages */
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+/** Map anonymous memory on huge pages
+ *
+ * Explicit huge pages (hugetlbfs) are used when the system has some reserved, transparent huge pages otherwise.
+ *
+ * @param[in]  size     Minimum size of the mapping
+ * @param[in]  tracker  Tracker to release the mapping from when it is unmapped. Can be nullptr
+ * @param[out] map_size Actual size of the mapping
+ *
+ * @return The mapping, or nullptr if it failed
+ */
+std::shared_ptr<uint8_t> map_huge_pages(size_t size, std::shared_ptr<HostMemoryTracker> tracker, size_t &map_size)
+{
+    map_size = ceil_to_multiple(size, huge_page_size);
+
+    void *ptr = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if(ptr == MAP_FAILED)
+    {
+        ptr = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(ptr == MAP_FAILED)
+        {
+            return nullptr;
+        }
+#ifdef MADV_HUGEPAGE
+        // Only a hint: the kernel falls back to normal pages if transparent huge pages are disabled
+        madvise(ptr, map_size, MADV_HUGEPAGE);
+#endif /* MADV_HUGEPAGE */
+    }
+
+    const size_t mapped_size = map_size;
+    return std::shared_ptr<uint8_t>(static_cast<uint8_t *>(ptr), [mapped_size, tracker](uint8_t *p)
+    {
+        munmap(p, mapped_size);
+        if(tracker != nullptr)
+        {
+            tracker->freed(mapped_size);
+        }
+    });
+}
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+} // namespace
+
+MemoryRegion::MemoryRegion(size_t size, size_t alignment, HostMemoryPolicy policy)
+    : IMemoryRegion(size), _mem(nullptr), _ptr(nullptr)
+{
+    if(size != 0)
+    {
+        // Allocate backing memory
+        size_t                                   space          = size + alignment;
+        size_t                                   allocated_size = space;
+        const std::shared_ptr<HostMemoryTracker> tracker        = HostMemoryTracker::current();
+
+#if !defined(BARE_METAL) && defined(__linux__)
+        if(policy == HostMemoryPolicy::HUGE_PAGES && space >= huge_page_size)
+        {
+            _mem = map_huge_pages(space, tracker, allocated_size);
+        }
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
+        if(_mem == nullptr)
+        {
+            // Value-initialising the array zero-fills it, and so touches every page up front
+            uint8_t *ptr   = (policy == HostMemoryPolicy::ZERO_INITIALIZED) ? new uint8_t[space]() : new uint8_t[space];
+            allocated_size = space;
+            _mem           = std::shared_ptr<uint8_t>(ptr, [space, tracker](uint8_t *ptr)
+            {
+                delete[] ptr;
+                if(tracker != nullptr)
+                {
+                    tracker->freed(space);
+                }
+            });
+        }
+        _ptr = _mem.get();
+
+        if(tracker != nullptr)
+        {
+            tracker->allocated(allocated_size);
+        }
+
+        // Calculate alignment offset
+        if(alignment != 0)
+        {
+            void *aligned_ptr = _mem.get();
+            support::cpp11::align(alignment, size, aligned_ptr, space);
+            _ptr = aligned_ptr;
+        }
+    }
+}
+
+void MemoryRegion::set_default_policy(HostMemoryPolicy policy)
+{
+    default_host_policy.store(policy);
+}
+
+HostMemoryPolicy MemoryRegion::default_policy()
+{
+    return default_host_policy.load();
+}
+} // namespace arm_compute
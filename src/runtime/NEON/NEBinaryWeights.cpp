@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEBinaryWeights.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/functions/NEBinarySign.h"
+
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // ifndef BARE_METAL
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+constexpr uint32_t binary_weights_magic   = 0x42574341; // "ACWB"
+constexpr uint32_t binary_weights_version = 1;
+
+/** Header of a packed binary weights file */
+struct BinaryWeightsHeader
+{
+    uint32_t magic;          /**< Magic number identifying the file format */
+    uint32_t version;        /**< Version of the file format */
+    uint32_t data_layout;    /**< Data layout of the weights: 0 for NCHW, 1 for NHWC */
+    uint32_t kernel_width;   /**< Kernel width */
+    uint32_t kernel_height;  /**< Kernel height */
+    uint32_t num_channels;   /**< Number of IFMs */
+    uint32_t num_kernels;    /**< Number of OFMs */
+    uint32_t weights_offset; /**< Offset in bytes of the packed weights */
+    uint32_t weights_size;   /**< Size in bytes of the packed weights */
+    uint32_t alpha_offset;   /**< Offset in bytes of the alpha values */
+};
+
+uint32_t align_offset(size_t offset)
+{
+    return static_cast<uint32_t>(ceil_to_multiple(offset, NEBinaryWeights::alignment));
+}
+} // namespace
+
+constexpr size_t NEBinaryWeights::alignment;
+
+NEBinaryWeights::NEBinaryWeights()
+    : _weights(), _alpha(), _data_layout(DataLayout::NCHW), _kernel_dims(), _num_channels(0), _num_kernels(0), _mapping(nullptr, Unmapper{ 0 })
+{
+}
+
+void NEBinaryWeights::Unmapper::operator()(void *ptr) const
+{
+#ifndef BARE_METAL
+    munmap(ptr, size);
+#else  // BARE_METAL
+    ARM_COMPUTE_UNUSED(ptr);
+#endif // BARE_METAL
+}
+
+void NEBinaryWeights::init(DataLayout data_layout, const Size2D &kernel_dims, unsigned int num_channels, unsigned int num_kernels)
+{
+    _data_layout  = data_layout;
+    _kernel_dims  = kernel_dims;
+    _num_channels = num_channels;
+    _num_kernels  = num_kernels;
+
+    TensorInfo packed_info(compute_binary_sign_shape(compute_binary_weights_shape(weights_info(), num_channels, data_layout), data_layout), 1, DataType::U8);
+    packed_info.set_data_layout(data_layout);
+
+    // Release the memory of any previously packed or loaded weights
+    _weights.allocator()->free();
+    _alpha.allocator()->free();
+    _weights.allocator()->init(packed_info);
+    _alpha.allocator()->init(TensorInfo(TensorShape(num_kernels), 1, DataType::F32));
+}
+
+void NEBinaryWeights::pack(const ITensor *weights)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+
+    const DataLayout   data_layout = weights->info()->data_layout();
+    const unsigned int idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+    init(data_layout, Size2D(weights->info()->dimension(idx_w), weights->info()->dimension(idx_h)), weights->info()->dimension(idx_c), weights->info()->dimension(3));
+    _mapping.reset();
+
+    NEBinarySign binarize_weights;
+    binarize_weights.configure(weights, &_weights, &_alpha);
+
+    _weights.allocator()->allocate();
+    _alpha.allocator()->allocate();
+
+    binarize_weights.run();
+}
+
+void NEBinaryWeights::save(const std::string &filename) const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_num_kernels == 0, "No weights to save");
+    ARM_COMPUTE_ERROR_ON(_weights.info()->has_padding() || _alpha.info()->has_padding());
+
+    BinaryWeightsHeader header{};
+    header.magic          = binary_weights_magic;
+    header.version        = binary_weights_version;
+    header.data_layout    = (_data_layout == DataLayout::NHWC) ? 1 : 0;
+    header.kernel_width   = _kernel_dims.width;
+    header.kernel_height  = _kernel_dims.height;
+    header.num_channels   = _num_channels;
+    header.num_kernels    = _num_kernels;
+    header.weights_offset = align_offset(sizeof(header));
+    header.weights_size   = _weights.info()->total_size();
+    header.alpha_offset   = align_offset(header.weights_offset + header.weights_size);
+
+    std::ofstream fs(filename, std::ios::out | std::ios::binary);
+    if(!fs.good())
+    {
+        ARM_COMPUTE_ERROR("Cannot open %s for writing", filename.c_str());
+    }
+
+    const std::vector<char> padding(alignment, 0);
+
+    fs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    fs.write(padding.data(), header.weights_offset - sizeof(header));
+    fs.write(reinterpret_cast<const char *>(_weights.buffer() + _weights.info()->offset_first_element_in_bytes()), header.weights_size);
+    fs.write(padding.data(), header.alpha_offset - header.weights_offset - header.weights_size);
+    fs.write(reinterpret_cast<const char *>(_alpha.buffer() + _alpha.info()->offset_first_element_in_bytes()), _alpha.info()->total_size());
+
+    if(!fs.good())
+    {
+        ARM_COMPUTE_ERROR("Failed to write %s", filename.c_str());
+    }
+}
+
+void NEBinaryWeights::load(const std::string &filename)
+{
+#ifndef BARE_METAL
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        ARM_COMPUTE_ERROR("Cannot open %s", filename.c_str());
+    }
+
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(BinaryWeightsHeader))
+    {
+        close(fd);
+        ARM_COMPUTE_ERROR("%s is not a binary weights file", filename.c_str());
+    }
+
+    // The mapping stays valid once the file is closed
+    const size_t file_size = file_stat.st_size;
+    void        *ptr       = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(ptr == MAP_FAILED)
+    {
+        ARM_COMPUTE_ERROR("Cannot map %s", filename.c_str());
+    }
+
+    // Unmap any previous file only once the tensors don't point at it anymore
+    std::unique_ptr<void, Unmapper> mapping(ptr, Unmapper{ file_size });
+
+    const auto &header = *reinterpret_cast<const BinaryWeightsHeader *>(ptr);
+    if(header.magic != binary_weights_magic || header.version != binary_weights_version || header.data_layout > 1 || header.num_kernels == 0)
+    {
+        ARM_COMPUTE_ERROR("%s is not a binary weights file of a supported version", filename.c_str());
+    }
+
+    init((header.data_layout == 1) ? DataLayout::NHWC : DataLayout::NCHW, Size2D(header.kernel_width, header.kernel_height), header.num_channels, header.num_kernels);
+
+    if(header.weights_size != _weights.info()->total_size() || header.weights_offset % alignment != 0 || header.alpha_offset % alignment != 0
+       || header.weights_offset + static_cast<size_t>(header.weights_size) > file_size || header.alpha_offset + _alpha.info()->total_size() > file_size)
+    {
+        ARM_COMPUTE_ERROR("%s is truncated or corrupted", filename.c_str());
+    }
+
+    // The tensors point directly at the mapped file, which has been checked to be big enough for them
+    uint8_t *data = static_cast<uint8_t *>(ptr);
+    _weights.allocator()->import_memory(data + header.weights_offset, header.weights_size);
+    _alpha.allocator()->import_memory(data + header.alpha_offset, _alpha.info()->total_size());
+
+    _mapping = std::move(mapping);
+#else  // BARE_METAL
+    ARM_COMPUTE_UNUSED(filename);
+    ARM_COMPUTE_ERROR("Memory-mapped binary weights are not supported on bare metal");
+#endif // BARE_METAL
+}
+
+const ITensor *NEBinaryWeights::weights() const
+{
+    return &_weights;
+}
+
+const ITensor *NEBinaryWeights::alpha() const
+{
+    return &_alpha;
+}
+
+WeightsInfo NEBinaryWeights::weights_info() const
+{
+    return WeightsInfo(true, _kernel_dims.width, _kernel_dims.height, _num_kernels);
+}
+
+DataLayout NEBinaryWeights::data_layout() const
+{
+    return _data_layout;
+}
+
+unsigned int NEBinaryWeights::num_channels() const
+{
+    return _num_channels;
+}
@@ -37,38 +37,272 @@
 using namespace arm_compute;
 using namespace arm_compute::misc::shape_calculator;
 
+namespace
+{
+bool use_binary_gemm(DataLayout data_layout, const Size2D &kernel_sz)
+{
+    // With NHWC every im2col row is a plain copy of kernel_height contiguous rows, which is worth doing
+    // as soon as a kernel window spans more than one of them. 1x1 convolutions are already GEMMs for the direct kernel
+    return data_layout == DataLayout::NHWC && kernel_sz.area() > 1;
+}
+
+/** Fold a per-channel scale and shift into the alpha and biases tensors used by the output stage
+ *
+ * As each output is (N - 2 * mismatches) * alpha * K + bias, scaling it and adding a shift only changes alpha and bias.
+ */
+void fuse_scale_shift(const ITensor *alpha, const ITensor *biases, const ITensor *scale, const ITensor *shift, ITensor *fused_alpha, ITensor *fused_biases)
+{
+    const unsigned int num_kernels = fused_alpha->info()->dimension(0);
+
+    for(unsigned int i = 0; i < num_kernels; ++i)
+    {
+        const Coordinates id(i);
+        const float       scale_val = (scale != nullptr) ? *reinterpret_cast<const float *>(scale->ptr_to_element(id)) : 1.f;
+        const float       shift_val = (shift != nullptr) ? *reinterpret_cast<const float *>(shift->ptr_to_element(id)) : 0.f;
+        const float       bias_val  = (biases != nullptr) ? *reinterpret_cast<const float *>(biases->ptr_to_element(id)) : 0.f;
+
+        *reinterpret_cast<float *>(fused_alpha->ptr_to_element(id))  = *reinterpret_cast<const float *>(alpha->ptr_to_element(id)) * scale_val;
+        *reinterpret_cast<float *>(fused_biases->ptr_to_element(id)) = bias_val * scale_val + shift_val;
+    }
+}
+} // namespace
+
 NEBinaryConvolutionLayer::NEBinaryConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _pad_input(), _binarize_input(), _binarize_weights(), _binary_convolution(), _normalize_beta(), _padded_input(), _binarized_input(),
-      _binarized_weights(), _alpha(), _beta(), _K(), _is_prepared(false), _memory_manager(std::move(memory_manager))
+    : _memory_group(std::move(memory_manager)), _binarize_input(), _binarize_weights(), _binary_convolution(), _im2col(), _binary_gemm(), _original_weights(nullptr), _original_alpha(nullptr),
+      _original_biases(nullptr), _scale(nullptr), _shift(nullptr), _binarized_input(), _binarized_weights(), _im2col_output(), _alpha(), _fused_alpha(), _fused_biases(), _K(), _tmp(),
+      _split_dimension(Window::DimY), _secondary_split_dimension(Window::DimX), _use_binary_gemm(false), _is_prepared(false)
 {
 }
 
-void NEBinaryConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info)
+void NEBinaryConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                         const WeightsInfo &weights_info, const ITensor *alpha, const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info,
+                                         const ITensor *binarized_input, const ITensor *input_beta, ITensor *binarized_output, ITensor *output_beta)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_ERROR_THROW_ON(NEBinaryConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info));
-    
-    const PaddingList padding { PaddingInfo(conv_info.pad_left(), conv_info.pad_right()), PaddingInfo(conv_info.pad_top(), conv_info.pad_bottom()) };
-    _pad_input.configure(input, &_padded_input, padding, PixelValue(0));
-    _binarize_weights.configure(weights, &_binarized_weights, &_alpha);
-    _binarize_input.configure(&_padded_input, &_binarized_input, nullptr, &_beta);
-    _normalize_beta.configure(&_beta, &_K, PoolingLayerInfo(PoolingType::AVG, weights->info()->dimension(0), PadStrideInfo()));
-    _binary_convolution.configure(&_binarized_input, &_binarized_weights, biases, output, PadStrideInfo(), &_alpha, &_K,
-                                  Size2D(weights->info()->dimension(0), weights->info()->dimension(1)));
-    
-    _padded_input.allocator()->allocate();
-    _binarized_weights.allocator()->allocate();
-    _binarized_input.allocator()->allocate();
-    _alpha.allocator()->allocate();
-    _beta.allocator()->allocate();
+    ARM_COMPUTE_ERROR_THROW_ON(NEBinaryConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info,
+                                                                  weights_info, (alpha != nullptr) ? alpha->info() : nullptr, (scale != nullptr) ? scale->info() : nullptr,
+                                                                  (shift != nullptr) ? shift->info() : nullptr, act_info,
+                                                                  (binarized_input != nullptr) ? binarized_input->info() : nullptr, (input_beta != nullptr) ? input_beta->info() : nullptr,
+                                                                  (binarized_output != nullptr) ? binarized_output->info() : nullptr, (output_beta != nullptr) ? output_beta->info() : nullptr));
+
+    const DataLayout    data_layout = input->info()->data_layout();
+    const unsigned int  idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int  idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int  idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const bool          are_packed  = weights_info.are_reshaped();
+    const Size2D        kernel_sz   = are_packed ? Size2D(weights_info.kernel_size().first, weights_info.kernel_size().second) :
+                                      Size2D(weights->info()->dimension(idx_w), weights->info()->dimension(idx_h));
+    const PadStrideInfo stride_info(conv_info.stride().first, conv_info.stride().second, 0, 0);
+
+    // Pre-packed weights are used as they are, and don't need to be prepared
+    const ITensor *binarized_weights = are_packed ? weights : &_binarized_weights;
+    const ITensor *alpha_to_use      = are_packed ? alpha : &_alpha;
+    const ITensor *biases_to_use     = biases;
+
+    // When chained, the binarized tensors are used in place of the FP32 ones
+    const ITensor *input_to_use       = (binarized_input != nullptr) ? binarized_input : input;
+    ITensor       *output_to_use      = output;
+    ITensor       *output_beta_to_use = nullptr;
+
+    if(binarized_output != nullptr)
+    {
+        const TensorShape binarized_shape = compute_binary_sign_shape(output->info()->tensor_shape(), data_layout);
+        TensorShape       beta_shape      = output->info()->tensor_shape();
+        beta_shape.set(idx_c, 1);
+
+        auto_init_if_empty(*binarized_output->info(), output->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(binarized_shape).set_data_type(DataType::U8));
+        auto_init_if_empty(*output_beta->info(), output->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(beta_shape));
+        output_to_use      = binarized_output;
+        output_beta_to_use = output_beta;
+    }
+
+    // The scale and shift are folded into alpha and the biases when preparing the function
+    _original_alpha  = alpha_to_use;
+    _original_biases = biases;
+    _scale           = scale;
+    _shift           = shift;
+    if(scale != nullptr || shift != nullptr)
+    {
+        const TensorInfo fused_info(TensorShape(output->info()->dimension(idx_c)), 1, DataType::F32);
+        _fused_alpha.allocator()->init(fused_info);
+        _fused_biases.allocator()->init(fused_info);
+        alpha_to_use  = &_fused_alpha;
+        biases_to_use = &_fused_biases;
+    }
+
+    _original_weights = are_packed ? nullptr : weights;
+    _use_binary_gemm  = use_binary_gemm(data_layout, kernel_sz);
+
+    // Late layers have few rows, so the blocks of pixels within a row are split too to keep all the threads busy
+    _split_dimension           = (data_layout == DataLayout::NHWC) ? Window::DimZ : Window::DimY;
+    _secondary_split_dimension = (data_layout == DataLayout::NHWC) ? Window::DimY : Window::DimX;
+
+    // Each thread needs its own slice of the temporary tensor of the input binarization
+    const unsigned int padded_width = input->info()->dimension(idx_w) + conv_info.pad_left() + conv_info.pad_right();
+    _tmp.allocator()->init(TensorInfo(TensorShape(padded_width * (kernel_sz.height + 1), NEScheduler::get().num_threads()), 1, DataType::F32));
+
+    if(!are_packed)
+    {
+        _binarize_weights.configure(weights, &_binarized_weights, &_alpha);
+    }
+
+    // The intermediate tensors of the input are only alive for the duration of run()
+    _memory_group.manage(&_binarized_input);
+    _memory_group.manage(&_K);
+    _memory_group.manage(&_tmp);
+
+    _binarize_input.configure(input_to_use, &_binarized_input, &_K, &_tmp, kernel_sz, conv_info, (binarized_input != nullptr) ? input_beta : nullptr);
+    _tmp.allocator()->allocate();
+
+    if(_use_binary_gemm)
+    {
+        _memory_group.manage(&_im2col_output);
+
+        _im2col.configure(&_binarized_input, &_im2col_output, kernel_sz, stride_info);
+        _binarized_input.allocator()->allocate();
+
+        _binary_gemm.configure(&_im2col_output, binarized_weights, biases_to_use, output_to_use, alpha_to_use, &_K, kernel_sz.area() * input->info()->dimension(idx_c),
+                               output->info()->dimension(idx_h), act_info, output_beta_to_use);
+        _im2col_output.allocator()->allocate();
+    }
+    else
+    {
+        _binary_convolution.configure(&_binarized_input, binarized_weights, biases_to_use, output_to_use, stride_info, alpha_to_use, &_K, kernel_sz, input->info()->dimension(idx_c),
+                                      act_info, output_beta_to_use);
+        _binarized_input.allocator()->allocate();
+    }
+
     _K.allocator()->allocate();
 }
 
-Status NEBinaryConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info)
+Status NEBinaryConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                          const WeightsInfo &weights_info, const ITensorInfo *alpha, const ITensorInfo *scale, const ITensorInfo *shift,
+                                          const ActivationLayerInfo &act_info, const ITensorInfo *binarized_input, const ITensorInfo *input_beta,
+                                          const ITensorInfo *binarized_output, const ITensorInfo *output_beta)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
-    
-    // TODO
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NCHW, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights, output);
+
+    const DataLayout   data_layout = input->data_layout();
+    const unsigned int idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const bool         are_packed  = weights_info.are_reshaped();
+
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+
+    // The shape of the FP32 weights, which pre-packed weights have been binarized from
+    const TensorInfo unpacked_weights = are_packed ? TensorInfo(compute_binary_weights_shape(weights_info, input->dimension(idx_c), data_layout), 1, DataType::F32) : TensorInfo(*weights);
+
+    if(are_packed)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(alpha == nullptr, "Pre-packed weights require their alpha tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(weights->tensor_shape(), compute_binary_sign_shape(unpacked_weights.tensor_shape(), data_layout));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, alpha);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(alpha->tensor_shape(), TensorShape(weights_info.num_kernels()));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_c) != input->dimension(idx_c));
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_deep_convolution_shape(*input, unpacked_weights, conv_info));
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+    }
+
+    const TensorShape fused_shape(output->dimension(idx_c));
+    if(scale != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, scale);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(scale->tensor_shape(), fused_shape);
+    }
+    if(shift != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, shift);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(shift->tensor_shape(), fused_shape);
+    }
+
+    TensorShape input_beta_shape = input->tensor_shape();
+    input_beta_shape.set(idx_c, 1);
+    if(binarized_input != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(input_beta == nullptr, "A binarized input requires its beta tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(binarized_input, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, input_beta);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, binarized_input, input_beta);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(binarized_input->tensor_shape(), compute_binary_sign_shape(input->tensor_shape(), data_layout));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input_beta->tensor_shape(), input_beta_shape);
+    }
+
+    const Size2D        kernel_sz(unpacked_weights.dimension(idx_w), unpacked_weights.dimension(idx_h));
+    const PadStrideInfo stride_info(conv_info.stride().first, conv_info.stride().second, 0, 0);
+    const unsigned int  padded_width = input->dimension(idx_w) + conv_info.pad_left() + conv_info.pad_right();
+
+    TensorShape padded_shape = input->tensor_shape();
+    padded_shape.set(idx_w, padded_width);
+    padded_shape.set(idx_h, input->dimension(idx_h) + conv_info.pad_top() + conv_info.pad_bottom());
+    TensorShape K_shape = output->tensor_shape();
+    K_shape.set(idx_c, 1);
+
+    const TensorInfo padded_input(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_binary_sign_shape(padded_shape, data_layout)).set_data_type(DataType::U8));
+    const TensorInfo binarized_weights = are_packed ? TensorInfo(*weights) :
+                                         TensorInfo(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_binary_sign_shape(weights->tensor_shape(), data_layout)).set_data_type(DataType::U8));
+    const TensorInfo alpha_to_use = are_packed ? TensorInfo(*alpha) :
+                                    TensorInfo(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(TensorShape(weights->tensor_shape().total_size_upper(3))));
+    const TensorInfo K(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(K_shape));
+    const TensorInfo tmp(TensorShape(padded_width * (kernel_sz.height + 1)), 1, DataType::F32);
+    const TensorInfo fused(fused_shape, 1, DataType::F32);
+
+    // The scale and shift are folded into alpha and the biases
+    const bool         fuse_scale_shift = scale != nullptr || shift != nullptr;
+    const ITensorInfo *alpha_info       = fuse_scale_shift ? &fused : &alpha_to_use;
+    const ITensorInfo *biases_info      = fuse_scale_shift ? &fused : biases;
+
+    // When chained, the binarized tensors are used in place of the FP32 ones
+    const ITensorInfo *output_info      = output;
+    const ITensorInfo *output_beta_info = nullptr;
+    TensorInfo         binarized_output_to_use;
+    TensorInfo         output_beta_to_use;
+    if(binarized_output != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_beta == nullptr, "A binarized output requires its beta tensor");
+        binarized_output_to_use = (binarized_output->total_size() != 0) ? TensorInfo(*binarized_output) :
+                                  TensorInfo(output->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_binary_sign_shape(output->tensor_shape(), data_layout)).set_data_type(DataType::U8));
+        output_beta_to_use = (output_beta->total_size() != 0) ? TensorInfo(*output_beta) : TensorInfo(K);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&binarized_output_to_use, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(output, &binarized_output_to_use, &output_beta_to_use);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(binarized_output_to_use.tensor_shape(), compute_binary_sign_shape(output->tensor_shape(), data_layout));
+        output_info      = &binarized_output_to_use;
+        output_beta_info = &output_beta_to_use;
+    }
+
+    if(!are_packed)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEBinarySign::validate(weights, &binarized_weights, &alpha_to_use));
+    }
+    ARM_COMPUTE_RETURN_ON_ERROR(NEBinarizeInputKernel::validate((binarized_input != nullptr) ? binarized_input : input, &padded_input, &K, &tmp, kernel_sz, conv_info,
+                                                                (binarized_input != nullptr) ? input_beta : nullptr));
+
+    if(use_binary_gemm(data_layout, kernel_sz))
+    {
+        const TensorInfo im2col_output(padded_input.clone()->set_tensor_shape(compute_binary_im2col_shape(padded_input, kernel_sz, stride_info)));
+
+        ARM_COMPUTE_RETURN_ON_ERROR(NEBinaryIm2ColKernel::validate(&padded_input, &im2col_output, kernel_sz, stride_info));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEBinaryGEMMKernel::validate(&im2col_output, &binarized_weights, biases_info, output_info, alpha_info, &K, kernel_sz.area() * input->dimension(idx_c),
+                                                                 output->dimension(idx_h), act_info, output_beta_info));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEBinaryConvolutionKernel::validate(&padded_input, &binarized_weights, biases_info, output_info, stride_info, alpha_info, &K, kernel_sz,
+                                                                        input->dimension(idx_c), act_info, output_beta_info));
+    }
 
     return Status{};
 }
@@ -76,21 +310,46 @@ Status NEBinaryConvolutionLayer::validate(const ITensorInfo *input, const ITenso
 void NEBinaryConvolutionLayer::run()
 {
     prepare();
-    
-    _pad_input.run();
-    
-    NEScheduler::get().schedule(&_binarize_input, Window::DimX);
-    
-    _normalize_beta.run();
-    
-    NEScheduler::get().schedule(&_binary_convolution, Window::DimX);
-}
 
+    _memory_group.acquire();
+
+    NEScheduler::get().schedule(&_binarize_input, Window::DimY);
+
+    if(_use_binary_gemm)
+    {
+        NEScheduler::get().schedule(&_im2col, Window::DimY);
+        NEScheduler::get().schedule(&_binary_gemm, Window::DimY);
+    }
+    else
+    {
+        NEScheduler::get().schedule(&_binary_convolution, IScheduler::Hints(_split_dimension).set_secondary_split_dimension(_secondary_split_dimension));
+    }
+
+    _memory_group.release();
+}
 void NEBinaryConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        NEScheduler::get().schedule(&_binarize_weights, Window::DimX);        
+        // Pre-packed weights don't need to be binarized
+        if(_original_weights != nullptr)
+        {
+            ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+            // Binarize the weights and mark the original weights tensor as unused
+            _binarized_weights.allocator()->allocate();
+            _alpha.allocator()->allocate();
+            _binarize_weights.run();
+            _original_weights->mark_as_unused();
+        }
+
+        if(_scale != nullptr || _shift != nullptr)
+        {
+            _fused_alpha.allocator()->allocate();
+            _fused_biases.allocator()->allocate();
+            fuse_scale_shift(_original_alpha, _original_biases, _scale, _shift, &_fused_alpha, &_fused_biases);
+        }
+
         _is_prepared = true;
     }
 }
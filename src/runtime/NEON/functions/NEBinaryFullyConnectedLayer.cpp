@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEBinaryFullyConnectedLayer.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+NEBinaryFullyConnectedLayer::NEBinaryFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _binarize_input(), _binarize_weights(), _binary_gemm(), _original_weights(nullptr), _binarized_input(), _binarized_weights(), _alpha(),
+      _beta(), _is_prepared(false)
+{
+}
+
+void NEBinaryFullyConnectedLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEBinaryFullyConnectedLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info()));
+
+    // The mean over absolute values of each row of the weights is the alpha of the corresponding output,
+    // while the one of each input sample is its beta
+    _original_weights = weights;
+    _binarize_weights.configure(weights, &_binarized_weights, nullptr, &_alpha, true);
+
+    _memory_group.manage(&_binarized_input);
+    _memory_group.manage(&_beta);
+
+    _binarize_input.configure(input, &_binarized_input, nullptr, &_beta, true);
+    _binary_gemm.configure(&_binarized_input, &_binarized_weights, biases, output, &_alpha, &_beta, input->info()->dimension(0));
+
+    _binarized_input.allocator()->allocate();
+    _beta.allocator()->allocate();
+}
+
+Status NEBinaryFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != weights->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(1) != input->dimension(1));
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+    }
+
+    TensorShape alpha_shape = weights->tensor_shape();
+    alpha_shape.set(0, 1);
+    TensorShape beta_shape = input->tensor_shape();
+    beta_shape.set(0, 1);
+
+    const TensorInfo binarized_input(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_binary_sign_shape(input->tensor_shape(), DataLayout::NHWC)).set_data_type(DataType::U8));
+    const TensorInfo binarized_weights(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_binary_sign_shape(weights->tensor_shape(), DataLayout::NHWC)).set_data_type(DataType::U8));
+    const TensorInfo alpha(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(alpha_shape));
+    const TensorInfo beta(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(beta_shape));
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEBinarySignKernel::validate(weights, &binarized_weights, nullptr, &alpha, true));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEBinarySignKernel::validate(input, &binarized_input, nullptr, &beta, true));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEBinaryGEMMKernel::validate(&binarized_input, &binarized_weights, biases, output, &alpha, &beta, input->dimension(0)));
+
+    return Status{};
+}
+
+void NEBinaryFullyConnectedLayer::run()
+{
+    prepare();
+
+    _memory_group.acquire();
+
+    NEScheduler::get().schedule(&_binarize_input, Window::DimY);
+    NEScheduler::get().schedule(&_binary_gemm, Window::DimY);
+
+    _memory_group.release();
+}
+
+void NEBinaryFullyConnectedLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+        // Binarize the weights and mark the original weights tensor as unused
+        _binarized_weights.allocator()->allocate();
+        _alpha.allocator()->allocate();
+        NEScheduler::get().schedule(&_binarize_weights, Window::DimY);
+        _original_weights->mark_as_unused();
+        _is_prepared = true;
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEBinarySign.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+NEBinarySign::NEBinarySign(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _sign_kernel(), _alpha_kernel(), _partial_sums(), _split_dimension(Window::DimY), _calc_alpha(false)
+{
+}
+
+void NEBinarySign::configure(const ITensor *input, ITensor *output, ITensor *alpha, ITensor *beta)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEBinarySign::validate(input->info(), output->info(), (alpha != nullptr) ? alpha->info() : nullptr, (beta != nullptr) ? beta->info() : nullptr));
+
+    _calc_alpha = alpha != nullptr;
+
+    if(_calc_alpha)
+    {
+        _memory_group.manage(&_partial_sums);
+
+        _sign_kernel.configure(input, output, &_partial_sums, beta);
+        _alpha_kernel.configure(&_partial_sums, alpha, input->info()->tensor_shape().total_size_lower(3));
+
+        _partial_sums.allocator()->allocate();
+    }
+    else
+    {
+        _sign_kernel.configure(input, output, nullptr, beta);
+    }
+
+    // Split along the dimension with the most iterations, as weights usually have many more kernels than rows
+    const Window &win = _sign_kernel.window();
+    for(size_t d = Window::DimZ; d < 4; ++d)
+    {
+        if(win.num_iterations(d) > win.num_iterations(_split_dimension))
+        {
+            _split_dimension = d;
+        }
+    }
+}
+
+Status NEBinarySign::validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *alpha, const ITensorInfo *beta)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+
+    if(alpha != nullptr)
+    {
+        const TensorInfo partial_sums(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_binary_sign_partial_sums_shape(input->tensor_shape(), input->data_layout())));
+
+        ARM_COMPUTE_RETURN_ON_ERROR(NEBinarySignKernel::validate(input, output, &partial_sums, beta));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEBinaryAlphaKernel::validate(&partial_sums, alpha, input->tensor_shape().total_size_lower(3)));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEBinarySignKernel::validate(input, output, nullptr, beta));
+    }
+
+    return Status{};
+}
+
+void NEBinarySign::run()
+{
+    _memory_group.acquire();
+
+    NEScheduler::get().schedule(&_sign_kernel, _split_dimension);
+
+    if(_calc_alpha)
+    {
+        NEScheduler::get().schedule(&_alpha_kernel, Window::DimX);
+    }
+
+    _memory_group.release();
+}
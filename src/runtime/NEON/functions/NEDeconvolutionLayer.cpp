@@ -28,6 +28,7 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 using namespace arm_compute;
 using namespace arm_compute::misc::shape_calculator;
@@ -174,8 +175,10 @@ void NEDeconvolutionLayer::prepare()
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
         // Run weights flipping and mark original weights tensor as unused
-        _weights_flipped.allocator()->allocate();
-        NEScheduler::get().schedule(&_flip_weights, Window::DimZ);
+        if(!WeightsCache::acquire(_weights_flipped))
+        {
+            NEScheduler::get().schedule(&_flip_weights, Window::DimZ);
+        }
         _original_weights->mark_as_unused();
 
         // Prepare convolution
@@ -29,6 +29,7 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 using namespace arm_compute;
@@ -259,14 +260,14 @@ void NEDepthwiseConvolutionLayer3x3::run()
 }
 
 NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer()
-    : _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _v2mm_input_fill_border(), _v2mm_weights_fill_border(), _permute_input(),
-      _permute_weights(), _permute_output(), _activationlayer_function(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(), _permuted_input(), _permuted_weights(),
-      _permuted_output(), _is_prepared(false), _is_quantized(false), _is_nhwc(false), _is_activationlayer_enabled(false), _original_weights(nullptr)
+    : _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _v2mm_input_fill_border(), _v2mm_weights_fill_border(), _native_kernel(),
+      _activationlayer_function(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(), _accumulator(), _is_prepared(false), _is_quantized(false), _is_nhwc(false),
+      _is_activationlayer_enabled(false), _original_weights(nullptr)
 {
 }
 
 void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
-                                            unsigned int depth_multiplier, const ActivationLayerInfo &act_info)
+                                            unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
 {
     const unsigned int channel_idx = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL);
     ARM_COMPUTE_UNUSED(channel_idx);
@@ -275,36 +276,15 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     ARM_COMPUTE_ERROR_ON((input->info()->dimension(channel_idx) * depth_multiplier) != weights->info()->dimension(channel_idx));
 
-    _is_nhwc = input->info()->data_layout() == DataLayout::NHWC;
-
-    ITensor       *input_to_use   = input;
-    const ITensor *weights_to_use = weights;
-    ITensor       *output_to_use  = output;
-
-    if(_is_nhwc)
-    {
-        _permute_input.configure(input, &_permuted_input, PermutationVector(1U, 2U, 0U));
-        _permuted_input.info()->set_data_layout(DataLayout::NCHW);
-        input_to_use = &_permuted_input;
-
-        _permute_weights.configure(weights, &_permuted_weights, PermutationVector(1U, 2U, 0U));
-        _permuted_weights.info()->set_data_layout(DataLayout::NCHW);
-        weights_to_use = &_permuted_weights;
-    }
-
-    const size_t weights_w = weights_to_use->info()->dimension(0);
-    const size_t weights_h = weights_to_use->info()->dimension(1);
-    const size_t weights_z = weights_to_use->info()->dimension(2);
-
+    _is_nhwc          = input->info()->data_layout() == DataLayout::NHWC;
     _is_quantized     = is_data_type_quantized_asymmetric(input->info()->data_type());
     _is_prepared      = false;
-    _original_weights = weights_to_use;
+    _original_weights = weights;
 
-    // Should bias be appended ?
-    bool append_bias = (biases != nullptr) && !_is_quantized;
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_nhwc && dilation != Size2D(1U, 1U), "Dilation is only supported for NHWC");
 
     // Calculate output shape
-    TensorShape output_shape = shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier);
+    TensorShape output_shape = shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier, dilation);
 
     // Output auto inizialitation if not yet initialized
     auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
@@ -312,43 +292,76 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
 
     if(_is_nhwc)
     {
-        permute(output_shape, PermutationVector(1U, 2U, 0U));
-        _permuted_output.allocator()->init(output->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
-        _permuted_output.info()->set_data_layout(DataLayout::NCHW);
-        output_to_use = &_permuted_output;
+        // The native kernel works on the NHWC tensors as they are: no permutation nor reshape is needed
+        if(_is_quantized)
+        {
+            _accumulator.allocator()->init(output->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::S32).set_quantization_info(QuantizationInfo()));
+            _native_kernel.configure(input, weights, nullptr, &_accumulator, conv_info, depth_multiplier, dilation);
+        }
+        else
+        {
+            _native_kernel.configure(input, weights, biases, output, conv_info, depth_multiplier, dilation);
+        }
     }
+    else
+    {
+        const size_t weights_w = weights->info()->dimension(0);
+        const size_t weights_h = weights->info()->dimension(1);
+        const size_t weights_z = weights->info()->dimension(2);
+
+        // Should bias be appended ?
+        bool append_bias = (biases != nullptr) && !_is_quantized;
+
+        // Output width and height
+        const unsigned int conv_w = output_shape.x();
+        const unsigned int conv_h = output_shape.y();
+
+        // Set up intermediate tensors
+        const size_t patch_size = weights_w * weights_h + (append_bias ? 1 : 0);
+        const size_t conv_size  = conv_w * conv_h;
+
+        // Im2Col configuration
+        TensorShape shape_im2col = input->info()->tensor_shape();
+        shape_im2col.set(0, patch_size);
+        shape_im2col.set(1, conv_size);
+        shape_im2col.set(2, weights_z);
+        _input_reshaped.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col));
+        _im2col_kernel.configure(input, &_input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier);
+
+        // Weights reshape configuration
+        const TensorShape shape_weights_reshape(patch_size, weights_z);
+        _weights_reshaped.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_weights_reshape));
+        _weights_reshape_kernel.configure(weights, &_weights_reshaped, append_bias ? biases : nullptr);
+
+        // GEMV configuration
+        DataType    v2mm_dt        = (input->info()->data_type() == DataType::QASYMM8) ? DataType::S32 : input->info()->data_type();
+        TensorShape shape_v2mm_out = input->info()->tensor_shape();
+        shape_v2mm_out.set(0, conv_size * weights_z);
+        shape_v2mm_out.set(1, 1);
+        shape_v2mm_out.set(2, 1);
+        _v2mm_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(v2mm_dt).set_tensor_shape(shape_v2mm_out));
+        _v2mm_kernel.configure(&_input_reshaped, &_weights_reshaped, &_v2mm_output);
+        _output_reshaped.allocator()->init(_v2mm_output.info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
+        _vector_to_tensor_kernel.configure(&_v2mm_output, (_is_quantized) ? &_output_reshaped : output, conv_w, conv_h);
+
+        // Fill borders on inputs
+        PixelValue zero_in(static_cast<int32_t>(0));
+        PixelValue zero_w(static_cast<int32_t>(0));
+        if(_is_quantized)
+        {
+            zero_in = PixelValue(static_cast<int32_t>(input->info()->quantization_info().offset));
+            zero_w  = PixelValue(static_cast<int32_t>(weights->info()->quantization_info().offset));
+        }
+        BorderSize border_size = _v2mm_kernel.border_size();
+        _v2mm_input_fill_border.configure(&_input_reshaped, border_size, BorderMode::CONSTANT, zero_in);
 
-    // Output width and height
-    const unsigned int conv_w = output_shape.x();
-    const unsigned int conv_h = output_shape.y();
-
-    // Set up intermediate tensors
-    const size_t patch_size = weights_w * weights_h + (append_bias ? 1 : 0);
-    const size_t conv_size  = conv_w * conv_h;
-
-    // Im2Col configuration
-    TensorShape shape_im2col = input_to_use->info()->tensor_shape();
-    shape_im2col.set(0, patch_size);
-    shape_im2col.set(1, conv_size);
-    shape_im2col.set(2, weights_z);
-    _input_reshaped.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col).set_data_layout(DataLayout::NCHW));
-    _im2col_kernel.configure(input_to_use, &_input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier);
-
-    // Weights reshape configuration
-    const TensorShape shape_weights_reshape(patch_size, weights_z);
-    _weights_reshaped.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_weights_reshape).set_data_layout(DataLayout::NCHW));
-    _weights_reshape_kernel.configure(weights_to_use, &_weights_reshaped, append_bias ? biases : nullptr);
-
-    // GEMV configuration
-    DataType    v2mm_dt        = (input->info()->data_type() == DataType::QASYMM8) ? DataType::S32 : input->info()->data_type();
-    TensorShape shape_v2mm_out = input_to_use->info()->tensor_shape();
-    shape_v2mm_out.set(0, conv_size * weights_z);
-    shape_v2mm_out.set(1, 1);
-    shape_v2mm_out.set(2, 1);
-    _v2mm_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(v2mm_dt).set_tensor_shape(shape_v2mm_out).set_data_layout(DataLayout::NCHW));
-    _v2mm_kernel.configure(&_input_reshaped, &_weights_reshaped, &_v2mm_output);
-    _output_reshaped.allocator()->init(_v2mm_output.info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
-    _vector_to_tensor_kernel.configure(&_v2mm_output, (_is_quantized) ? &_output_reshaped : output_to_use, conv_w, conv_h);
+        border_size.bottom = 0;
+        _v2mm_weights_fill_border.configure(&_weights_reshaped, border_size, BorderMode::CONSTANT, zero_w);
+
+        // Allocate intermediate tensors
+        _input_reshaped.allocator()->allocate();
+        _v2mm_output.allocator()->allocate();
+    }
 
     // Output staged configuration
     if(_is_quantized)
@@ -358,36 +371,11 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
         float multiplier = input->info()->quantization_info().scale * weights->info()->quantization_info().scale / output_quant_info.scale;
         int   output_multiplier, output_shift;
         quantization::calculate_quantized_multiplier_less_than_one(multiplier, &output_multiplier, &output_shift);
-        _output_stage_kernel.configure(&_output_reshaped, biases, output_to_use, output_multiplier, output_shift, output_quant_info.offset);
-        _output_reshaped.allocator()->allocate();
-    }
-
-    if(_is_nhwc)
-    {
-        _permute_output.configure(&_permuted_output, output, PermutationVector(2U, 0U, 1U));
-
-        _permuted_input.allocator()->allocate();
-        _permuted_weights.allocator()->allocate();
-        _permuted_output.allocator()->allocate();
-    }
 
-    // Fill borders on inputs
-    PixelValue zero_in(static_cast<int32_t>(0));
-    PixelValue zero_w(static_cast<int32_t>(0));
-    if(_is_quantized)
-    {
-        zero_in = PixelValue(static_cast<int32_t>(input->info()->quantization_info().offset));
-        zero_w  = PixelValue(static_cast<int32_t>(weights->info()->quantization_info().offset));
+        Tensor *accumulator = _is_nhwc ? &_accumulator : &_output_reshaped;
+        _output_stage_kernel.configure(accumulator, biases, output, output_multiplier, output_shift, output_quant_info.offset);
+        accumulator->allocator()->allocate();
     }
-    BorderSize border_size = _v2mm_kernel.border_size();
-    _v2mm_input_fill_border.configure(&_input_reshaped, border_size, BorderMode::CONSTANT, zero_in);
-
-    border_size.bottom = 0;
-    _v2mm_weights_fill_border.configure(&_weights_reshaped, border_size, BorderMode::CONSTANT, zero_w);
-
-    // Allocate intermediate tensors
-    _input_reshaped.allocator()->allocate();
-    _v2mm_output.allocator()->allocate();
 
     //Configure Activation Layer
     _is_activationlayer_enabled = act_info.enabled();
@@ -399,89 +387,74 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
 }
 
 Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                             unsigned int depth_multiplier, const ActivationLayerInfo &act_info)
+                                             unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() == DataLayout::UNKNOWN);
 
-    const unsigned int width_idx  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
-    const unsigned int height_idx = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
+    const bool  is_quantized = is_data_type_quantized_asymmetric(input->data_type());
+    TensorShape output_shape = shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier, dilation);
 
     // Clone output to use auto init
     auto output_clone = output->clone();
-
-    const ITensorInfo *input_to_use   = input;
-    const ITensorInfo *weights_to_use = weights;
-    const ITensorInfo *output_to_use  = output_clone.get();
-
-    TensorShape permuted_input_shape   = input->tensor_shape();
-    TensorShape permuted_weights_shape = weights->tensor_shape();
-    TensorInfo  permuted_input;
-    TensorInfo  permuted_weights;
-
-    if(input->data_layout() == DataLayout::NHWC)
-    {
-        permute(permuted_input_shape, PermutationVector(1U, 2U, 0U));
-        permute(permuted_weights_shape, PermutationVector(1U, 2U, 0U));
-
-        permuted_input   = TensorInfo(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_input_shape).set_data_layout(DataLayout::NCHW));
-        permuted_weights = TensorInfo(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_weights_shape).set_data_layout(DataLayout::NCHW));
-
-        input_to_use   = &permuted_input;
-        weights_to_use = &permuted_weights;
-    }
-
-    const bool         is_quantized = is_data_type_quantized_asymmetric(input->data_type());
-    const bool         append_bias  = (biases != nullptr) && !is_quantized;
-    TensorShape        output_shape = shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier);
-    const size_t       weights_w    = weights_to_use->dimension(0);
-    const size_t       weights_h    = weights_to_use->dimension(1);
-    const size_t       weights_z    = weights_to_use->dimension(2);
-    const unsigned int conv_w       = output_shape[width_idx];
-    const unsigned int conv_h       = output_shape[height_idx];
-    const size_t       patch_size   = weights_w * weights_h + (append_bias ? 1 : 0);
-    const size_t       conv_size    = conv_w * conv_h;
-
-    // Output auto inizialitation if not yet initialized
     auto_init_if_empty(*output_clone, input->clone()->set_tensor_shape(output_shape));
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_clone->tensor_shape(), output_shape);
 
-    TensorInfo permuted_output;
     if(input->data_layout() == DataLayout::NHWC)
     {
-        permute(output_shape, PermutationVector(1U, 2U, 0U));
-        permuted_output = TensorInfo(output_clone->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape).set_data_layout(DataLayout::NCHW));
-        output_to_use   = &permuted_output;
+        if(is_quantized)
+        {
+            TensorInfo accumulator(output_clone->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::S32).set_quantization_info(QuantizationInfo()));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseConvolutionLayerNativeKernel::validate(input, weights, nullptr, &accumulator, conv_info, depth_multiplier, dilation));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&accumulator, biases, output_clone.get()));
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseConvolutionLayerNativeKernel::validate(input, weights, biases, output_clone.get(), conv_info, depth_multiplier, dilation));
+        }
     }
-
-    // Im2Col configuration
-    TensorShape shape_im2col = input_to_use->tensor_shape();
-    shape_im2col.set(0, patch_size);
-    shape_im2col.set(1, conv_size);
-    shape_im2col.set(2, weights_z);
-    TensorInfo input_reshaped(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col).set_data_layout(DataLayout::NCHW));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseIm2ColKernel::validate(input_to_use, &input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier));
-
-    // Weights reshape configuration
-    const TensorShape shape_weights_reshape(patch_size, weights_z);
-    TensorInfo        weights_reshaped(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_weights_reshape).set_data_layout(DataLayout::NCHW));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseWeightsReshapeKernel::validate(weights_to_use, &weights_reshaped, append_bias ? biases : nullptr));
-
-    // GEMV configuration
-    DataType    v2mm_dt        = (input->data_type() == DataType::QASYMM8) ? DataType::S32 : input->data_type();
-    TensorShape shape_v2mm_out = input_to_use->tensor_shape();
-    shape_v2mm_out.set(0, conv_size * weights_z);
-    shape_v2mm_out.set(1, 1);
-    shape_v2mm_out.set(2, 1);
-    TensorInfo v2mm_output(input->clone()->set_is_resizable(true).reset_padding().set_data_type(v2mm_dt).set_tensor_shape(shape_v2mm_out).set_data_layout(DataLayout::NCHW));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMMatrixVectorMultiplyKernel::validate(&input_reshaped, &weights_reshaped, &v2mm_output));
-
-    TensorInfo output_reshaped(v2mm_output.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_to_use->tensor_shape()));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseVectorToTensorKernel::validate(&v2mm_output, (is_quantized) ? &output_reshaped : output_to_use, conv_w, conv_h));
-
-    if(is_quantized)
+    else
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&output_reshaped, biases, output_to_use));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "Dilation is only supported for NHWC");
+
+        const bool         append_bias = (biases != nullptr) && !is_quantized;
+        const size_t       weights_w   = weights->dimension(0);
+        const size_t       weights_h   = weights->dimension(1);
+        const size_t       weights_z   = weights->dimension(2);
+        const unsigned int conv_w      = output_shape.x();
+        const unsigned int conv_h      = output_shape.y();
+        const size_t       patch_size  = weights_w * weights_h + (append_bias ? 1 : 0);
+        const size_t       conv_size   = conv_w * conv_h;
+
+        // Im2Col configuration
+        TensorShape shape_im2col = input->tensor_shape();
+        shape_im2col.set(0, patch_size);
+        shape_im2col.set(1, conv_size);
+        shape_im2col.set(2, weights_z);
+        TensorInfo input_reshaped(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseIm2ColKernel::validate(input, &input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier));
+
+        // Weights reshape configuration
+        const TensorShape shape_weights_reshape(patch_size, weights_z);
+        TensorInfo        weights_reshaped(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_weights_reshape));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseWeightsReshapeKernel::validate(weights, &weights_reshaped, append_bias ? biases : nullptr));
+
+        // GEMV configuration
+        DataType    v2mm_dt        = (input->data_type() == DataType::QASYMM8) ? DataType::S32 : input->data_type();
+        TensorShape shape_v2mm_out = input->tensor_shape();
+        shape_v2mm_out.set(0, conv_size * weights_z);
+        shape_v2mm_out.set(1, 1);
+        shape_v2mm_out.set(2, 1);
+        TensorInfo v2mm_output(input->clone()->set_is_resizable(true).reset_padding().set_data_type(v2mm_dt).set_tensor_shape(shape_v2mm_out));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMMatrixVectorMultiplyKernel::validate(&input_reshaped, &weights_reshaped, &v2mm_output));
+
+        TensorInfo output_reshaped(v2mm_output.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseVectorToTensorKernel::validate(&v2mm_output, (is_quantized) ? &output_reshaped : output_clone.get(), conv_w, conv_h));
+
+        if(is_quantized)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&output_reshaped, biases, output_clone.get()));
+        }
     }
 
     // Validate Activation Layer
@@ -499,21 +472,19 @@ void NEDepthwiseConvolutionLayer::run()
 
     if(_is_nhwc)
     {
-        _permute_input.run();
+        NEScheduler::get().schedule(&_native_kernel, Window::DimY);
     }
-
-    NEScheduler::get().schedule(&_im2col_kernel, Window::DimX);
-    NEScheduler::get().schedule(&_v2mm_input_fill_border, Window::DimX);
-    NEScheduler::get().schedule(&_v2mm_kernel, Window::DimX);
-    NEScheduler::get().schedule(&_vector_to_tensor_kernel, Window::DimX);
-    if(_is_quantized)
+    else
     {
-        NEScheduler::get().schedule(&_output_stage_kernel, Window::DimX);
+        NEScheduler::get().schedule(&_im2col_kernel, Window::DimX);
+        NEScheduler::get().schedule(&_v2mm_input_fill_border, Window::DimX);
+        NEScheduler::get().schedule(&_v2mm_kernel, Window::DimX);
+        NEScheduler::get().schedule(&_vector_to_tensor_kernel, Window::DimX);
     }
 
-    if(_is_nhwc)
+    if(_is_quantized)
     {
-        _permute_output.run();
+        NEScheduler::get().schedule(&_output_stage_kernel, Window::DimX);
     }
 
     if(_is_activationlayer_enabled)
@@ -526,19 +497,20 @@ void NEDepthwiseConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
-
-        if(_is_nhwc)
+        // The native kernel reads the original weights
+        if(!_is_nhwc)
         {
-            _permute_weights.run();
+            ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+            // Run reshape and mark original weights as unused
+            if(!WeightsCache::acquire(_weights_reshaped))
+            {
+                NEScheduler::get().schedule(&_weights_reshape_kernel, Window::DimX);
+                NEScheduler::get().schedule(&_v2mm_weights_fill_border, Window::DimX);
+            }
+            _original_weights->mark_as_unused();
         }
 
-        // Run reshape and mark original weights as unused
-        _weights_reshaped.allocator()->allocate();
-        NEScheduler::get().schedule(&_weights_reshape_kernel, Window::DimX);
-        NEScheduler::get().schedule(&_v2mm_weights_fill_border, Window::DimX);
-        _original_weights->mark_as_unused();
-
         _is_prepared = true;
     }
 }
@@ -35,7 +35,7 @@ using namespace arm_compute;
 
 NEDirectConvolutionLayer::NEDirectConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _output_stage_kernel(), _conv_kernel(), _input_border_handler(), _activationlayer_function(), _accumulator(), _has_bias(false),
-      _is_activationlayer_enabled(false), _dim_split(Window::DimZ)
+      _is_activationlayer_enabled(false), _dim_split(Window::DimZ), _secondary_dim_split(3)
 {
 }
 
@@ -49,7 +49,9 @@ void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights,
         _accumulator.allocator()->free();
     }
 
-    _dim_split = input->info()->data_layout() == DataLayout::NCHW ? Window::DimZ : Window::DimY;
+    // The NCHW kernel always computes whole output planes, so its window can only be split across the OFMs and the batches
+    _dim_split           = input->info()->data_layout() == DataLayout::NCHW ? Window::DimZ : Window::DimY;
+    _secondary_dim_split = input->info()->data_layout() == DataLayout::NCHW ? 3 : Window::DimZ;
 
     // Check if bias should be added in the convolution result
     _has_bias = (bias != nullptr);
@@ -107,7 +109,7 @@ void NEDirectConvolutionLayer::run()
 
     _memory_group.acquire();
 
-    NEScheduler::get().schedule(&_conv_kernel, _dim_split);
+    NEScheduler::get().schedule(&_conv_kernel, IScheduler::Hints(_dim_split).set_secondary_split_dimension(_secondary_dim_split));
     if(_has_bias)
     {
         NEScheduler::get().schedule(&_output_stage_kernel, Window::DimY);
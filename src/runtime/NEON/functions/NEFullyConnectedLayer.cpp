@@ -29,6 +29,7 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 #include <algorithm>
 #include <cmath>
@@ -388,8 +389,10 @@ void NEFullyConnectedLayer::prepare()
         if(!_are_weights_reshaped)
         {
             // Run reshape weights kernel and mark weights as unused
-            _reshape_weights_output.allocator()->allocate();
-            _reshape_weights_function.run();
+            if(!WeightsCache::acquire(_reshape_weights_output))
+            {
+                _reshape_weights_function.run();
+            }
 
             cur_weights->mark_as_unused();
             cur_weights           = &_reshape_weights_output;
@@ -399,8 +402,10 @@ void NEFullyConnectedLayer::prepare()
         // Convert weights if needed (happens only once)
         if(!_are_weights_converted)
         {
-            _converted_weights_output.allocator()->allocate();
-            _convert_weights.run();
+            if(!WeightsCache::acquire(_converted_weights_output))
+            {
+                _convert_weights.run();
+            }
 
             cur_weights->mark_as_unused();
             _are_weights_converted = true;
@@ -34,6 +34,7 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/TensorAllocator.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include <cmath>
@@ -286,8 +287,10 @@ void NEGEMM::prepare()
         {
             ARM_COMPUTE_ERROR_ON(!_original_b->is_used());
 
-            _tmp_b.allocator()->allocate();
-            NEScheduler::get().schedule(&_transpose_kernel, Window::DimY);
+            if(!WeightsCache::acquire(_tmp_b))
+            {
+                NEScheduler::get().schedule(&_transpose_kernel, Window::DimY);
+            }
             _original_b->mark_as_unused();
         }
 
@@ -30,13 +30,14 @@
 using namespace arm_compute;
 
 NEIm2Col::NEIm2Col()
-    : _kernel(), _y_dim(1)
+    : _kernel(), _y_dim(1), _x_dim(0)
 {
 }
 
 void NEIm2Col::configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation, unsigned int num_groups)
 {
     _y_dim = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::HEIGHT);
+    _x_dim = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::WIDTH);
 
     _kernel.configure(input, output, kernel_dims, conv_info, has_bias, dilation, num_groups);
 }
@@ -49,5 +50,5 @@ Status NEIm2Col::validate(const ITensorInfo *input, const ITensorInfo *output, c
 
 void NEIm2Col::run()
 {
-    NEScheduler::get().schedule(&_kernel, _y_dim);
+    NEScheduler::get().schedule(&_kernel, IScheduler::Hints(_y_dim).set_secondary_split_dimension(_x_dim));
 }
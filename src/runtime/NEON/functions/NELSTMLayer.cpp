@@ -28,9 +28,12 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
 
 #include <cmath>
+#include <cstring>
 #include <memory>
 #include <tuple>
 
@@ -38,15 +41,8 @@ using namespace arm_compute;
 using namespace arm_compute::misc::shape_calculator;
 
 NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _fully_connected_input_gate(), _gemm_input_gate(), _transpose_input_gate(), _accum_input_gate1(), _accum_input_gate2(), _subtract_input_gate(),
-      _pixelwise_mul_input_gate(), _activation_input_gate(), _fully_connected_forget_gate(), _gemm_forget_gate(), _transpose_forget_gate(), _accum_forget_gate1(), _accum_forget_gate2(),
-      _pixelwise_mul_forget_gate(), _activation_forget_gate(), _fully_connected_cell_state(), _gemm_cell_state1(), _gemm_cell_state2(), _transpose_cell_state(), _accum_cell_state1(), _accum_cell_state2(),
-      _pixelwise_mul_cell_state1(), _activation_cell_state(), _cell_clip(), _pixelwise_mul_cell_state2(), _fully_connected_output(), _gemm_output(), _pixelwise_mul_output_state1(), _transpose_output(),
-      _accum_output1(), _accum_output2(), _activation_output(), _activation_output_state(), _pixelwise_mul_output_state2(), _fully_connected_output_state(), _gemm_output_state(), _accum_output_state(),
-      _projection_clip(), _copy_cell_state(), _copy_output(), _concat_scratch_buffer(), _input_gate_out1(), _input_gate_out2(), _input_gate_out3(), _input_gate_out4(), _input_gate_out5(),
-      _forget_gate_out1(), _forget_gate_out2(), _forget_gate_out3(), _forget_gate_out4(), _forget_gate_out5(), _cell_state_out1(), _cell_state_out2(), _cell_state_out3(), _cell_state_out4(),
-      _cell_state_out5(), _output1(), _output2(), _output3(), _output4(), _output5(), _cell_state_activation(), _output_state1(), _ones(), _run_peephole_opt(false), _run_cifg_opt(false),
-      _perform_cell_clipping(false), _has_projection_weights(false), _perform_projection_clipping(false)
+    : _memory_group(std::move(memory_manager)), _concat_input(), _concat_output_state(), _gemm_gates(), _cell_kernel(), _fully_connected_output_state(), _projection_clip(), _copy_output(),
+      _gate_input(), _gate_weights(), _gates(), _output_state1(), _input_weights(), _recurrent_weights(), _has_projection_weights(false), _perform_projection_clipping(false), _is_prepared(false)
 {
 }
 
@@ -92,215 +88,69 @@ void NELSTMLayer::configure(const ITensor *input,
                                                      scratch_buffer->info(), output_state_out->info(), cell_state_out->info(), output->info(),
                                                      lstm_params_info, activation_info, cell_threshold, projection_threshold));
 
-    const TensorShape cell_state_shape = cell_state_in->info()->tensor_shape();
-
-    // Configure block that calculates the forget gate
-    // forget_gate = Activation(input * input_to_forget_weights + output_state_in * recurrent_to_forget_weights + PixelWiseMul(cell_state, cell_to_forget_weights) + forget_gate_bias)
-    TensorShape forget_gate1_shape = compute_transposed_shape(*recurrent_to_output_weights->info());
-    _forget_gate_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _forget_gate_out2.allocator()->init(TensorInfo(forget_gate1_shape, 1, input->info()->data_type()));
-    _forget_gate_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _forget_gate_out5.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    _memory_group.manage(&_forget_gate_out1);
-    _fully_connected_forget_gate.configure(input, input_to_forget_weights, forget_gate_bias, &_forget_gate_out1);
-    _memory_group.manage(&_forget_gate_out2);
-    _transpose_forget_gate.configure(recurrent_to_forget_weights, &_forget_gate_out2);
-    _memory_group.manage(&_forget_gate_out3);
-    _gemm_forget_gate.configure(output_state_in, &_forget_gate_out2, nullptr, &_forget_gate_out3, 1.f, 0.f);
-    _forget_gate_out2.allocator()->allocate();
-    _memory_group.manage(&_forget_gate_out5);
-    _accum_forget_gate1.configure(&_forget_gate_out1, &_forget_gate_out3, &_forget_gate_out5, ConvertPolicy::SATURATE);
-    _forget_gate_out1.allocator()->allocate();
-    Tensor *forget_gate_out = &_forget_gate_out5;
-    if(lstm_params.has_peephole_opt())
-    {
-        _forget_gate_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-        _run_peephole_opt = true;
-        _memory_group.manage(&_forget_gate_out4);
-        _pixelwise_mul_forget_gate.configure(cell_state_in, lstm_params.cell_to_forget_weights(), &_forget_gate_out4, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-        _accum_forget_gate2.configure(&_forget_gate_out5, &_forget_gate_out4, &_forget_gate_out3, ConvertPolicy::SATURATE);
-        _forget_gate_out4.allocator()->allocate();
-        _forget_gate_out5.allocator()->allocate();
-        forget_gate_out = &_forget_gate_out3;
-    }
-    else
-    {
-        _forget_gate_out3.allocator()->allocate();
-    }
-    _activation_forget_gate.configure(forget_gate_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-
-    // Configure block that calculates the input gate
-    // input_gate = Activation(input * input_to_input_weights + output_state * recurrent_to_input_weights + PixelWiseMul(cell_state, cell_to_input_weights) + input_gate_bias), without CIFG
-    // input_gate = 1 - forget_gate, with CIFG
-    _input_gate_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    Tensor *input_gate_out = &_input_gate_out1;
-    if(lstm_params.has_cifg_opt())
-    {
-        _memory_group.manage(&_input_gate_out1);
-        _ones.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _subtract_input_gate.configure(&_ones, forget_gate_out, &_input_gate_out1, ConvertPolicy::SATURATE);
-        _ones.allocator()->allocate();
-        _run_cifg_opt = true;
-    }
-    else
-    {
-        TensorShape input_gate_shape = compute_transposed_shape(*recurrent_to_output_weights->info());
-
-        _input_gate_out2.allocator()->init(TensorInfo(input_gate_shape, 1, input->info()->data_type()));
-        _input_gate_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _input_gate_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _input_gate_out5.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-        _memory_group.manage(&_input_gate_out1);
-        _fully_connected_input_gate.configure(input, lstm_params.input_to_input_weights(), lstm_params.input_gate_bias(), &_input_gate_out1);
-        _memory_group.manage(&_input_gate_out2);
-        _transpose_input_gate.configure(lstm_params.recurrent_to_input_weights(), &_input_gate_out2);
-        _memory_group.manage(&_input_gate_out3);
-        _gemm_input_gate.configure(output_state_in, &_input_gate_out2, nullptr, &_input_gate_out3, 1.f, 0.f);
-        _input_gate_out2.allocator()->allocate();
-        _memory_group.manage(&_input_gate_out4);
-        _accum_input_gate1.configure(&_input_gate_out1, &_input_gate_out3, &_input_gate_out4, ConvertPolicy::SATURATE);
-        _input_gate_out3.allocator()->allocate();
-        input_gate_out = &_input_gate_out4;
-        if(_run_peephole_opt)
-        {
-            _memory_group.manage(&_input_gate_out5);
-            _pixelwise_mul_input_gate.configure(cell_state_in, lstm_params.cell_to_input_weights(), &_input_gate_out5, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-            _accum_input_gate2.configure(&_input_gate_out4, &_input_gate_out5, &_input_gate_out1, ConvertPolicy::SATURATE);
-            _input_gate_out4.allocator()->allocate();
-            _input_gate_out5.allocator()->allocate();
-            input_gate_out = &_input_gate_out1;
-        }
-        else
-        {
-            _input_gate_out1.allocator()->allocate();
-        }
-        _activation_input_gate.configure(input_gate_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-    }
-
-    // Configure block that calculates the cell state
-    // cell_state = Clip((PixelwiseMul(input_gate, Activation(input * input_to_cell_weights + output_state_in * recurrent_to_cell_weights + cell_bias)) + PixelwiseMul(forget_gate, cell_state)), cell_threshold)
-    TensorShape cell_state1_shape = compute_transposed_shape(*recurrent_to_output_weights->info());
-    _cell_state_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out2.allocator()->init(TensorInfo(cell_state1_shape, 1, input->info()->data_type()));
-    _cell_state_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out5.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    _memory_group.manage(&_cell_state_out1);
-    _fully_connected_cell_state.configure(input, input_to_cell_weights, cell_bias, &_cell_state_out1);
-    _memory_group.manage(&_cell_state_out2);
-    _transpose_cell_state.configure(recurrent_to_cell_weights, &_cell_state_out2);
-    _memory_group.manage(&_cell_state_out3);
-    _gemm_cell_state1.configure(output_state_in, &_cell_state_out2, nullptr, &_cell_state_out3, 1.f, 0.f);
-    _cell_state_out2.allocator()->allocate();
-    _memory_group.manage(&_cell_state_out4);
-    _accum_cell_state1.configure(&_cell_state_out1, &_cell_state_out3, &_cell_state_out4, ConvertPolicy::SATURATE);
-    _activation_cell_state.configure(&_cell_state_out4, nullptr, activation_info);
-    _memory_group.manage(&_cell_state_out5);
-    _pixelwise_mul_cell_state1.configure(&_cell_state_out4, input_gate_out, &_cell_state_out5, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    _cell_state_out4.allocator()->allocate();
-    _pixelwise_mul_cell_state2.configure(forget_gate_out, cell_state_in, &_cell_state_out3, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    _accum_cell_state2.configure(&_cell_state_out5, &_cell_state_out3, &_cell_state_out1, ConvertPolicy::SATURATE);
-    _cell_state_out3.allocator()->allocate();
-    _cell_state_out5.allocator()->allocate();
-    // Perform clipping
-    if(cell_threshold != 0.f)
-    {
-        _perform_cell_clipping = true;
-        _cell_clip.configure(&_cell_state_out1, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -cell_threshold, cell_threshold));
-    }
+    const unsigned int input_size  = input->info()->dimension(0);
+    const unsigned int output_size = output_state_in->info()->dimension(0);
+    const unsigned int num_units   = cell_state_in->info()->dimension(0);
+    const unsigned int num_batches = input->info()->dimension(1);
+    const unsigned int num_gates   = lstm_params.has_cifg_opt() ? 3 : 4;
+    const DataType     data_type   = input->info()->data_type();
 
-    // Configure block that calculates the output
-    // output_state_out = Activation(input * input_to_output_weights + output_state_in * recurrent_to_output_weights + PixelWiseMul(cell_state, cell_to_output_weights) + output_gate_bias)
-    TensorShape output1_shape = compute_transposed_shape(*recurrent_to_output_weights->info());
-    _output1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _output2.allocator()->init(TensorInfo(output1_shape, 1, input->info()->data_type()));
-    _output3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _output5.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    _memory_group.manage(&_output1);
-    _fully_connected_output.configure(input, input_to_output_weights, output_gate_bias, &_output1);
-    _memory_group.manage(&_output2);
-    _transpose_output.configure(recurrent_to_output_weights, &_output2);
-    _memory_group.manage(&_output3);
-    _gemm_output.configure(output_state_in, &_output2, nullptr, &_output3, 1.f, 0.f);
-    _output2.allocator()->allocate();
-    _memory_group.manage(&_output5);
-    _accum_output1.configure(&_output1, &_output3, &_output5, ConvertPolicy::SATURATE);
-    _output3.allocator()->allocate();
-    Tensor *output_gate_out = &_output5;
-    if(lstm_params.has_peephole_opt())
+    // Weights of the gates in the order they are stacked in, the input gate is computed from the forget gate with CIFG
+    _input_weights.clear();
+    _recurrent_weights.clear();
+    if(!lstm_params.has_cifg_opt())
     {
-        _output4.allocator()->init(TensorInfo(_cell_state_out1.info()->tensor_shape(), 1, input->info()->data_type()));
-
-        _memory_group.manage(&_output4);
-        _pixelwise_mul_output_state1.configure(&_cell_state_out1, lstm_params.cell_to_output_weights(), &_output4, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-        _accum_output2.configure(&_output5, &_output4, &_output1, ConvertPolicy::SATURATE);
-        _output5.allocator()->allocate();
-        output_gate_out = &_output1;
-
-        // Allocate intermediate buffers
-        _output4.allocator()->allocate();
+        _input_weights.push_back(lstm_params.input_to_input_weights());
+        _recurrent_weights.push_back(lstm_params.recurrent_to_input_weights());
     }
-    else
+    _input_weights.insert(_input_weights.end(), { input_to_forget_weights, input_to_cell_weights, input_to_output_weights });
+    _recurrent_weights.insert(_recurrent_weights.end(), { recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights });
+
+    // Configure block that calculates the matrix products of all the gates
+    // gates = [input, output_state_in] * [input_to_gate_weights ; recurrent_to_gate_weights]^T
+    _gate_input.allocator()->init(TensorInfo(TensorShape(input_size + output_size, num_batches), 1, data_type));
+    _gate_weights.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, input_size + output_size), 1, data_type));
+    _gates.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, num_batches), 1, data_type));
+
+    _memory_group.manage(&_gate_input);
+    _concat_input.configure(input, 0, &_gate_input);
+    _concat_output_state.configure(output_state_in, input_size, &_gate_input);
+    _memory_group.manage(&_gates);
+    _gemm_gates.configure(&_gate_input, &_gate_weights, nullptr, &_gates, 1.f, 0.f, GEMMInfo(false, false, true /* reshape_b_only_on_first_run */));
+    _gate_input.allocator()->allocate();
+
+    // Configure block that calculates the gates, the cell state and the output state in a single pass
+    _has_projection_weights = lstm_params.has_projection();
+    ITensor *output_state_out_tmp = _has_projection_weights ? &_output_state1 : output_state_out;
+    if(_has_projection_weights)
     {
-        _output1.allocator()->allocate();
+        _output_state1.allocator()->init(TensorInfo(cell_state_in->info()->tensor_shape(), 1, data_type));
+        _memory_group.manage(&_output_state1);
     }
-    _activation_output.configure(output_gate_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-
-    // Configure block that calculates the output state
-    /** lstm_res = PixelwiseMul(output, Activation(cell_state))
-     *
-     *                      -- Clip(lstm_res * projection_weights + projection_bias, projection_threshold) , if there is a projection
-     *                     /
-     *  output_state =  --
-     *                     \
-     *                      -- lstm_res , otherwise
-     */
-    ITensor *output_state_out_tmp = lstm_params.has_projection() ? &_output_state1 : output_state_out;
-    _cell_state_activation.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _output_state1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    _memory_group.manage(&_cell_state_activation);
-    _activation_output_state.configure(&_cell_state_out1, &_cell_state_activation, activation_info);
-    _pixelwise_mul_output_state2.configure(&_cell_state_activation, output_gate_out, output_state_out_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    _cell_state_activation.allocator()->allocate();
-    output_gate_out->allocator()->allocate();
-
-    if(lstm_params.has_projection())
+    const ITensor *cell_to_input_weights = (lstm_params.has_peephole_opt() && !lstm_params.has_cifg_opt()) ? lstm_params.cell_to_input_weights() : nullptr;
+    _cell_kernel.configure(&_gates,
+                           lstm_params.has_cifg_opt() ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                           cell_to_input_weights, lstm_params.cell_to_forget_weights(), lstm_params.cell_to_output_weights(),
+                           cell_state_in, cell_state_out, output_state_out_tmp, scratch_buffer,
+                           activation_info, cell_threshold);
+    _gates.allocator()->allocate();
+
+    // Configure block that calculates the projection of the output state
+    if(_has_projection_weights)
     {
-        _has_projection_weights = true;
         _fully_connected_output_state.configure(output_state_out_tmp, lstm_params.projection_weights(), lstm_params.projection_bias(), output_state_out);
         _output_state1.allocator()->allocate();
         // Perform clipping
         if(projection_threshold != 0.f)
         {
             _perform_projection_clipping = true;
-            _projection_clip.configure(output_state_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold, projection_threshold));
+            _projection_clip.configure(output_state_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, projection_threshold, -projection_threshold));
         }
     }
 
-    // Copy cell state and output
-    _copy_cell_state.configure(&_cell_state_out1, cell_state_out);
+    // Copy output
     _copy_output.configure(output_state_out, output);
-
-    // Vector for holding the tensors to store in scratch buffer
-    std::vector<ITensor *> scratch_inputs;
-    if(!lstm_params.has_cifg_opt())
-    {
-        scratch_inputs.emplace_back(input_gate_out);
-    }
-    scratch_inputs.emplace_back(&_cell_state_out1);
-    scratch_inputs.emplace_back(forget_gate_out);
-    scratch_inputs.emplace_back(output_gate_out);
-    _concat_scratch_buffer.configure(scratch_inputs, scratch_buffer);
-    input_gate_out->allocator()->allocate();
-    _cell_state_out1.allocator()->allocate();
-    forget_gate_out->allocator()->allocate();
-    output_gate_out->allocator()->allocate();
+    _is_prepared = false;
 }
 
 Status NELSTMLayer::validate(const ITensorInfo *input,
@@ -358,28 +208,14 @@ Status NELSTMLayer::validate(const ITensorInfo *input,
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.cell_to_output_weights()->num_dimensions() > 1);
     }
 
-    TensorShape      units_out_transposed_shape = compute_transposed_shape(*recurrent_to_output_weights);
-    TensorShape      num_units_transposed_shape = compute_transposed_shape(*forget_gate_bias);
-    const TensorInfo units_out_transposed_info  = TensorInfo(units_out_transposed_shape, 1, input->data_type());
-    const TensorInfo num_units_transposed_info  = TensorInfo(num_units_transposed_shape, 1, input->data_type());
-
-    TensorInfo input_gate      = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo forget_gate     = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo output_gate_tmp = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo cell_state_tmp  = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
+    const unsigned int input_size  = input->dimension(0);
+    const unsigned int output_size = output_state_in->dimension(0);
+    const unsigned int num_gates   = lstm_params.has_cifg_opt() ? 3 : 4;
 
-    // Validate forget gate
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, input_to_forget_weights, forget_gate_bias, &forget_gate));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(output_state_in, &units_out_transposed_info, nullptr, &forget_gate, 1.f, 0.f, GEMMInfo()));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(&forget_gate, &forget_gate, &forget_gate, ConvertPolicy::SATURATE));
-    if(lstm_params.has_peephole_opt())
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(cell_state_in, lstm_params.cell_to_forget_weights(), &forget_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&forget_gate, &forget_gate, &forget_gate, ConvertPolicy::SATURATE));
-    }
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&forget_gate, &forget_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
-
-    // Validate input gate
+    // Check the weights of the gates
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(forget_gate_bias, cell_bias, output_gate_bias);
+    std::vector<const ITensorInfo *> input_weights{ input_to_forget_weights, input_to_cell_weights, input_to_output_weights };
+    std::vector<const ITensorInfo *> recurrent_weights{ recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights };
     if(!lstm_params.has_cifg_opt())
     {
         ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.input_to_input_weights(),
@@ -388,151 +224,70 @@ Status NELSTMLayer::validate(const ITensorInfo *input,
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.input_to_input_weights()->num_dimensions() > 2);
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.recurrent_to_input_weights()->num_dimensions() > 2);
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.input_gate_bias()->num_dimensions() > 1);
-
-        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, lstm_params.input_to_input_weights(), lstm_params.input_gate_bias(), &input_gate));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(output_state_in, &units_out_transposed_info, nullptr, &input_gate, 1.f, 0.f, GEMMInfo()));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&input_gate, &input_gate, &input_gate, ConvertPolicy::SATURATE));
+        input_weights.push_back(lstm_params.input_to_input_weights());
+        recurrent_weights.push_back(lstm_params.recurrent_to_input_weights());
         if(lstm_params.has_peephole_opt())
         {
             ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.cell_to_input_weights());
             ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.cell_to_input_weights()->num_dimensions() > 1);
-            ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(cell_state_in, lstm_params.cell_to_input_weights(), &input_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-            ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&input_gate, &input_gate, &input_gate, ConvertPolicy::SATURATE));
         }
-        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&input_gate, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
     }
-    else
+    for(const ITensorInfo *weights : input_weights)
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticSubtractionKernel::validate(&forget_gate, &forget_gate, &forget_gate, ConvertPolicy::SATURATE));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input_size || weights->dimension(1) != num_cells);
     }
-
-    // Validate cell state
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, input_to_cell_weights, cell_bias, &cell_state_tmp));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(output_state_in, &units_out_transposed_info, nullptr, &cell_state_tmp, 1.f, 0.f, GEMMInfo()));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&cell_state_tmp, &cell_state_tmp, &cell_state_tmp, ConvertPolicy::SATURATE));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&cell_state_tmp, nullptr, activation_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, &input_gate, &cell_state_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, &forget_gate, &cell_state_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&cell_state_tmp, &cell_state_tmp, &cell_state_tmp, ConvertPolicy::SATURATE));
-    if(cell_threshold != 0.f)
+    for(const ITensorInfo *weights : recurrent_weights)
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&cell_state_tmp, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -cell_threshold,
-                                                                                                                    cell_threshold)));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != output_size || weights->dimension(1) != num_cells);
     }
 
-    // Validate output gate tmp
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, input_to_output_weights, output_gate_bias, &output_gate_tmp));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(output_state_in, &units_out_transposed_info, nullptr, &output_gate_tmp, 1.f, 0.f, GEMMInfo()));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&output_gate_tmp, &output_gate_tmp, &output_gate_tmp, ConvertPolicy::SATURATE));
-    if(lstm_params.has_peephole_opt())
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, lstm_params.cell_to_output_weights(), &output_gate_tmp, 1, ConvertPolicy::SATURATE,
-                                                                              RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&output_gate_tmp, &output_gate_tmp, &output_gate_tmp, ConvertPolicy::SATURATE));
-    }
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&output_gate_tmp, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
+    const TensorInfo gate_input   = TensorInfo(TensorShape(input_size + output_size, num_batches), 1, input->data_type());
+    const TensorInfo gate_weights = TensorInfo(TensorShape(num_gates * num_cells, input_size + output_size), 1, input->data_type());
+    const TensorInfo gates        = TensorInfo(TensorShape(num_gates * num_cells, num_batches), 1, input->data_type());
+    TensorInfo       output_state = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
+
+    // Validate the matrix products of the gates
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayerKernel::validate(input, 0, &gate_input));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayerKernel::validate(output_state_in, input_size, &gate_input));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(&gate_input, &gate_weights, nullptr, &gates, 1.f, 0.f, GEMMInfo(false, false, true)));
+
+    // Validate cell
+    const ITensorInfo *cell_to_input_weights = (lstm_params.has_peephole_opt() && !lstm_params.has_cifg_opt()) ? lstm_params.cell_to_input_weights() : nullptr;
+    ARM_COMPUTE_RETURN_ON_ERROR(NELSTMCellKernel::validate(&gates,
+                                                           lstm_params.has_cifg_opt() ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                                                           cell_to_input_weights, lstm_params.cell_to_forget_weights(), lstm_params.cell_to_output_weights(),
+                                                           cell_state_in, cell_state_out, lstm_params.has_projection() ? &output_state : output_state_out, scratch_buffer,
+                                                           activation_info, cell_threshold));
 
     // Validate output state
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&cell_state_tmp, &cell_state_tmp, activation_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, &output_gate_tmp, &output_gate_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
     if(lstm_params.has_projection())
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&output_gate_tmp, lstm_params.projection_weights(), lstm_params.projection_bias(), output_state_out));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&output_state, lstm_params.projection_weights(), lstm_params.projection_bias(), output_state_out));
         if(projection_threshold != 0.f)
         {
             ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(output_state_out, output_state_out,
-                                                                          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold, projection_threshold)));
+                                                                          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, projection_threshold, -projection_threshold)));
         }
     }
 
     // Validate copy kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(&cell_state_tmp, cell_state_out));
     ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(output_state_out, output));
 
-    // Validate scratch concatenation
-    std::vector<ITensorInfo *> inputs_vector_info_raw;
-    if(!lstm_params.has_cifg_opt())
-    {
-        inputs_vector_info_raw.push_back(&input_gate);
-    }
-    inputs_vector_info_raw.push_back(&cell_state_tmp);
-    inputs_vector_info_raw.push_back(&forget_gate);
-    inputs_vector_info_raw.push_back(&output_gate_tmp);
-
-    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(inputs_vector_info_raw, scratch_buffer));
     return Status{};
 }
 
 void NELSTMLayer::run()
 {
-    _memory_group.acquire();
+    prepare();
 
-    _fully_connected_forget_gate.run();
-    NEScheduler::get().schedule(&_transpose_forget_gate, Window::DimY);
-    _gemm_forget_gate.run();
-    NEScheduler::get().schedule(&_accum_forget_gate1, Window::DimY);
-
-    if(_run_peephole_opt)
-    {
-        NEScheduler::get().schedule(&_pixelwise_mul_forget_gate, Window::DimY);
-        _accum_forget_gate2.run();
-    }
-    NEScheduler::get().schedule(&_activation_forget_gate, Window::DimY);
-
-    if(_run_cifg_opt)
-    {
-        if(_ones.info()->data_type() == DataType::F16)
-        {
-            std::fill_n(reinterpret_cast<half *>(_ones.buffer()), _ones.info()->total_size() / _ones.info()->element_size(), 1);
-        }
-        else
-        {
-            std::fill_n(reinterpret_cast<float *>(_ones.buffer()), _ones.info()->total_size() / _ones.info()->element_size(), 1);
-        }
-        NEScheduler::get().schedule(&_subtract_input_gate, Window::DimY);
-    }
-    else
-    {
-        _fully_connected_input_gate.run();
-        NEScheduler::get().schedule(&_transpose_input_gate, Window::DimY);
-        _gemm_input_gate.run();
-        NEScheduler::get().schedule(&_accum_input_gate1, Window::DimY);
-        if(_run_peephole_opt)
-        {
-            NEScheduler::get().schedule(&_pixelwise_mul_input_gate, Window::DimY);
-            _accum_input_gate2.run();
-        }
-        NEScheduler::get().schedule(&_activation_input_gate, Window::DimY);
-    }
-
-    _fully_connected_cell_state.run();
-    NEScheduler::get().schedule(&_transpose_cell_state, Window::DimY);
-    _gemm_cell_state1.run();
-    NEScheduler::get().schedule(&_accum_cell_state1, Window::DimY);
-    NEScheduler::get().schedule(&_activation_cell_state, Window::DimY);
-    NEScheduler::get().schedule(&_pixelwise_mul_cell_state1, Window::DimY);
-    NEScheduler::get().schedule(&_pixelwise_mul_cell_state2, Window::DimY);
-    NEScheduler::get().schedule(&_accum_cell_state2, Window::DimY);
-
-    if(_perform_cell_clipping)
-    {
-        NEScheduler::get().schedule(&_cell_clip, Window::DimY);
-    }
-
-    _fully_connected_output.run();
-    NEScheduler::get().schedule(&_transpose_output, Window::DimY);
-    _gemm_output.run();
-    NEScheduler::get().schedule(&_accum_output1, Window::DimY);
-
-    if(_run_peephole_opt)
-    {
-        NEScheduler::get().schedule(&_pixelwise_mul_output_state1, Window::DimY);
-        _accum_output2.run();
-    }
-    NEScheduler::get().schedule(&_activation_output, Window::DimY);
+    _memory_group.acquire();
 
-    NEScheduler::get().schedule(&_activation_output_state, Window::DimY);
-    NEScheduler::get().schedule(&_pixelwise_mul_output_state2, Window::DimY);
+    NEScheduler::get().schedule(&_concat_input, Window::DimY);
+    NEScheduler::get().schedule(&_concat_output_state, Window::DimY);
+    _gemm_gates.run();
+    NEScheduler::get().schedule(&_cell_kernel, Window::DimY);
 
     if(_has_projection_weights)
     {
@@ -543,10 +298,51 @@ void NELSTMLayer::run()
         }
     }
 
-    NEScheduler::get().schedule(&_copy_cell_state, Window::DimY);
     NEScheduler::get().schedule(&_copy_output, Window::DimY);
 
-    _concat_scratch_buffer.run();
-
     _memory_group.release();
-}
\ No newline at end of file
+}
+
+void NELSTMLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        // Stack the weights of the gates into a [num_gates * num_units, input_size + output_size] matrix
+        if(!WeightsCache::acquire(_gate_weights))
+        {
+            const size_t element_size = _gate_weights.info()->element_size();
+            const size_t num_units    = _input_weights[0]->info()->dimension(1);
+            const size_t input_size   = _input_weights[0]->info()->dimension(0);
+            const size_t output_size  = _recurrent_weights[0]->info()->dimension(0);
+            for(size_t gate = 0; gate < _input_weights.size(); ++gate)
+            {
+                for(size_t unit = 0; unit < num_units; ++unit)
+                {
+                    const size_t column = gate * num_units + unit;
+                    for(size_t i = 0; i < input_size; ++i)
+                    {
+                        std::memcpy(_gate_weights.ptr_to_element(Coordinates(column, i)), _input_weights[gate]->ptr_to_element(Coordinates(i, unit)), element_size);
+                    }
+                    for(size_t i = 0; i < output_size; ++i)
+                    {
+                        std::memcpy(_gate_weights.ptr_to_element(Coordinates(column, input_size + i)), _recurrent_weights[gate]->ptr_to_element(Coordinates(i, unit)), element_size);
+                    }
+                }
+            }
+        }
+        for(size_t gate = 0; gate < _input_weights.size(); ++gate)
+        {
+            _input_weights[gate]->mark_as_unused();
+            _recurrent_weights[gate]->mark_as_unused();
+        }
+
+        // Reshape the stacked weights and release them if the GEMM doesn't read them anymore
+        _gemm_gates.prepare();
+        if(!_gate_weights.is_used())
+        {
+            _gate_weights.allocator()->free();
+        }
+
+        _is_prepared = true;
+    }
+}
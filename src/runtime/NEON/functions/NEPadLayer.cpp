@@ -27,82 +27,35 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Types.h"
-#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
 
 #include "support/ToolchainSupport.h"
 
 namespace arm_compute
 {
-namespace
-{
-TensorInfo get_expected_output_tensorinfo(const ITensorInfo &input, const PaddingList &paddings)
-{
-    const TensorShape expected_output_shape = arm_compute::misc::shape_calculator::compute_padded_shape(input.tensor_shape(), paddings);
-    const TensorInfo  expected_output_info  = input.clone()->set_tensor_shape(expected_output_shape);
-    return expected_output_info;
-}
-
-Status validate_arguments(const ITensorInfo &input, ITensorInfo &output, const PaddingList &paddings)
-{
-    const TensorInfo expected_output_info = get_expected_output_tensorinfo(input, paddings);
-    auto_init_if_empty(output, expected_output_info);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&output, &expected_output_info);
-
-    return Status{};
-}
-
-Coordinates get_subtensor_coords(const PaddingList &paddings)
-{
-    Coordinates coords;
-    for(unsigned int i = 0; i < paddings.size(); ++i)
-    {
-        coords.set(i, paddings[i].first);
-    }
-
-    return coords;
-}
-} // namespace
-
 NEPadLayer::NEPadLayer()
-    : _memset_kernel(), _copy_kernel(), _output_subtensor()
+    : _pad_kernel()
 {
 }
 
-void NEPadLayer::configure(ITensor *input, ITensor *output, const PaddingList &padding, PixelValue constant_value)
+void NEPadLayer::configure(ITensor *input, ITensor *output, const PaddingList &padding, PixelValue constant_value, PaddingMode mode)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_THROW_ON_ERROR(NEPadLayer::validate(input->info(), output->info(), padding, constant_value));
-
-    // Auto-init
-    auto_init_if_empty(*output->info(), get_expected_output_tensorinfo(*input->info(), padding));
+    ARM_COMPUTE_ERROR_THROW_ON(NEPadLayer::validate(input->info(), output->info(), padding, constant_value, mode));
 
-    // Create SubTensor (Can use sub-tensor as the kernels to be executed do not require padding)
-    _output_subtensor = SubTensor(output, input->info()->tensor_shape(), get_subtensor_coords(padding), true);
-
-    // Set the pages of the output to the specified value
-    _memset_kernel.configure(output, constant_value);
-
-    // Copy the input to the output
-    _copy_kernel.configure(input, &_output_subtensor);
+    _pad_kernel.configure(input, output, padding, constant_value, mode);
 }
 
-Status NEPadLayer::validate(const ITensorInfo *input, const ITensorInfo *output, const PaddingList &padding, PixelValue constant_value)
+Status NEPadLayer::validate(const ITensorInfo *input, const ITensorInfo *output, const PaddingList &padding, PixelValue constant_value, PaddingMode mode)
 {
-    ARM_COMPUTE_UNUSED(constant_value);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
-
-    auto output_clone = output->clone();
-
-    SubTensorInfo output_subtensor_info(output_clone.get(), input->tensor_shape(), get_subtensor_coords(padding), true);
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(*input, *output_clone, padding));
-    ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(input, &output_subtensor_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEPadLayerKernel::validate(input, output, padding, constant_value, mode));
 
     return Status{};
 }
 
 void NEPadLayer::run()
 {
-    NEScheduler::get().schedule(&_memset_kernel, Window::DimY);
-    NEScheduler::get().schedule(&_copy_kernel, Window::DimY);
+    NEScheduler::get().schedule(&_pad_kernel, Window::DimY);
 }
 } // namespace arm_compute
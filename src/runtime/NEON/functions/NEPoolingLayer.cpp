@@ -81,7 +81,7 @@ void NEPoolingLayer::run()
             NEScheduler::get().schedule(&_border_handler, Window::DimY);
 
             // Run pooling layer
-            NEScheduler::get().schedule(&_pooling_layer_kernel, _is_global_pooling_layer ? Window::DimZ : Window::DimY);
+            NEScheduler::get().schedule(&_pooling_layer_kernel, _is_global_pooling_layer ? IScheduler::Hints(Window::DimZ) : IScheduler::Hints(Window::DimY).set_secondary_split_dimension(Window::DimZ));
             break;
         case DataLayout::NHWC:
             // Run pooling layer
@@ -23,14 +23,17 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
 
+#include "arm_compute/core/CPP/Validate.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/NEON/kernels/NEWinogradConvolutionLayerKernel.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include "arm_compute/core/NEON/kernels/convolution/winograd/winograd_gemm.hpp"
@@ -39,10 +42,38 @@ namespace arm_compute
 {
 namespace
 {
-inline Status validate_kernel_3x3(const Size2D input_dims, const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
+// Largest number of input channels for which the 32-bit accumulators of the integer F(2x2, 3x3) can't overflow:
+// the transformed input is bounded by 4 * 255 and the transformed weights by 9 * 255.
+constexpr unsigned int max_quantized_input_channels = 917;
+
+inline Status validate_kernel_3x3(const Size2D output_tile, const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
                                   const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const WinogradInfo &winograd_info, const ActivationLayerInfo &act_info)
 {
-    if(input_dims.width > 4 && input_dims.height > 4)
+    if(input->data_type() == DataType::S16)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output_tile != Size2D(2U, 2U));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<int16_t, 2, 2, 3, 3>::validate(input, input0, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<int16_t, 2, 2, 3, 3>::validate(weights, input1, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<int32_t, 2, 2, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+    }
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    else if(input->data_type() == DataType::F16)
+    {
+        if(output_tile == Size2D(4U, 4U))
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float16_t, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float16_t, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<float16_t, 4, 4, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float16_t, 2, 2, 3, 3>::validate(input, input0, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float16_t, 2, 2, 3, 3>::validate(weights, input1, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<float16_t, 2, 2, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+        }
+    }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    else if(output_tile == Size2D(4U, 4U))
     {
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
@@ -168,21 +199,53 @@ inline Tensor4DShape internal_get_input_shape(const arm_compute::ITensor *input)
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info)
 {
     ARM_COMPUTE_UNUSED(output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd layer only supports unit strides.");
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->data_type());
     if(biases != nullptr)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        if(is_quantized)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        }
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
-    return INEWinogradLayerTransformWeightsKernel<float>::validate(input, weights);
+
+    const DataLayout data_layout = input->data_layout();
+    if(input->data_type() != DataType::F32)
+    {
+        const size_t idx_width  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+        const size_t idx_height = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(idx_width) != 3 || weights->dimension(idx_height) != 3, "Only 3x3 kernels are supported for F16 and QASYMM8");
+    }
+    if(is_quantized)
+    {
+        const size_t idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->dimension(idx_channel) > max_quantized_input_channels, "Too many input channels for the 32-bit accumulators");
+    }
+
+    // The quantized transforms work on 16-bit values
+    const DataType   transform_data_type = is_quantized ? DataType::S16 : input->data_type();
+    const TensorInfo input_transform     = input->clone()->set_data_type(transform_data_type);
+    const TensorInfo weights_transform   = weights->clone()->set_data_type(transform_data_type);
+    return INEWinogradLayerTransformWeightsKernel::validate(&input_transform, &weights_transform);
 }
 
-Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims)
+Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims, DataType data_type, bool enable_fast_math)
 {
     Size2D output_tile = Size2D{};
     if(kernel_dims == Size2D(3U, 3U))
     {
-        output_tile = (input_dims.width <= 4 && input_dims.height <= 4) ? Size2D(2U, 2U) : Size2D(4U, 4U);
+        // The integer transforms only implement F(2x2, 3x3), and F(4x4, 3x3) loses too much precision in half float
+        const bool use_4x4 = (data_type == DataType::F32) || (data_type == DataType::F16 && enable_fast_math);
+        output_tile        = (use_4x4 && input_dims.width > 4 && input_dims.height > 4) ? Size2D(4U, 4U) : Size2D(2U, 2U);
     }
     else if(kernel_dims == Size2D(5U, 5U))
     {
@@ -235,9 +298,10 @@ bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_siz
 } //namespace
 
 NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(memory_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
-      _permute_input(), _permute_weights(), _permute_output(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(), _weights_hwio(), _input(), _weights(), _output(),
-      _is_prepared(false), _is_activationlayer_enabled(false)
+    : _memory_group(memory_manager), _gemm_function(memory_manager), _asm_glue(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr),
+      _activationlayer_function(), _convert_input_kernel(), _convert_weights_kernel(), _output_stage(), _permute_input(), _permute_weights(), _permute_output(), _input_workspace(), _output_workspace(),
+      _kernel_storage(), _input_nhwc(), _output_nhwc(), _weights_hwio(), _input_s16(), _weights_s16(), _output_s32(), _input(), _weights(), _output(), _is_prepared(false),
+      _is_activationlayer_enabled(false), _is_quantized(false)
 {
 } /* arm_compute */
 
@@ -253,9 +317,10 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
     const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
 
-    const Size2D input_dims  = Size2D(input->info()->dimension(width_idx), input->info()->dimension(height_idx));
-    const Size2D kernel_size = Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    const DataType data_type   = input->info()->data_type();
+    const Size2D   input_dims  = Size2D(input->info()->dimension(width_idx), input->info()->dimension(height_idx));
+    const Size2D   kernel_size = Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx));
+    const Size2D   output_tile = winograd_output_tile(input_dims, kernel_size, data_type, enable_fast_math);
 
     // Check if the Winograd configuration requires fast math
     if(!enable_fast_math)
@@ -263,21 +328,51 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
         ARM_COMPUTE_ERROR_ON_MSG(check_support_fast_math(output_tile, kernel_size), "This Winograd configuration requires enable_fast_math=true");
     }
 
-    _weights     = weights;
-    _input       = input;
-    _output      = output;
-    _is_prepared = false;
+    _weights      = weights;
+    _input        = input;
+    _output       = output;
+    _is_prepared  = false;
+    _is_quantized = is_data_type_quantized_asymmetric(data_type);
 
-    std::unique_ptr<INEWinogradLayerTransformInputKernel<float>>   transform_input_kernel;
-    std::unique_ptr<INEWinogradLayerTransformWeightsKernel<float>> transform_weights_kernel;
-    std::unique_ptr<INEWinogradLayerTransformOutputKernel<float>>  transform_output_kernel;
+    std::unique_ptr<INEWinogradLayerTransformInputKernel>   transform_input_kernel;
+    std::unique_ptr<INEWinogradLayerTransformWeightsKernel> transform_weights_kernel;
+    std::unique_ptr<INEWinogradLayerTransformOutputKernel>  transform_output_kernel;
 
     int n_gemms = 0;
     int N_BLOCK = 0; // Size of block used by GEMM.
 
     if(kernel_size == Size2D(3, 3))
     {
-        if(input->info()->dimension(width_idx) > 4 && input->info()->dimension(height_idx) > 4)
+        if(_is_quantized)
+        {
+            using config             = NEWinogradLayerConfiguration<int16_t, int32_t, 2, 2, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        else if(data_type == DataType::F16 && output_tile == Size2D(4U, 4U))
+        {
+            using config             = NEWinogradLayerConfiguration<float16_t, float16_t, 4, 4, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+        else if(data_type == DataType::F16)
+        {
+            using config             = NEWinogradLayerConfiguration<float16_t, float16_t, 2, 2, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        else if(output_tile == Size2D(4U, 4U))
         {
             using config             = NEWinogradLayerConfiguration<float, float, 4, 4, 3, 3>;
             transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
@@ -372,8 +467,11 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const int out_channels = output->info()->dimension(channel_idx);
 
     const Tensor4DShape in_shape(internal_get_input_shape(input));
-    const DataType      data_type      = input->info()->data_type();
-    const size_t        data_type_size = input->info()->element_size();
+    // The quantized path runs the transforms and the GEMM on 16-bit values and accumulates in 32 bits
+    const DataType transform_data_type = _is_quantized ? DataType::S16 : data_type;
+    const DataType gemm_output_type    = _is_quantized ? DataType::S32 : data_type;
+    const size_t   data_type_size      = data_size_from_type(transform_data_type);
+    const size_t   output_type_size    = data_size_from_type(gemm_output_type);
     // Get the memory required to instantiate a new Winograd operator.
     constexpr size_t storage_alignment = 64;
 
@@ -392,7 +490,7 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     // Output storage
     const size_t output_storage_size = transform_output_kernel->get_output_storage_size(in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, out_channels,
                                                                                         use_same_padding)
-                                       * data_type_size
+                                       * output_type_size
                                        + storage_alignment - 1; /* FIXME: remove alignment after COMPMID-1088 */
     ;
     const KernelShape kernel_shape({ out_channels, static_cast<int>(kernel_size.height), static_cast<int>(kernel_size.width), in_channels });
@@ -425,16 +523,16 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     b_strides.set(2, data_type_size * kernel_matrix_stride);
 
     TensorShape d_shape(n, m, 1, n_gemms);
-    Strides     d_strides(data_type_size);
-    d_strides.set(1, data_type_size * output_matrix_row_stride);
-    //d_strides.set(2, data_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
+    Strides     d_strides(output_type_size);
+    d_strides.set(1, output_type_size * output_matrix_row_stride);
+    //d_strides.set(2, output_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
     d_strides.set(2, 0);
-    d_strides.set(3, data_type_size * output_matrix_stride);
+    d_strides.set(3, output_type_size * output_matrix_stride);
 
     TensorInfo a_info, b_info, d_info;
-    a_info.init(a_shape, 1, data_type, a_strides, 0, input_storage_size);
-    b_info.init(b_shape, 1, data_type, b_strides, 0, kernel_storage_size);
-    d_info.init(d_shape, 1, data_type, d_strides, 0, output_storage_size);
+    a_info.init(a_shape, 1, transform_data_type, a_strides, 0, input_storage_size);
+    b_info.init(b_shape, 1, transform_data_type, b_strides, 0, kernel_storage_size);
+    d_info.init(d_shape, 1, gemm_output_type, d_strides, 0, output_storage_size);
 
     _input_workspace.allocator()->init(a_info, storage_alignment);
     _kernel_storage.allocator()->init(b_info, storage_alignment);
@@ -444,8 +542,23 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     TensorInfo info(TensorShape(_output->info()->dimension(2), _output->info()->dimension(0),
                                 _output->info()->dimension(1), _output->info()->dimension(3)),
                     1, _output->info()->data_type());
+    info.set_quantization_info(_output->info()->quantization_info());
     _output_nhwc.allocator()->init(info);
 
+    // Remove the offsets of the quantized input and weights, the integer transforms work on the resulting 16-bit values
+    const ITensor *input_to_use   = _input;
+    const ITensor *weights_to_use = _weights;
+    if(_is_quantized)
+    {
+        _input_s16.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::S16));
+        _weights_s16.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::S16));
+        _memory_group.manage(&_input_s16);
+        _convert_input_kernel.configure(input, &_input_s16, ConvertPolicy::SATURATE);
+        _convert_weights_kernel.configure(weights, &_weights_s16, ConvertPolicy::SATURATE);
+        input_to_use   = &_input_s16;
+        weights_to_use = &_weights_s16;
+    }
+
     // Configure the InputTransform
     _memory_group.manage(&_input_workspace);
     _memory_group.manage(&_output_workspace);
@@ -453,41 +566,71 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     if(data_layout == DataLayout::NCHW)
     {
         // configure the kernel to transform the input tensor from NCHW -> NHWC
-        _permute_input.configure(input, &_input_nhwc, PermutationVector(2U, 0U, 1U));
+        _permute_input.configure(input_to_use, &_input_nhwc, PermutationVector(2U, 0U, 1U));
         _input_nhwc.allocator()->allocate();
         transform_input_kernel->configure(&_input_nhwc, in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, in_shape.n_channels, use_padding_type,
                                           &_input_workspace, input_matrix_stride);
 
         // Re-order a weight tensor from [Output feature map x Input feature map x Height x Width] to [Height x Width x Input feature map x Output feature map]
-        _permute_weights.configure(weights, &_weights_hwio, PermutationVector(3U, 2U, 0U, 1U));
-
-        transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
-
-        //The biases tensor has not been allocated at this point in time, the output transform will add the biases to the final result in the run() method
-        _memory_group.manage(&_output_nhwc);
-        transform_output_kernel->configure(biases, &_output_workspace,
-                                           output_matrix_stride, &_output_nhwc,
-                                           in_shape.n_batches, output_shape.n_rows, output_shape.n_cols, out_channels);
+        _permute_weights.configure(weights_to_use, &_weights_hwio, PermutationVector(3U, 2U, 0U, 1U));
     }
     else
     {
-        transform_input_kernel->configure(_input, in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, in_shape.n_channels, use_padding_type,
+        transform_input_kernel->configure(input_to_use, in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, in_shape.n_channels, use_padding_type,
                                           &_input_workspace, input_matrix_stride);
 
         // Re-order a weight tensor from [Output feature map x Input feature map x Height x Width] to [Height x Width x Input feature map x Output feature map]
-        _permute_weights.configure(weights, &_weights_hwio, PermutationVector(3U, 0U, 1U, 2U));
+        _permute_weights.configure(weights_to_use, &_weights_hwio, PermutationVector(3U, 0U, 1U, 2U));
+    }
+    if(_is_quantized)
+    {
+        _input_s16.allocator()->allocate();
+    }
 
-        transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
+    transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
 
-        transform_output_kernel->configure(biases, &_output_workspace,
-                                           output_matrix_stride, _output,
-                                           in_shape.n_batches, output_shape.n_rows, output_shape.n_cols, out_channels);
+    // The output transform writes either the final result or, in the quantized case, the 32-bit values to requantize
+    ITensor *output_to_use = (data_layout == DataLayout::NCHW) ? &_output_nhwc : _output;
+    if(_is_quantized)
+    {
+        _output_s32.allocator()->init(TensorInfo(output_to_use->info()->tensor_shape(), 1, DataType::S32));
+        _memory_group.manage(&_output_s32);
+    }
+    if(data_layout == DataLayout::NCHW)
+    {
+        _memory_group.manage(&_output_nhwc);
     }
 
-    _gemm_function.configure(&_input_workspace, &_kernel_storage, nullptr, &_output_workspace, 1.0f, 0.f);
+    //The biases tensor has not been allocated at this point in time, the output transform will add the biases to the final result in the run() method
+    transform_output_kernel->configure(_is_quantized ? nullptr : biases, &_output_workspace,
+                                       output_matrix_stride, _is_quantized ? &_output_s32 : output_to_use,
+                                       in_shape.n_batches, output_shape.n_rows, output_shape.n_cols, out_channels);
+
+    if(_is_quantized)
+    {
+        _asm_glue.configure(&_input_workspace, &_kernel_storage, &_output_workspace, 1.0f, 0.f, true);
+    }
+    else
+    {
+        _gemm_function.configure(&_input_workspace, &_kernel_storage, nullptr, &_output_workspace, 1.0f, 0.f);
+    }
     _input_workspace.allocator()->allocate();
     _output_workspace.allocator()->allocate();
 
+    // Requantize the 32-bit result, the biases are added here as the output transform works on the unscaled values
+    if(_is_quantized)
+    {
+        const QuantizationInfo input_quant_info  = input->info()->quantization_info();
+        const QuantizationInfo output_quant_info = (output->info()->total_size() == 0) ? input_quant_info : output->info()->quantization_info();
+
+        const float multiplier = input_quant_info.scale * weights->info()->quantization_info().scale / output_quant_info.scale;
+        int         output_multiplier, output_shift;
+        quantization::calculate_quantized_multiplier_less_than_one(multiplier, &output_multiplier, &output_shift);
+
+        _output_stage.configure(&_output_s32, biases, output_to_use, output_multiplier, output_shift, output_quant_info.offset);
+        _output_s32.allocator()->allocate();
+    }
+
     // Reorder the convoluted output to ACL's ordering NCHW
     if(data_layout == DataLayout::NCHW)
     {
@@ -515,6 +658,11 @@ void NEWinogradConvolutionLayer::run()
 
     _memory_group.acquire();
 
+    if(_is_quantized)
+    {
+        NEScheduler::get().schedule(&_convert_input_kernel, Window::DimY);
+    }
+
     if(data_layout == DataLayout::NCHW)
     {
         //Bring channels to the front as Winograd code expects the tensor to be in the format NHWC
@@ -525,10 +673,22 @@ void NEWinogradConvolutionLayer::run()
     NEScheduler::get().schedule(_transform_input_kernel.get(), Window::DimX);
 
     //Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
-    _gemm_function.run();
+    if(_is_quantized)
+    {
+        _asm_glue.run();
+    }
+    else
+    {
+        _gemm_function.run();
+    }
     // Transform output tensor to the spatial domain
     NEScheduler::get().schedule(_transform_output_kernel.get(), Window::DimX);
 
+    if(_is_quantized)
+    {
+        _output_stage.run();
+    }
+
     if(data_layout == DataLayout::NCHW)
     {
         // Reorder the convoluted output to ACL's ordering NCHW
@@ -556,7 +716,7 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
     // Input shape, kernel size and output tile
     const Size2D input_dims  = Size2D(input->dimension(idx_width), input->dimension(idx_height));
     const Size2D kernel_size = Size2D(weights->dimension(idx_width), weights->dimension(idx_height));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size, input->data_type(), enable_fast_math);
 
     // Check if the Winograd configuration requires fast math
     if(!enable_fast_math)
@@ -570,16 +730,22 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
                                                     conv_info,
                                                     input->data_layout());
 
+    // The quantized path runs the transforms and the GEMM on 16-bit values and accumulates in 32 bits
+    const bool       is_quantized        = is_data_type_quantized_asymmetric(input->data_type());
+    const DataType   transform_data_type = is_quantized ? DataType::S16 : input->data_type();
+    const TensorInfo input_transform     = input->clone()->set_data_type(transform_data_type);
+    const TensorInfo weights_transform   = weights->clone()->set_data_type(transform_data_type);
+
     // Validate input transform
     const TensorShape input0_shape = misc::shape_calculator::compute_winograd_input_transform_shape(*input, winograd_info);
-    const TensorInfo  input0       = input->clone()->set_tensor_shape(input0_shape);
+    const TensorInfo  input0       = input_transform.clone()->set_tensor_shape(input0_shape);
     // Validate filter transform
     const TensorShape input1_shape = misc::shape_calculator::compute_winograd_filter_transform_shape(*weights, winograd_info);
-    const TensorInfo  input1       = weights->clone()->set_tensor_shape(input1_shape);
+    const TensorInfo  input1       = weights_transform.clone()->set_tensor_shape(input1_shape);
     // Validate batched matrix multiply
     TensorShape batched_mm_output_shape = input0.tensor_shape();
     batched_mm_output_shape[0]          = input1.tensor_shape()[0];
-    const TensorInfo batched_mm_output  = input0.clone()->set_tensor_shape(batched_mm_output_shape);
+    const TensorInfo batched_mm_output  = input0.clone()->set_tensor_shape(batched_mm_output_shape).set_data_type(is_quantized ? DataType::S32 : input->data_type());
 
     if(kernel_size == Size2D(3, 3))
     {
@@ -590,7 +756,19 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_right() != conv_info.pad_left(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_bottom(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_left(), "Only SAME or VALID padding supported");
-        return validate_kernel_3x3(input_dims, input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
+        if(is_quantized)
+        {
+            const TensorInfo output_s32 = output->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::S32);
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_kernel_3x3(output_tile, &input_transform, &input0, &input1, &batched_mm_output, &weights_transform, nullptr, &output_s32, winograd_info, ActivationLayerInfo()));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate(&input0, &input1, &batched_mm_output, 1.0f, 0.f, true));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint::validate(&output_s32, biases, output));
+            if(act_info.enabled())
+            {
+                ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+            }
+            return Status{};
+        }
+        return validate_kernel_3x3(output_tile, input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
     }
     else if(kernel_size == Size2D(5, 5))
     {
@@ -656,16 +834,35 @@ void NEWinogradConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        // Permute weights
-        _weights_hwio.allocator()->allocate();
-        _permute_weights.run();
+        if(!WeightsCache::acquire(_kernel_storage))
+        {
+            // Remove the weights offset
+            if(_is_quantized)
+            {
+                _weights_s16.allocator()->allocate();
+                NEScheduler::get().schedule(&_convert_weights_kernel, Window::DimY);
+            }
+
+            // Permute weights
+            _weights_hwio.allocator()->allocate();
+            _permute_weights.run();
+
+            if(_is_quantized)
+            {
+                _weights_s16.allocator()->free();
+            }
+
+            // Transform weights
+            NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
+
+            _weights_hwio.allocator()->free();
+        }
         _weights->mark_as_unused();
 
-        // Transform weights
-        _kernel_storage.allocator()->allocate();
-        NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
-
-        _weights_hwio.allocator()->free();
+        if(_is_quantized)
+        {
+            _asm_glue.prepare();
+        }
         _is_prepared = true;
     }
 }
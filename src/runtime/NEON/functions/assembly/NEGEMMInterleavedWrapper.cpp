@@ -28,6 +28,7 @@
 #include "arm_compute/core/NEON/kernels/assembly/Helpers.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 #include "src/core/NEON/kernels/assembly/NEGEMMInterleavedStrategies.h"
 
@@ -194,8 +195,10 @@ void NEGEMMInterleavedWrapper::prepare()
     {
         if(_pretranspose_b)
         {
-            _transformed_b.allocator()->allocate();
-            NEScheduler::get().schedule(_prepare_b.get(), Window::DimX);
+            if(!WeightsCache::acquire(_transformed_b))
+            {
+                NEScheduler::get().schedule(_prepare_b.get(), Window::DimX);
+            }
             _b->mark_as_unused();
         }
         else
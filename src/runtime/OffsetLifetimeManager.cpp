@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -60,36 +61,78 @@ MappingType OffsetLifetimeManager::mapping_type() const
     return MappingType::OFFSETS;
 }
 
+size_t OffsetLifetimeManager::pool_size() const
+{
+    return _blob.size;
+}
+
+const BlobInfo &OffsetLifetimeManager::info() const
+{
+    return _blob;
+}
+
 void OffsetLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
     ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
 
-    // Update blob size
-    size_t max_aggregated_size = 0;
-    std::for_each(std::begin(_free_blobs), std::end(_free_blobs), [&](const Blob & b)
+    // Place the largest elements first, as they are the hardest to fit in the gaps
+    std::vector<const Element *> elements;
+    elements.reserve(_active_elements.size());
+    for(auto &active_element : _active_elements)
     {
-        max_aggregated_size += b.max_size;
-        _blob.alignment = std::max(_blob.alignment, b.max_alignment);
+        elements.push_back(&active_element.second);
+        _blob.alignment = std::max(_blob.alignment, active_element.second.alignment);
+    }
+    std::stable_sort(std::begin(elements), std::end(elements), [](const Element * a, const Element * b)
+    {
+        return (a->size != b->size) ? a->size > b->size : a->start < b->start;
     });
-    max_aggregated_size += _free_blobs.size() * _blob.alignment;
-    _blob.owners = std::max(_blob.owners, _free_blobs.size());
-    _blob.size   = std::max(_blob.size, max_aggregated_size);
 
     // Calculate group mappings
     auto &group_mappings = _active_group->mappings();
-    size_t offset         = 0;
-    for(auto &free_blob : _free_blobs)
+    std::vector<std::pair<size_t, const Element *>> placed;
+    std::vector<std::pair<size_t, size_t>>          busy;
+    size_t required_size = 0;
+    for(const Element *element : elements)
     {
-        for(auto &bound_element_id : free_blob.bound_elements)
+        // Memory ranges of the placed elements alive at the same time
+        busy.clear();
+        for(const auto &p : placed)
         {
-            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
-            Element &bound_element               = _active_elements[bound_element_id];
-            group_mappings[bound_element.handle] = offset;
+            if(p.second->start < element->end && element->start < p.second->end)
+            {
+                busy.emplace_back(p.first, p.first + p.second->size);
+            }
         }
-        offset += free_blob.max_size;
-        offset = align_offset(offset, _blob.alignment);
-        ARM_COMPUTE_ERROR_ON(offset > _blob.size);
+        std::sort(std::begin(busy), std::end(busy));
+
+        // Best fit: smallest gap large enough, after the last busy range otherwise
+        size_t best_offset = 0;
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t gap_start   = 0;
+        for(const auto &range : busy)
+        {
+            const size_t offset = align_offset(gap_start, element->alignment);
+            if(range.first >= offset + element->size && range.first - offset < best_gap)
+            {
+                best_offset = offset;
+                best_gap    = range.first - offset;
+            }
+            gap_start = std::max(gap_start, range.second);
+        }
+        if(best_gap == std::numeric_limits<size_t>::max())
+        {
+            best_offset = align_offset(gap_start, element->alignment);
+        }
+
+        group_mappings[element->handle] = best_offset;
+        placed.emplace_back(best_offset, element);
+        required_size = std::max(required_size, best_offset + element->size);
     }
+
+    // Update blob size
+    _blob.owners = std::max(_blob.owners, _free_blobs.size());
+    _blob.size   = std::max(_blob.size, required_size);
 }
 } // namespace arm_compute
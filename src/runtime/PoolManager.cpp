@@ -27,65 +27,143 @@
 #include "arm_compute/runtime/IMemoryPool.h"
 #include "support/ToolchainSupport.h"
 
-#include <list>
+#include <algorithm>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Pool a thread locked last, and the manager owning it */
+struct PreferredPool
+{
+    uint64_t manager_id; /**< Identifier of the manager, 0 if the thread never locked a pool */
+    size_t   idx;        /**< Index of the pool in the manager */
+};
+
+#ifndef NO_MULTI_THREADING
+thread_local
+#endif /* NO_MULTI_THREADING */
+PreferredPool preferred = { 0, 0 };
+
+// Identifiers are never reused, so a manager created at the address of a destroyed one doesn't inherit its hints
+std::atomic<uint64_t> next_manager_id(1);
+} // namespace
+
 PoolManager::PoolManager()
-    : _free_pools(), _occupied_pools(), _sem(), _mtx()
+#ifndef NO_MULTI_THREADING
+    : _pools(), _occupied(), _num_waiters(0), _mtx(), _id(next_manager_id++), _cv()
+#else  /* NO_MULTI_THREADING */
+    : _pools(), _occupied(), _num_waiters(0), _mtx(), _id(next_manager_id++)
+#endif /* NO_MULTI_THREADING */
+{
+}
+
+size_t PoolManager::preferred_pool() const
+{
+    return (preferred.manager_id == _id) ? preferred.idx : 0;
+}
+
+void PoolManager::set_preferred_pool(size_t idx) const
 {
+    preferred.manager_id = _id;
+    preferred.idx        = idx;
+}
+
+IMemoryPool *PoolManager::try_lock_pool()
+{
+    const size_t num_pools = _pools.size();
+    const size_t first     = preferred_pool() % num_pools;
+    for(size_t i = 0; i < num_pools; ++i)
+    {
+        const size_t idx = (first + i) % num_pools;
+
+        // Only attempt the exchange on pools which look free, to not steal the cache line of the busy ones
+        bool expected = false;
+        if(!_occupied[idx].load() && _occupied[idx].compare_exchange_strong(expected, true))
+        {
+            if(idx != first)
+            {
+                set_preferred_pool(idx);
+            }
+            return _pools[idx].get();
+        }
+    }
+    return nullptr;
 }
 
 IMemoryPool *PoolManager::lock_pool()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pools.empty(), "Haven't setup any pools!");
 
-    _sem->wait();
-    std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
-    _occupied_pools.splice(std::begin(_occupied_pools), _free_pools, std::begin(_free_pools));
-    return _occupied_pools.front().get();
+    IMemoryPool *pool = try_lock_pool();
+#ifndef NO_MULTI_THREADING
+    if(pool == nullptr)
+    {
+        // All the pools are in use: registering as a waiter before trying again guarantees that unlock_pool() wakes this thread up
+        std::unique_lock<arm_compute::Mutex> lock(_mtx);
+        ++_num_waiters;
+        _cv.wait(lock, [&]()
+        {
+            pool = try_lock_pool();
+            return pool != nullptr;
+        });
+        --_num_waiters;
+    }
+#endif /* NO_MULTI_THREADING */
+    ARM_COMPUTE_ERROR_ON_MSG(pool == nullptr, "All the pools are in use!");
+    return pool;
 }
 
 void PoolManager::unlock_pool(IMemoryPool *pool)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pools.empty(), "Haven't setup any pools!");
 
-    std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    auto it = std::find_if(std::begin(_occupied_pools), std::end(_occupied_pools), [pool](const std::unique_ptr<IMemoryPool> &pool_it)
+    auto it = std::find_if(std::begin(_pools), std::end(_pools), [pool](const std::unique_ptr<IMemoryPool> &pool_it)
     {
         return pool_it.get() == pool;
     });
-    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
-    _free_pools.splice(std::begin(_free_pools), _occupied_pools, it);
-    _sem->signal();
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_pools), "Pool to be unlocked couldn't be found!");
+
+    const size_t idx = std::distance(std::begin(_pools), it);
+    ARM_COMPUTE_ERROR_ON_MSG(!_occupied[idx].load(), "Pool to be unlocked isn't locked!");
+    _occupied[idx].store(false);
+
+#ifndef NO_MULTI_THREADING
+    if(_num_waiters.load() > 0)
+    {
+        // Going through the mutex makes sure the waiters either see the free pool or are already sleeping
+        {
+            std::lock_guard<arm_compute::Mutex> lock(_mtx);
+        }
+        _cv.notify_one();
+    }
+#endif /* NO_MULTI_THREADING */
 }
 
 void PoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to register a new one!");
+    ARM_COMPUTE_ERROR_ON_MSG(any_occupied(), "All pools should be free in order to register a new one!");
 
     // Set pool
-    _free_pools.push_front(std::move(pool));
+    _pools.push_back(std::move(pool));
 
-    // Update semaphore
-    _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_free_pools.size());
+    // Update occupancy flags
+    reset_occupancy();
 }
 
 std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to release one!");
+    ARM_COMPUTE_ERROR_ON_MSG(any_occupied(), "All pools should be free in order to release one!");
 
-    if(!_free_pools.empty())
+    if(!_pools.empty())
     {
-        std::unique_ptr<IMemoryPool> pool = std::move(_free_pools.front());
-        ARM_COMPUTE_ERROR_ON(_free_pools.front() != nullptr);
-        _free_pools.pop_front();
+        std::unique_ptr<IMemoryPool> pool = std::move(_pools.back());
+        _pools.pop_back();
 
-        // Update semaphore
-        _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_free_pools.size());
+        // Update occupancy flags
+        reset_occupancy();
 
         return pool;
     }
@@ -96,16 +174,37 @@ std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 void PoolManager::clear_pools()
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to clear the PoolManager!");
-    _free_pools.clear();
+    ARM_COMPUTE_ERROR_ON_MSG(any_occupied(), "All pools should be free in order to clear the PoolManager!");
+    _pools.clear();
 
-    // Update semaphore
-    _sem = nullptr;
+    // Update occupancy flags
+    reset_occupancy();
 }
 
 size_t PoolManager::num_pools() const
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
 
-    return _free_pools.size() + _occupied_pools.size();
-}
\ No newline at end of file
+    return _pools.size();
+}
+
+void PoolManager::reset_occupancy()
+{
+    _occupied.reset(_pools.empty() ? nullptr : new std::atomic<bool>[_pools.size()]);
+    for(size_t i = 0; i < _pools.size(); ++i)
+    {
+        _occupied[i].store(false);
+    }
+}
+
+bool PoolManager::any_occupied() const
+{
+    for(size_t i = 0; i < _pools.size(); ++i)
+    {
+        if(_occupied[i].load())
+        {
+            return true;
+        }
+    }
+    return false;
+}
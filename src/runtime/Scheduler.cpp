@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #if ARM_COMPUTE_CPP_SCHEDULER
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
 
 #include "arm_compute/runtime/SingleThreadScheduler.h"
@@ -36,6 +37,14 @@
 
 using namespace arm_compute;
 
+namespace
+{
+#ifndef NO_MULTI_THREADING
+thread_local
+#endif /* NO_MULTI_THREADING */
+IScheduler *thread_scheduler = nullptr;
+} // namespace
+
 #if !ARM_COMPUTE_CPP_SCHEDULER && ARM_COMPUTE_OPENMP_SCHEDULER
 Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::OMP;
 #elif ARM_COMPUTE_CPP_SCHEDULER && !ARM_COMPUTE_OPENMP_SCHEDULER
@@ -61,6 +70,7 @@ bool Scheduler::is_available(Type t)
             return true;
         }
         case Type::CPP:
+        case Type::CPP_WORK_STEALING:
         {
 #if ARM_COMPUTE_CPP_SCHEDULER
             return true;
@@ -95,6 +105,11 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    if(thread_scheduler != nullptr)
+    {
+        return *thread_scheduler;
+    }
+
     switch(_scheduler_type)
     {
         case Type::ST:
@@ -107,6 +122,15 @@ IScheduler &Scheduler::get()
             return CPPScheduler::get();
 #else  /* ARM_COMPUTE_CPP_SCHEDULER */
             ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 scheduler.");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+            break;
+        }
+        case Type::CPP_WORK_STEALING:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return CPPWorkStealingScheduler::get();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 work stealing scheduler.");
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
             break;
         }
@@ -147,3 +171,8 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+    thread_scheduler = scheduler;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SchedulerUtils.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+namespace arm_compute
+{
+namespace scheduler_utils
+{
+namespace
+{
+// Window::split_window() gives the leftover iterations to the last sub-window, which is therefore the largest one
+unsigned int largest_tile(unsigned int num_iterations, unsigned int num_tiles)
+{
+    return num_iterations - (num_tiles - 1) * (num_iterations / num_tiles);
+}
+} // namespace
+
+unsigned int num_iterations(const Window &window, const IScheduler::Hints &hints)
+{
+    unsigned int num_iterations = window.num_iterations(hints.split_dimension());
+    if(hints.is_2d_split())
+    {
+        num_iterations *= window.num_iterations(hints.secondary_split_dimension());
+    }
+    return num_iterations;
+}
+
+std::pair<unsigned int, unsigned int> split_grid(const Window &window, const IScheduler::Hints &hints, unsigned int max_tiles, unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON(max_tiles == 0 || num_threads == 0);
+
+    if(!hints.is_2d_split())
+    {
+        return std::make_pair(max_tiles, 1U);
+    }
+
+    const unsigned int iterations0 = window.num_iterations(hints.split_dimension());
+    const unsigned int iterations1 = window.num_iterations(hints.secondary_split_dimension());
+
+    std::pair<unsigned int, unsigned int> grid(1U, 1U);
+    unsigned int                          best_cost = iterations0 * iterations1;
+
+    for(unsigned int tiles0 = 1; tiles0 <= std::min(iterations0, max_tiles); ++tiles0)
+    {
+        const unsigned int max_tiles1 = std::min(iterations1, max_tiles / tiles0);
+        for(unsigned int tiles1 = 1; tiles1 <= max_tiles1; ++tiles1)
+        {
+            // Each thread processes its share of tiles one after the other, so the slowest thread bounds the run time
+            const unsigned int num_tiles     = tiles0 * tiles1;
+            const unsigned int tiles_per_thr = DIV_CEIL(num_tiles, num_threads);
+            const unsigned int cost          = tiles_per_thr * largest_tile(iterations0, tiles0) * largest_tile(iterations1, tiles1);
+
+            // On equal cost, prefer more tiles as they give dynamic strategies more room to balance the load
+            if(cost < best_cost || (cost == best_cost && num_tiles > grid.first * grid.second))
+            {
+                best_cost = cost;
+                grid      = std::make_pair(tiles0, tiles1);
+            }
+        }
+    }
+
+    return grid;
+}
+
+Window split_window(const Window &window, const IScheduler::Hints &hints, unsigned int id, const std::pair<unsigned int, unsigned int> &grid)
+{
+    ARM_COMPUTE_ERROR_ON(id >= grid.first * grid.second);
+
+    Window win = window.split_window(hints.split_dimension(), id % grid.first, grid.first);
+    if(grid.second > 1)
+    {
+        win = win.split_window(hints.secondary_split_dimension(), id / grid.first, grid.second);
+    }
+    return win;
+}
+
+Window split_window_weighted(const Window &window, const IScheduler::Hints &hints, unsigned int id, const std::vector<unsigned int> &weights)
+{
+    const size_t             dimension      = hints.split_dimension();
+    const uint64_t           num_chunks     = weights.size();
+    const uint64_t           num_iterations = window.num_iterations(dimension);
+    const uint64_t           total_weight   = std::accumulate(weights.begin(), weights.end(), uint64_t(0));
+    const Window::Dimension &dim            = window[dimension];
+
+    ARM_COMPUTE_ERROR_ON(id >= num_chunks);
+    ARM_COMPUTE_ERROR_ON(num_chunks > num_iterations);
+    ARM_COMPUTE_ERROR_ON(total_weight == 0);
+
+    // Every chunk gets one iteration, the remaining ones are shared in proportion to the weights
+    const uint64_t weight_before = std::accumulate(weights.begin(), weights.begin() + id, uint64_t(0));
+    const uint64_t weight_after  = weight_before + weights[id];
+    const uint64_t first         = id + (num_iterations - num_chunks) * weight_before / total_weight;
+    const uint64_t last          = id + 1 + (num_iterations - num_chunks) * weight_after / total_weight;
+
+    const int start = dim.start() + static_cast<int>(first) * dim.step();
+    const int end   = (id == num_chunks - 1) ? dim.end() : dim.start() + static_cast<int>(last) * dim.step();
+
+    Window win(window);
+    win.set(dimension, Window::Dimension(start, end, dim.step()));
+    return win;
+}
+} // namespace scheduler_utils
+} // namespace arm_compute
@@ -161,6 +161,19 @@ arm_compute::Status TensorAllocator::import_memory(void *memory, size_t size)
     return Status{};
 }
 
+arm_compute::Status TensorAllocator::import_memory(Memory memory)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(memory.region() == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(memory.region()->buffer() == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(memory.region()->size() < info().total_size());
+    ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
+
+    _memory = std::move(memory);
+    info().set_is_resizable(false);
+
+    return Status{};
+}
+
 void TensorAllocator::set_associated_memory_group(MemoryGroup *associated_memory_group)
 {
     ARM_COMPUTE_ERROR_ON(associated_memory_group == nullptr);
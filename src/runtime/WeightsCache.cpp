@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Memory.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <exception>
+
+namespace arm_compute
+{
+namespace
+{
+#ifndef NO_MULTI_THREADING
+thread_local
+#endif /* NO_MULTI_THREADING */
+WeightsCache::Scope *active_scope = nullptr;
+} // namespace
+
+WeightsCache::Scope::Scope(WeightsCache *cache, std::string key)
+    : _cache(cache), _key(std::move(key)), _next_index(0), _acquired(), _previous(active_scope)
+{
+    active_scope = this;
+}
+
+WeightsCache::Scope::~Scope()
+{
+    if(_cache != nullptr)
+    {
+        _cache->publish(*this);
+    }
+    active_scope = _previous;
+}
+
+WeightsCache::WeightsCache()
+    : _mtx(), _cv(), _entries()
+{
+}
+
+bool WeightsCache::acquire(Tensor &tensor)
+{
+    Scope *scope = active_scope;
+    if(scope == nullptr || scope->_cache == nullptr)
+    {
+        tensor.allocator()->allocate();
+        return false;
+    }
+
+    WeightsCache &cache = *scope->_cache;
+    const size_t  size  = tensor.info()->total_size();
+    const Key     key   = make_key(scope->_key, scope->_next_index++, *tensor.info());
+
+    std::unique_lock<std::mutex> lock(cache._mtx);
+
+    // Wait for the instance writing the weights to be done
+    auto it = cache._entries.find(key);
+    while(it != std::end(cache._entries) && !it->second.ready)
+    {
+        cache._cv.wait(lock);
+        it = cache._entries.find(key);
+    }
+
+    const bool is_ready = (it != std::end(cache._entries));
+    if(!is_ready)
+    {
+        it                = cache._entries.emplace(key, Entry()).first;
+        it->second.region = std::make_shared<MemoryRegion>(size, tensor.allocator()->alignment());
+        scope->_acquired.emplace_back(std::get<1>(key), &tensor);
+    }
+    ARM_COMPUTE_EXIT_ON_MSG(it->second.region->size() < size, "The instances sharing the cache don't acquire the same weights!");
+    Memory memory(it->second.region);
+    lock.unlock();
+
+    // The scope drops the entry while unwinding, so the other instances don't wait for weights which will never be written
+    ARM_COMPUTE_THROW_ON_ERROR(tensor.allocator()->import_memory(std::move(memory)));
+
+    return is_ready;
+}
+
+void WeightsCache::release(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Weights still being written belong to the instance writing them
+    auto it = _entries.lower_bound(Key(key, 0, std::vector<size_t>(), DataType::UNKNOWN));
+    while(it != std::end(_entries) && std::get<0>(it->first) == key)
+    {
+        it = it->second.ready ? _entries.erase(it) : std::next(it);
+    }
+}
+
+size_t WeightsCache::size() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    size_t size = 0;
+    for(const auto &entry : _entries)
+    {
+        size += entry.second.region->size();
+    }
+    return size;
+}
+
+WeightsCache::Key WeightsCache::make_key(const std::string &scope_key, unsigned int index, const ITensorInfo &info)
+{
+    const TensorShape &shape = info.tensor_shape();
+    return Key(scope_key, index, std::vector<size_t>(shape.cbegin(), shape.cbegin() + shape.num_dimensions()), info.data_type());
+}
+
+void WeightsCache::publish(Scope &scope)
+{
+    // Weights which might not have been fully written can't be shared
+    const bool is_unwinding = std::uncaught_exception();
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        for(const auto &acquired : scope._acquired)
+        {
+            auto it = _entries.find(make_key(scope._key, acquired.first, *acquired.second->info()));
+            if(it == std::end(_entries))
+            {
+                continue;
+            }
+
+            // Weights consumed while preparing other weights are freed like they would be without the cache
+            if(is_unwinding || !acquired.second->is_used())
+            {
+                _entries.erase(it);
+            }
+            else
+            {
+                it->second.ready = true;
+            }
+        }
+    }
+    _cv.notify_all();
+}
+} // namespace arm_compute
@@ -52,6 +52,19 @@ public:
     }
 };
 
+class SmallWinogradConvolutionLayer3x3QuantizedDataset final : public ConvolutionLayerDataset
+{
+public:
+    SmallWinogradConvolutionLayer3x3QuantizedDataset()
+    {
+        add_config(TensorShape(8U, 8U, 2U), TensorShape(3U, 3U, 2U, 1U), TensorShape(1U), TensorShape(8U, 8U, 1U), PadStrideInfo(1, 1, 1, 1));
+        // Odd output size, the last tiles are partial
+        add_config(TensorShape(23U, 27U, 5U, 4U), TensorShape(3U, 3U, 5U, 21U), TensorShape(21U), TensorShape(21U, 25U, 21U, 4U), PadStrideInfo(1, 1, 0, 0));
+        // Largest number of input channels the 32-bit accumulators support
+        add_config(TensorShape(6U, 6U, 917U), TensorShape(3U, 3U, 917U, 4U), TensorShape(4U), TensorShape(4U, 4U, 4U), PadStrideInfo(1, 1, 0, 0));
+    }
+};
+
 class SmallWinogradConvolutionLayer3x1Dataset final : public ConvolutionLayerDataset
 {
 public:
@@ -184,6 +197,27 @@ public:
     }
 };
 
+class SmallBinaryConvolutionLayerKernelSizeDataset final : public ConvolutionLayerDataset
+{
+public:
+    SmallBinaryConvolutionLayerKernelSizeDataset()
+    {
+        // Kernel 1x1
+        add_config(TensorShape(23U, 27U, 5U), TensorShape(1U, 1U, 5U, 16U), TensorShape(16U), TensorShape(23U, 27U, 16U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(23U, 27U, 5U), TensorShape(1U, 1U, 5U, 16U), TensorShape(16U), TensorShape(12U, 14U, 16U), PadStrideInfo(2, 2, 0, 0));
+        // Kernel 3x3 strided
+        add_config(TensorShape(33U, 27U, 7U), TensorShape(3U, 3U, 7U, 16U), TensorShape(16U), TensorShape(17U, 14U, 16U), PadStrideInfo(2, 2, 1, 1));
+        add_config(TensorShape(33U, 27U, 7U, 2U), TensorShape(3U, 3U, 7U, 16U), TensorShape(16U), TensorShape(11U, 9U, 16U, 2U), PadStrideInfo(3, 3, 0, 0));
+        // Kernel 5x5
+        add_config(TensorShape(17U, 13U, 8U, 2U), TensorShape(5U, 5U, 8U, 12U), TensorShape(12U), TensorShape(17U, 13U, 12U, 2U), PadStrideInfo(1, 1, 2, 2));
+        add_config(TensorShape(24U, 21U, 4U), TensorShape(5U, 5U, 4U, 8U), TensorShape(8U), TensorShape(11U, 10U, 8U), PadStrideInfo(2, 2, 1, 1));
+        // Non-square kernels and strides
+        add_config(TensorShape(19U, 23U, 6U), TensorShape(3U, 5U, 6U, 9U), TensorShape(9U), TensorShape(17U, 10U, 9U), PadStrideInfo(1, 2, 0, 0));
+        // Kernel wider than one packed byte
+        add_config(TensorShape(51U, 51U, 3U), TensorShape(11U, 11U, 3U, 8U), TensorShape(8U), TensorShape(11U, 11U, 8U), PadStrideInfo(4, 4, 0, 0));
+    }
+};
+
 // TODO (COMPMID-1749)
 class SmallConvolutionLayerReducedDataset final : public ConvolutionLayerDataset
 {
@@ -93,9 +93,10 @@ TEST_SUITE(Float)
 
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunPadding, CLPaddingFixture<float>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::F32 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(CLAccessor(_target), _reference);
@@ -104,9 +105,10 @@ TEST_SUITE_END() // FP32
 
 TEST_SUITE(FP16)
 FIXTURE_DATA_TEST_CASE(RunPadding, CLPaddingFixture<half>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::F16 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(CLAccessor(_target), _reference);
@@ -117,9 +119,10 @@ TEST_SUITE_END() // Float
 TEST_SUITE(Integer)
 TEST_SUITE(S8)
 FIXTURE_DATA_TEST_CASE(RunPadding, CLPaddingFixture<int8_t>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::S8 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(CLAccessor(_target), _reference);
@@ -130,9 +133,10 @@ TEST_SUITE_END() // Integer
 TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
 FIXTURE_DATA_TEST_CASE(RunPadding, CLPaddingFixture<uint8_t>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::QASYMM8 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(CLAccessor(_target), _reference);
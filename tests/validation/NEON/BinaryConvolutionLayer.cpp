@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEBinaryWeights.h"
 #include "arm_compute/runtime/NEON/functions/NEBinaryConvolutionLayer.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/PaddingCalculator.h"
@@ -41,19 +42,60 @@ namespace validation
 namespace
 {
 constexpr RelativeTolerance<float> tolerance_f32(0.01f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr float                    tolerance_num_chained = 0.02f; /**< Tolerance number for chained layers, as outputs close to 0 may be binarized differently */
+
+/** Activation functions which can be fused in the output stage */
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.5f, -0.5f)
+});
 } // namespace
 
 using NEBinaryConvolutionLayerFixture = BinaryConvolutionLayerValidationFixture<Tensor, Accessor, NEBinaryConvolutionLayer>;
+using NEBinaryConvolutionLayerPrepackedFixture = BinaryConvolutionLayerPrepackedValidationFixture<Tensor, Accessor, NEBinaryConvolutionLayer, NEBinaryWeights>;
+using NEBinaryConvolutionLayerFusedFixture     = BinaryConvolutionLayerFusedValidationFixture<Tensor, Accessor, NEBinaryConvolutionLayer>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(BinaryConvolutionLayer)
 
 FIXTURE_DATA_TEST_CASE(RunSmall, NEBinaryConvolutionLayerFixture, framework::DatasetMode::ALL, combine(datasets::SmallBinaryConvolutionLayerDataset(),
-                               framework::dataset::make("DataLayout", /*{*/ DataLayout::NCHW/*, DataLayout::NHWC }*/)))
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
 {
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+FIXTURE_DATA_TEST_CASE(RunKernelSizes, NEBinaryConvolutionLayerFixture, framework::DatasetMode::ALL, combine(datasets::SmallBinaryConvolutionLayerKernelSizeDataset(),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunPrepackedWeights, NEBinaryConvolutionLayerPrepackedFixture, framework::DatasetMode::ALL, combine(datasets::SmallBinaryConvolutionLayerDataset(),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunFusedOutputStage, NEBinaryConvolutionLayerFusedFixture, framework::DatasetMode::ALL,
+                       combine(combine(combine(datasets::SmallBinaryConvolutionLayerKernelSizeDataset(),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("Chained", false)))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunChained, NEBinaryConvolutionLayerFusedFixture, framework::DatasetMode::ALL,
+                       combine(combine(combine(datasets::SmallBinaryConvolutionLayerKernelSizeDataset(),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                               framework::dataset::make("Chained", true)))
+{
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num_chained);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace validation
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONCLCTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEBinaryFullyConnectedLayer.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/BinaryFullyConnectedLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr RelativeTolerance<float> tolerance_f32(0.01f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+/** Input, weights, biases and output shapes: sizes not multiple of the 128-bit words and of the 4x4 blocks, single and multiple batches */
+const auto SmallBinaryFullyConnectedLayerDataset = zip(zip(zip(framework::dataset::make("InputShape", { TensorShape(128U), TensorShape(37U, 3U), TensorShape(201U, 6U), TensorShape(1100U, 17U) }),
+                                                        framework::dataset::make("WeightsShape", { TensorShape(128U, 16U), TensorShape(37U, 5U), TensorShape(201U, 10U), TensorShape(1100U, 7U) })),
+                                                    framework::dataset::make("BiasShape", { TensorShape(16U), TensorShape(5U), TensorShape(10U), TensorShape(7U) })),
+                                                framework::dataset::make("OutputShape", { TensorShape(16U), TensorShape(5U, 3U), TensorShape(10U, 6U), TensorShape(7U, 17U) }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(BinaryFullyConnectedLayer)
+
+using NEBinaryFullyConnectedLayerFixture = BinaryFullyConnectedLayerValidationFixture<Tensor, Accessor, NEBinaryFullyConnectedLayer>;
+
+FIXTURE_DATA_TEST_CASE(RunSmall, NEBinaryFullyConnectedLayerFixture, framework::DatasetMode::ALL, SmallBinaryFullyConnectedLayerDataset)
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
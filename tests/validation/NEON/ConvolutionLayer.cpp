@@ -74,6 +74,12 @@ const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f)
 });
+const auto QuantizedActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)
+});
 } // namespace
 
 TEST_SUITE(NEON)
@@ -321,6 +327,98 @@ FIXTURE_DATA_TEST_CASE(RunSmallNoBias, NEWinogradConvolutionLayerNoBiasFixture<f
 }
 
 TEST_SUITE_END() // FP32
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+using NEWinogradConvolutionLayerFixture16 = WinogradConvolutionLayerFastMathValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, half, float>;
+// Without fast math F16 uses the F(2x2, 3x3) transforms
+using NEWinogradConvolutionLayer2x2Fixture16 = WinogradConvolutionLayerValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, half>;
+
+TEST_SUITE(FP16)
+TEST_SUITE(Conv3x3)
+FIXTURE_DATA_TEST_CASE(RunSmall2x2, NEWinogradConvolutionLayer2x2Fixture16, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                       framework::dataset::make("DataType", { DataType::F16 })),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge2x2, NEWinogradConvolutionLayer2x2Fixture16, framework::DatasetMode::NIGHTLY,
+                       combine(combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
+                                       framework::dataset::make("DataType", { DataType::F16 })),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerFixture16, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerFixture16, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+TEST_SUITE_END() // Conv3x3
+TEST_SUITE_END() // FP16
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+#ifdef __aarch64__
+template <typename T>
+using NEWinogradConvolutionLayerQuantizedFixture = WinogradConvolutionLayerQuantizedValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, T>;
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+TEST_SUITE(Conv3x3)
+TEST_CASE(MaxInputChannels, framework::DatasetMode::ALL)
+{
+    // The 32-bit accumulators of the integer F(2x2, 3x3) can overflow beyond 917 input channels
+    const QuantizationInfo quant_info(2.f / 255.f, 10);
+    for(unsigned int channels : { 917U, 918U })
+    {
+        const TensorInfo input(TensorShape(6U, 6U, channels), 1, DataType::QASYMM8, quant_info);
+        const TensorInfo weights(TensorShape(3U, 3U, channels, 4U), 1, DataType::QASYMM8, quant_info);
+        const TensorInfo biases(TensorShape(4U), 1, DataType::S32);
+        const TensorInfo output(TensorShape(4U, 4U, 4U), 1, DataType::QASYMM8, quant_info);
+
+        const bool is_valid = bool(NEWinogradConvolutionLayer::validate(&input, &weights, &biases, &output, PadStrideInfo(1, 1, 0, 0)));
+        ARM_COMPUTE_EXPECT(is_valid == (channels <= 917U), framework::LogLevel::ERRORS);
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3QuantizedDataset(),
+                                                       framework::dataset::make("DataType", { DataType::QASYMM8 })),
+                                               QuantizedActivationFunctionsDataset),
+                                       framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                               framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10), QuantizationInfo(1.f / 128.f, 128) })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
+                                                       framework::dataset::make("DataType", { DataType::QASYMM8 })),
+                                               QuantizedActivationFunctionsDataset),
+                                       framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                               framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10) })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // Conv3x3
+TEST_SUITE_END() // QASYMM8
+TEST_SUITE_END() // Quantized
+#endif /* __aarch64__ */
 TEST_SUITE_END() // WinogradLayer
 
 TEST_SUITE(GEMMConvolutionLayer)
@@ -422,12 +520,6 @@ TEST_SUITE_END() // Float
 template <typename T>
 using NEGEMMConvolutionLayerQuantizedFixture = ConvolutionValidationQuantizedFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T>;
 
-const auto QuantizedActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
-{
-    ActivationLayerInfo(),
-    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
-    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)
-});
 TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
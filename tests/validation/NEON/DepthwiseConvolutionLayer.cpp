@@ -53,6 +53,7 @@ constexpr float                     tolerance_num = 0.05f;                 /**<
 #endif                                                                     // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 
 const auto depth_multipliers = framework::dataset::make("DepthMultiplier", { 1, 2, 3 });
+const auto dilations         = framework::dataset::make("Dilation", { Size2D(2U, 2U), Size2D(2U, 3U) });
 } // namespace
 
 TEST_SUITE(NEON)
@@ -213,6 +214,18 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEDepthwiseConvolutionLayerFixture<float>, fram
 {
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+template <typename T>
+using NEDepthwiseConvolutionLayerDilatedFixture = DepthwiseConvolutionLayerValidationDilatedFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer, T>;
+FIXTURE_DATA_TEST_CASE(RunSmallDilated, NEDepthwiseConvolutionLayerDilatedFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(datasets::SmallDepthwiseConvolutionLayerDataset(),
+                                                               dilations),
+                                                       depth_multipliers),
+                                               framework::dataset::make("DataType", DataType::F32)),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo() })),
+                               framework::dataset::make("DataLayout", { DataLayout::NHWC })))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 TEST_SUITE_END() // Generic
 
 TEST_SUITE(W3x3)
@@ -276,6 +289,18 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEDepthwiseConvolutionLayerFixture<half>, frame
 {
     validate(Accessor(_target), _reference, tolerance_f16, tolerance_num);
 }
+template <typename T>
+using NEDepthwiseConvolutionLayerDilatedFixture = DepthwiseConvolutionLayerValidationDilatedFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer, T>;
+FIXTURE_DATA_TEST_CASE(RunSmallDilated, NEDepthwiseConvolutionLayerDilatedFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(datasets::SmallDepthwiseConvolutionLayerDataset(),
+                                                               dilations),
+                                                       depth_multipliers),
+                                               framework::dataset::make("DataType", DataType::F16)),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo() })),
+                               framework::dataset::make("DataLayout", { DataLayout::NHWC })))
+{
+    validate(Accessor(_target), _reference, tolerance_f16, tolerance_num);
+}
 TEST_SUITE_END() // Generic
 TEST_SUITE(W3x3)
 template <typename T>
@@ -324,6 +349,8 @@ template <typename T>
 using NEDepthwiseConvolutionLayerQuantizedFixture3x3 = DepthwiseConvolutionLayerValidationQuantizedFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer3x3, T>;
 template <typename T>
 using NEDepthwiseConvolutionLayerQuantizedFixture = DepthwiseConvolutionLayerValidationQuantizedFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer, T>;
+template <typename T>
+using NEDepthwiseConvolutionLayerQuantizedDilatedFixture = DepthwiseConvolutionLayerValidationDilatedFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer, T>;
 
 TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
@@ -337,6 +364,16 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDepthwiseConvolutionLayerQuantizedFixture<uin
 {
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallDilated, NEDepthwiseConvolutionLayerQuantizedDilatedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(datasets::SmallDepthwiseConvolutionLayerDataset(),
+                                                               dilations),
+                                                       depth_multipliers),
+                                               framework::dataset::make("DataType", DataType::QASYMM8)),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(0.5f, 10) })),
+                               framework::dataset::make("DataLayout", { DataLayout::NHWC })))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 TEST_SUITE_END() // Generic
 TEST_SUITE(W3x3)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEDepthwiseConvolutionLayerQuantizedFixture3x3<uint8_t>, framework::DatasetMode::PRECOMMIT,
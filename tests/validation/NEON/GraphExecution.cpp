@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/GraphHelpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr unsigned int num_frames  = 4; /**< Number of inputs streamed through the graphs */
+constexpr int          num_threads = 4; /**< Number of threads the executors share between their lanes or stages */
+
+/** Runs a graph with an execution strategy and with the sequential one, and checks that the outputs match
+ *
+ * @param[in] build    Function adding the nodes of the graph. It returns the node whose output is read.
+ * @param[in] strategy Execution strategy to validate.
+ * @param[in] stages   (Optional) Maximum number of compute stages of a pipelined execution.
+ */
+void validate_strategy(const std::function<graph::NodeID(graph::Graph &)> &build, graph::ExecutionStrategy strategy, unsigned int stages = 2)
+{
+    const unsigned int old_num_threads = Scheduler::get().num_threads();
+
+    graph::GraphConfig config;
+    config.num_threads = num_threads;
+    const std::vector<std::vector<float>> reference = run_graph(build, config, true, num_frames);
+
+    config.execution_strategy = strategy;
+    config.pipeline_stages    = stages;
+    const std::vector<std::vector<float>> output = run_graph(build, config, true, num_frames);
+
+    Scheduler::get().set_num_threads(old_num_threads);
+
+    validate_outputs(output, reference);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ExecutionStrategy)
+
+TEST_CASE(DataflowBranchedGraph, framework::DatasetMode::ALL)
+{
+    // Two independent convolution branches joined by a concatenation
+    const auto build = [](graph::Graph & g)
+    {
+        const graph::NodeParams       params{ "", graph::Target::NEON };
+        const graph::TensorDescriptor input_desc(TensorShape(12U, 10U, 8U), DataType::F32);
+
+        const graph::NodeID input    = graph::GraphBuilder::add_input_node(g, params, input_desc, make_uniform_accessor(0));
+        const graph::NodeID branch_a = graph::GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), 6U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                                                 graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                                 make_uniform_accessor(100), make_uniform_accessor(101));
+        const graph::NodeID branch_b = graph::GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(1U, 1U), 4U, PadStrideInfo(1, 1, 0, 0), 1,
+                                                                                 graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                                 make_uniform_accessor(102), make_uniform_accessor(103));
+        const graph::NodeID concat = graph::GraphBuilder::add_concatenate_node(g, params, { { branch_a, 0 }, { branch_b, 0 } }, graph::DataLayoutDimension::CHANNEL);
+        return graph::GraphBuilder::add_activation_node(g, params, { concat, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    };
+
+    validate_strategy(build, graph::ExecutionStrategy::Dataflow);
+}
+
+TEST_CASE(PipelinedConvolutionChain, framework::DatasetMode::ALL)
+{
+    // Chain of convolutions split in three compute stages, each frame crossing the stages on different threads
+    const auto build = [](graph::Graph & g)
+    {
+        const graph::NodeParams       params{ "", graph::Target::NEON };
+        const graph::TensorDescriptor input_desc(TensorShape(16U, 14U, 4U), DataType::F32);
+
+        graph::NodeID nid = graph::GraphBuilder::add_input_node(g, params, input_desc, make_uniform_accessor(0));
+        nid               = graph::GraphBuilder::add_convolution_node(g, params, { nid, 0 }, Size2D(3U, 3U), 8U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                                      graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                      make_uniform_accessor(100), make_uniform_accessor(101));
+        nid = graph::GraphBuilder::add_activation_node(g, params, { nid, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+        nid = graph::GraphBuilder::add_convolution_node(g, params, { nid, 0 }, Size2D(3U, 3U), 8U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                        graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                        make_uniform_accessor(102), make_uniform_accessor(103));
+        nid = graph::GraphBuilder::add_activation_node(g, params, { nid, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+        return graph::GraphBuilder::add_convolution_node(g, params, { nid, 0 }, Size2D(1U, 1U), 6U, PadStrideInfo(1, 1, 0, 0), 1,
+                                                         graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                         make_uniform_accessor(104), make_uniform_accessor(105));
+    };
+
+    validate_strategy(build, graph::ExecutionStrategy::Pipelined, 3);
+}
+
+TEST_SUITE_END() // ExecutionStrategy
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_TEST_VALIDATION_NEON_GRAPH_HELPERS_H__
+#define __ARM_COMPUTE_TEST_VALIDATION_NEON_GRAPH_HELPERS_H__
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Accessor filling a graph tensor with uniformly distributed values
+ *
+ * Each call uses a new seed, so that the inputs of consecutive frames differ.
+ */
+class UniformAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] seed Seed of the random generator for the first call.
+     * @param[in] low  Lower bound of the values.
+     * @param[in] high Upper bound of the values.
+     */
+    UniformAccessor(std::random_device::result_type seed, float low, float high)
+        : _seed(seed), _low(low), _high(high)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        std::mt19937                          gen(_seed++);
+        std::uniform_real_distribution<float> distribution(_low, _high);
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            *reinterpret_cast<float *>(tensor.ptr_to_element(id)) = distribution(gen);
+        });
+        return true;
+    }
+
+private:
+    std::random_device::result_type _seed;
+    float                           _low;
+    float                           _high;
+};
+
+/** Accessor copying the elements of a graph output tensor, one vector per frame
+ *
+ * Stops the execution of the graph once the requested number of frames has been copied.
+ */
+class CopyAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] dst        Vector to append the elements of each frame to.
+     * @param[in]  num_frames Number of frames to copy.
+     */
+    CopyAccessor(std::vector<std::vector<float>> &dst, unsigned int num_frames)
+        : _dst(dst), _num_frames(num_frames)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+
+        std::vector<float> frame;
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            frame.push_back(*reinterpret_cast<const float *>(tensor.ptr_to_element(id)));
+        });
+        _dst.push_back(std::move(frame));
+        return _dst.size() < _num_frames;
+    }
+
+private:
+    std::vector<std::vector<float>> &_dst;
+    unsigned int                     _num_frames;
+};
+
+/** Creates an accessor filling a graph tensor with uniformly distributed values
+ *
+ * @param[in] seed Seed of the random generator for the first call.
+ * @param[in] low  (Optional) Lower bound of the values.
+ * @param[in] high (Optional) Upper bound of the values.
+ *
+ * @return The accessor
+ */
+inline graph::ITensorAccessorUPtr make_uniform_accessor(std::random_device::result_type seed, float low = -1.f, float high = 1.f)
+{
+    return support::cpp14::make_unique<UniformAccessor>(seed, low, high);
+}
+
+/** Build a graph, run it on NEON and return its output for each frame
+ *
+ * @param[in] build          Function adding the nodes of the graph. It returns the node whose output is read.
+ * @param[in] config         Configuration of the graph context, selecting the execution strategy.
+ * @param[in] apply_mutators True to apply the default graph passes, false to run the graph as built.
+ * @param[in] num_frames     Number of frames to run.
+ * @param[in] check          (Optional) Function called on the graph after its finalization.
+ *
+ * @return The elements of the output tensor for each frame
+ */
+inline std::vector<std::vector<float>> run_graph(const std::function<graph::NodeID(graph::Graph &)> &build, const graph::GraphConfig &config, bool apply_mutators, unsigned int num_frames,
+                                                 const std::function<void(graph::Graph &)> &check = nullptr)
+{
+    std::vector<std::vector<float>> outputs;
+
+    graph::Graph        g(0, "GraphTest");
+    graph::GraphContext ctx;
+    graph::GraphManager manager;
+    ctx.set_config(config);
+
+    const graph::NodeID last_nid = build(g);
+    graph::GraphBuilder::add_output_node(g, graph::NodeParams{ "Output", graph::Target::NEON }, { last_nid, 0 }, support::cpp14::make_unique<CopyAccessor>(outputs, num_frames));
+
+    graph::PassManager pm = apply_mutators ? graph::create_default_pass_manager(graph::Target::NEON) : graph::PassManager();
+    manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+    if(check)
+    {
+        check(g);
+    }
+    manager.execute_graph(g);
+
+    return outputs;
+}
+
+/** Build a graph, run it once on NEON with the default configuration and return its output
+ *
+ * @param[in] build          Function adding the nodes of the graph. It returns the node whose output is read.
+ * @param[in] apply_mutators True to apply the default graph passes, false to run the graph as built.
+ * @param[in] check          (Optional) Function called on the graph after its finalization.
+ *
+ * @return The elements of the output tensor
+ */
+inline std::vector<float> run_graph(const std::function<graph::NodeID(graph::Graph &)> &build, bool apply_mutators, const std::function<void(graph::Graph &)> &check = nullptr)
+{
+    std::vector<std::vector<float>> outputs = run_graph(build, graph::GraphConfig(), apply_mutators, 1, check);
+    return outputs.empty() ? std::vector<float>() : outputs.front();
+}
+
+/** Validates the output of a graph against a reference output
+ *
+ * @param[in] output    Output to validate.
+ * @param[in] reference Reference output.
+ * @param[in] tolerance (Optional) Relative tolerance.
+ */
+inline void validate_outputs(const std::vector<float> &output, const std::vector<float> &reference, float tolerance = 0.001f)
+{
+    ARM_COMPUTE_EXPECT(!output.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(output.size() == reference.size(), framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < std::min(output.size(), reference.size()); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(output[i] - reference[i]) <= tolerance * std::max(1.f, std::abs(reference[i])), framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validates the output of each frame of a graph against a reference output
+ *
+ * @param[in] outputs    Output of each frame to validate.
+ * @param[in] references Reference output of each frame.
+ * @param[in] tolerance  (Optional) Relative tolerance.
+ */
+inline void validate_outputs(const std::vector<std::vector<float>> &outputs, const std::vector<std::vector<float>> &references, float tolerance = 0.001f)
+{
+    ARM_COMPUTE_EXPECT(!outputs.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(outputs.size() == references.size(), framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < std::min(outputs.size(), references.size()); ++i)
+    {
+        validate_outputs(outputs[i], references[i], tolerance);
+    }
+}
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_TEST_VALIDATION_NEON_GRAPH_HELPERS_H__ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/GraphHelpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(NodeFusionMutator)
+
+TEST_CASE(BinaryConvolutionBatchNormalizationActivation, framework::DatasetMode::ALL)
+{
+    const auto build = [](graph::Graph & g)
+    {
+        const graph::NodeParams       params{ "", graph::Target::NEON };
+        const graph::TensorDescriptor input_desc(TensorShape(13U, 11U, 16U), DataType::F32);
+
+        graph::NodeID nid = graph::GraphBuilder::add_input_node(g, params, input_desc, make_uniform_accessor(0));
+        nid               = graph::GraphBuilder::add_binary_convolution_node(g, params, { nid, 0 }, Size2D(3U, 3U), 8U, PadStrideInfo(1, 1, 1, 1),
+                                                                             make_uniform_accessor(1), make_uniform_accessor(2));
+        nid = graph::GraphBuilder::add_batch_normalization_node(g, params, { nid, 0 }, 0.001f,
+                                                                make_uniform_accessor(3), make_uniform_accessor(4, 0.5f, 2.f),
+                                                                make_uniform_accessor(5), make_uniform_accessor(6, 0.5f, 2.f));
+        return graph::GraphBuilder::add_activation_node(g, params, { nid, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 3.f));
+    };
+
+    // The batch normalization and the activation must be fused into the binary convolution
+    const auto check = [](graph::Graph & g)
+    {
+        ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::BatchNormalizationLayer).empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::BinaryConvolutionLayer).size() == 1, framework::LogLevel::ERRORS);
+    };
+
+    validate_outputs(run_graph(build, true, check), run_graph(build, false));
+}
+
+TEST_SUITE_END() // NodeFusionMutator
+
+TEST_SUITE(PadLayerSubTensorMutator)
+
+TEST_CASE(PadChannelsInPlace, framework::DatasetMode::ALL)
+{
+    const auto build = [](graph::Graph & g)
+    {
+        const graph::NodeParams       params{ "", graph::Target::NEON };
+        const graph::TensorDescriptor input_desc(TensorShape(9U, 7U, 4U), DataType::F32);
+
+        graph::NodeID nid = graph::GraphBuilder::add_input_node(g, params, input_desc, make_uniform_accessor(0));
+        nid               = graph::GraphBuilder::add_convolution_node(g, params, { nid, 0 }, Size2D(3U, 3U), 6U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                                      graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                      make_uniform_accessor(1), make_uniform_accessor(2));
+        nid = graph::GraphBuilder::add_pad_node(g, params, { nid, 0 }, PaddingList{ { 0, 0 }, { 0, 0 }, { 2, 3 } });
+        return graph::GraphBuilder::add_convolution_node(g, params, { nid, 0 }, Size2D(3U, 3U), 5U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                         graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                         make_uniform_accessor(3), make_uniform_accessor(4));
+    };
+
+    // The first convolution must write straight into the interior of the padded tensor
+    const auto check = [](graph::Graph & g)
+    {
+        const std::vector<graph::NodeID> &pad_nodes = g.nodes(graph::NodeType::PadLayer);
+        ARM_COMPUTE_EXPECT(pad_nodes.size() == 1, framework::LogLevel::ERRORS);
+        for(const graph::NodeID nid : pad_nodes)
+        {
+            graph::Tensor *input = g.node(nid)->input(0);
+            ARM_COMPUTE_EXPECT(input != nullptr && input->handle() != nullptr && input->handle()->is_subtensor(), framework::LogLevel::ERRORS);
+        }
+    };
+
+    validate_outputs(run_graph(build, true, check), run_graph(build, false));
+}
+
+TEST_CASE(PadConcatenationOutput, framework::DatasetMode::ALL)
+{
+    const auto build = [](graph::Graph & g)
+    {
+        const graph::NodeParams       params{ "", graph::Target::NEON };
+        const graph::TensorDescriptor input_desc(TensorShape(9U, 7U, 4U), DataType::F32);
+
+        const graph::NodeID input    = graph::GraphBuilder::add_input_node(g, params, input_desc, make_uniform_accessor(0));
+        const graph::NodeID branch_a = graph::GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), 6U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                                                 graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                                 make_uniform_accessor(1), make_uniform_accessor(2));
+        const graph::NodeID branch_b = graph::GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(1U, 1U), 3U, PadStrideInfo(1, 1, 0, 0), 1,
+                                                                                 graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                                 make_uniform_accessor(3), make_uniform_accessor(4));
+        graph::NodeID nid = graph::GraphBuilder::add_concatenate_node(g, params, { { branch_a, 0 }, { branch_b, 0 } }, graph::DataLayoutDimension::CHANNEL);
+        nid               = graph::GraphBuilder::add_pad_node(g, params, { nid, 0 }, PaddingList{ { 0, 0 }, { 0, 0 }, { 1, 2 } });
+        return graph::GraphBuilder::add_convolution_node(g, params, { nid, 0 }, Size2D(3U, 3U), 5U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                         graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                         make_uniform_accessor(5), make_uniform_accessor(6));
+    };
+
+    // The inputs of the concatenation are sub-tensors of its output, so the output of the concatenation must keep its own handle
+    const auto check = [](graph::Graph & g)
+    {
+        const std::vector<graph::NodeID> &pad_nodes = g.nodes(graph::NodeType::PadLayer);
+        ARM_COMPUTE_EXPECT(pad_nodes.size() == 1, framework::LogLevel::ERRORS);
+        for(const graph::NodeID nid : pad_nodes)
+        {
+            graph::Tensor *input = g.node(nid)->input(0);
+            ARM_COMPUTE_EXPECT(input != nullptr && input->handle() != nullptr && !input->handle()->is_subtensor(), framework::LogLevel::ERRORS);
+            for(const graph::NodeID concat_nid : g.nodes(graph::NodeType::ConcatenateLayer))
+            {
+                const graph::INode *concat = g.node(concat_nid);
+                for(unsigned int i = 0; i < concat->num_inputs(); ++i)
+                {
+                    graph::Tensor *concat_input = concat->input(i);
+                    ARM_COMPUTE_EXPECT(concat_input != nullptr && concat_input->handle() != nullptr && input != nullptr, framework::LogLevel::ERRORS);
+                    if(concat_input != nullptr && concat_input->handle() != nullptr && input != nullptr && concat_input->handle()->is_subtensor())
+                    {
+                        ARM_COMPUTE_EXPECT(concat_input->handle()->parent_handle() == input->handle(), framework::LogLevel::ERRORS);
+                    }
+                }
+            }
+        }
+    };
+
+    validate_outputs(run_graph(build, true, check), run_graph(build, false));
+}
+
+TEST_SUITE_END() // PadLayerSubTensorMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -49,6 +49,14 @@ const auto PaddingSizesDataset = framework::dataset::make("PaddingSize", { Paddi
     PaddingList{ { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 2 } },
     PaddingList{ { 0, 0 }, { 0, 0 }, { 0, 0 }, { 1, 1 } }
 });
+
+/** Mirrored padding needs inputs at least as large as the padding */
+const auto MirrorShapesDataset  = framework::dataset::make("Shape", { TensorShape(9U, 7U, 5U), TensorShape(3U, 3U, 3U, 2U), TensorShape(33U, 13U, 4U) });
+const auto MirrorPaddingDataset = combine(framework::dataset::make("PaddingSize", { PaddingList{ { 1, 2 } },
+                                                                                    PaddingList{ { 2, 2 }, { 1, 1 }, { 2, 0 } },
+                                                                                    PaddingList{ { 0, 1 }, { 2, 1 } }
+                                                                                  }),
+                                          framework::dataset::make("PaddingMode", { PaddingMode::REFLECT, PaddingMode::SYMMETRIC }));
 } // namespace
 
 TEST_SUITE(NEON)
@@ -57,32 +65,51 @@ TEST_SUITE(PadLayer)
 // *INDENT-OFF*
 // clang-format off
 
-DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
         framework::dataset::make("InputInfo", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),     // Mismatching data type input/output
                                                 TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),     // Mismatching shapes
                                                 TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
-                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32)
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),     // Reflected padding as large as the input
+                                                TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32)      // Symmetric padding larger than the input
         }),
         framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F16),
                                                 TensorInfo(TensorShape(28U, 11U, 2U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(29U, 17U, 2U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(29U, 15U, 4U, 3U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(27U, 14U, 3U, 4U), 1, DataType::F32),
-                                                TensorInfo(TensorShape(32U, 13U, 2U, 3U), 1, DataType::F32)
+                                                TensorInfo(TensorShape(32U, 13U, 2U, 3U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(27U, 13U, 6U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(27U, 13U, 6U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(27U, 13U, 8U), 1, DataType::F32)
         })),
         framework::dataset::make("PaddingSize", { PaddingList{{0, 0}},
                                                   PaddingList{{1, 1}},
                                                   PaddingList{{1, 1}, {2, 2}},
                                                   PaddingList{{1,1}, {1,1}, {1,1}, {1,1}},
                                                   PaddingList{{0,0}, {1,0}, {0,1}, {1,2}},
-                                                  PaddingList{{0,0}, {0,0}, {0,0}, {1,1}}
+                                                  PaddingList{{0,0}, {0,0}, {0,0}, {1,1}},
+                                                  PaddingList{{0,0}, {0,0}, {2,2}},
+                                                  PaddingList{{0,0}, {0,0}, {2,2}},
+                                                  PaddingList{{0,0}, {0,0}, {3,3}}
+        })),
+        framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT,
+                                                  PaddingMode::CONSTANT,
+                                                  PaddingMode::CONSTANT,
+                                                  PaddingMode::CONSTANT,
+                                                  PaddingMode::CONSTANT,
+                                                  PaddingMode::CONSTANT,
+                                                  PaddingMode::REFLECT,
+                                                  PaddingMode::SYMMETRIC,
+                                                  PaddingMode::SYMMETRIC
         })),
-        framework::dataset::make("Expected", { false, false, true, true, true, true })),
-        input_info, output_info, padding, expected)
+        framework::dataset::make("Expected", { false, false, true, true, true, true, false, true, false })),
+        input_info, output_info, padding, mode, expected)
 {
-    Status s = NEPadLayer::validate(&input_info.clone()->set_is_resizable(true), &output_info.clone()->set_is_resizable(true), padding);
+    Status s = NEPadLayer::validate(&input_info.clone()->set_is_resizable(true), &output_info.clone()->set_is_resizable(true), padding, PixelValue(), mode);
     ARM_COMPUTE_EXPECT(bool(s) == expected, framework::LogLevel::ERRORS);
 }
 
@@ -96,17 +123,25 @@ TEST_SUITE(Float)
 
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEPaddingFixture<float>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::F32 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(Accessor(_target), _reference);
 }
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPaddingFixture<float>, framework::DatasetMode::NIGHTLY,
-                       combine(
+                       combine(combine(
                            combine(datasets::LargeShapes(), framework::dataset::make("DataType", { DataType::F32 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+FIXTURE_DATA_TEST_CASE(RunMirror, NEPaddingFixture<float>, framework::DatasetMode::ALL,
+                       combine(combine(MirrorShapesDataset, framework::dataset::make("DataType", { DataType::F32 })), MirrorPaddingDataset))
 {
     // Validate output
     validate(Accessor(_target), _reference);
@@ -116,17 +151,19 @@ TEST_SUITE_END() // FP32
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 TEST_SUITE(FP16)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEPaddingFixture<half>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::F16 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(Accessor(_target), _reference);
 }
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPaddingFixture<half>, framework::DatasetMode::NIGHTLY,
-                       combine(
+                       combine(combine(
                            combine(datasets::LargeShapes(), framework::dataset::make("DataType", { DataType::F16 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(Accessor(_target), _reference);
@@ -138,17 +175,19 @@ TEST_SUITE_END() // Float
 TEST_SUITE(Integer)
 TEST_SUITE(S8)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEPaddingFixture<int8_t>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::S8 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(Accessor(_target), _reference);
 }
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPaddingFixture<int8_t>, framework::DatasetMode::NIGHTLY,
-                       combine(
+                       combine(combine(
                            combine(datasets::LargeShapes(), framework::dataset::make("DataType", { DataType::S8 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(Accessor(_target), _reference);
@@ -159,17 +198,25 @@ TEST_SUITE_END() // Integer
 TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEPaddingFixture<uint8_t>, framework::DatasetMode::ALL,
-                       combine(
+                       combine(combine(
                            combine(datasets::SmallShapes(), framework::dataset::make("DataType", { DataType::QASYMM8 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
 {
     // Validate output
     validate(Accessor(_target), _reference);
 }
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPaddingFixture<uint8_t>, framework::DatasetMode::NIGHTLY,
-                       combine(
+                       combine(combine(
                            combine(datasets::LargeShapes(), framework::dataset::make("DataType", { DataType::QASYMM8 })),
-                           PaddingSizesDataset))
+                           PaddingSizesDataset),
+                       framework::dataset::make("PaddingMode", { PaddingMode::CONSTANT })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+FIXTURE_DATA_TEST_CASE(RunMirror, NEPaddingFixture<uint8_t>, framework::DatasetMode::ALL,
+                       combine(combine(MirrorShapesDataset, framework::dataset::make("DataType", { DataType::QASYMM8 })), MirrorPaddingDataset))
 {
     // Validate output
     validate(Accessor(_target), _reference);
@@ -22,12 +22,18 @@
  * SOFTWARE.
  */
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/BlobMemoryPool.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/HostMemoryTracker.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
 #include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/TensorAllocator.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 #include "tests/AssetsLibrary.h"
 #include "tests/Globals.h"
@@ -36,6 +42,11 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -90,6 +101,213 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(OffsetMemoryManagerOverlapsDisjointLifetimes, framework::DatasetMode::ALL)
+{
+    Allocator   allocator{};
+    auto        lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
+    auto        pool_mgr     = std::make_shared<PoolManager>();
+    auto        mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+    MemoryGroup memory_group(mm);
+
+    // Chain of tensors, each one alive until the next one is produced
+    const std::vector<unsigned int> sizes{ 8000U, 1000U, 1000U, 8000U };
+    std::vector<Tensor>             tensors(sizes.size());
+    for(unsigned int i = 0; i < sizes.size(); ++i)
+    {
+        tensors[i].allocator()->init(TensorInfo(TensorShape(sizes[i]), 1, DataType::U8));
+    }
+    memory_group.manage(&tensors[0]);
+    for(unsigned int i = 1; i < sizes.size(); ++i)
+    {
+        memory_group.manage(&tensors[i]);
+        tensors[i - 1].allocator()->allocate();
+    }
+    tensors.back().allocator()->allocate();
+
+    // The two large tensors are never alive at the same time so they share their memory
+    ARM_COMPUTE_EXPECT(lifetime_mgr->info().size == 10000U, framework::LogLevel::ERRORS);
+
+    mm->populate(allocator, 1 /* num_pools */);
+    ARM_COMPUTE_EXPECT(mm->pool_size() == 10000U, framework::LogLevel::ERRORS);
+    memory_group.acquire();
+    ARM_COMPUTE_EXPECT(tensors[0].buffer() == tensors[3].buffer(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tensors[1].buffer() != tensors[2].buffer(), framework::LogLevel::ERRORS);
+    memory_group.release();
+
+    mm->clear();
+}
+
+TEST_CASE(HostMemoryTrackerAccountsNestedScopes, framework::DatasetMode::ALL)
+{
+    auto parent = std::make_shared<HostMemoryTracker>();
+    auto child  = std::make_shared<HostMemoryTracker>(parent);
+
+    ARM_COMPUTE_EXPECT(HostMemoryTracker::current() == nullptr, framework::LogLevel::ERRORS);
+    {
+        HostMemoryTracker::Scope scope(child.get());
+        ARM_COMPUTE_EXPECT(HostMemoryTracker::current() == child, framework::LogLevel::ERRORS);
+
+        MemoryRegion region0(1000);
+        {
+            MemoryRegion region1(500);
+            ARM_COMPUTE_EXPECT(child->usage().resident == 1500U, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(parent->usage().resident == 1500U, framework::LogLevel::ERRORS);
+        }
+        ARM_COMPUTE_EXPECT(child->usage().resident == 1000U, framework::LogLevel::ERRORS);
+
+        // Allocations outside of any scope aren't accounted for
+        HostMemoryTracker::Scope untracked(nullptr);
+        MemoryRegion             region2(2000);
+        ARM_COMPUTE_EXPECT(parent->usage().resident == 1000U, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(HostMemoryTracker::current() == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(parent->usage().resident == 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(parent->usage().peak == 1500U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(child->usage().peak == 1500U, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(WeightsCacheSharesPreparedWeights, framework::DatasetMode::ALL)
+{
+    auto cache = std::make_shared<WeightsCache>();
+
+    // Two instances of the same layer, the second one with different weights
+    Tensor src      = create_tensor<Tensor>(TensorShape(32U), DataType::F32, 1);
+    Tensor weights0 = create_tensor<Tensor>(TensorShape(32U, 16U), DataType::F32, 1);
+    Tensor weights1 = create_tensor<Tensor>(TensorShape(32U, 16U), DataType::F32, 1);
+    Tensor bias     = create_tensor<Tensor>(TensorShape(16U), DataType::F32, 1);
+    Tensor dst0     = create_tensor<Tensor>(TensorShape(16U), DataType::F32, 1);
+    Tensor dst1     = create_tensor<Tensor>(TensorShape(16U), DataType::F32, 1);
+
+    NEFullyConnectedLayer fc0;
+    NEFullyConnectedLayer fc1;
+    fc0.configure(&src, &weights0, &bias, &dst0);
+    fc1.configure(&src, &weights1, &bias, &dst1);
+
+    for(auto *tensor : { &src, &weights0, &weights1, &bias, &dst0, &dst1 })
+    {
+        tensor->allocator()->allocate();
+    }
+    arm_compute::test::library->fill_tensor_uniform(Accessor(src), 0);
+    arm_compute::test::library->fill_tensor_uniform(Accessor(weights0), 1);
+    arm_compute::test::library->fill_tensor_uniform(Accessor(weights1), 2);
+    arm_compute::test::library->fill_tensor_uniform(Accessor(bias), 3);
+
+    // Prepare both layers under the same key
+    {
+        WeightsCache::Scope scope(cache.get(), "fc");
+        fc0.prepare();
+    }
+    ARM_COMPUTE_EXPECT(cache->size() != 0, framework::LogLevel::ERRORS);
+    {
+        WeightsCache::Scope scope(cache.get(), "fc");
+        fc1.prepare();
+    }
+
+    // The second layer runs with the weights prepared by the first one
+    fc0.run();
+    fc1.run();
+    Window window;
+    window.use_tensor_dimensions(dst0.info()->tensor_shape());
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_EXPECT(*reinterpret_cast<float *>(dst0.ptr_to_element(id)) == *reinterpret_cast<float *>(dst1.ptr_to_element(id)), framework::LogLevel::ERRORS);
+    });
+
+    cache->release("fc");
+    ARM_COMPUTE_EXPECT(cache->size() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(WeightsCacheKeysShapeAndDataType, framework::DatasetMode::ALL)
+{
+    auto cache = std::make_shared<WeightsCache>();
+
+    // Weights acquired under the same key and index, only the ones with the same shape and data type can be shared
+    Tensor weights      = create_tensor<Tensor>(TensorShape(16U, 4U), DataType::F32, 1);
+    Tensor same_weights = create_tensor<Tensor>(TensorShape(16U, 4U), DataType::F32, 1);
+    Tensor larger       = create_tensor<Tensor>(TensorShape(32U, 4U), DataType::F32, 1);
+    Tensor other_type   = create_tensor<Tensor>(TensorShape(16U, 4U), DataType::S32, 1);
+
+    for(auto *tensor : { &weights, &larger, &other_type, &same_weights })
+    {
+        WeightsCache::Scope scope(cache.get(), "weights");
+        const bool          is_shared = WeightsCache::acquire(*tensor);
+        ARM_COMPUTE_EXPECT(is_shared == (tensor == &same_weights), framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(same_weights.buffer() == weights.buffer(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(larger.buffer() != weights.buffer(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(other_type.buffer() != weights.buffer(), framework::LogLevel::ERRORS);
+
+    cache->release("weights");
+    ARM_COMPUTE_EXPECT(cache->size() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(PoolManagerLocksPoolsConcurrently, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_threads    = 8;
+    constexpr unsigned int num_pools      = 3;
+    constexpr unsigned int num_iterations = 1000;
+
+    Allocator                  allocator{};
+    PoolManager                manager;
+    std::vector<IMemoryPool *> pools;
+    for(unsigned int i = 0; i < num_pools; ++i)
+    {
+        auto pool = support::cpp14::make_unique<BlobMemoryPool>(&allocator, std::vector<BlobInfo>());
+        pools.push_back(pool.get());
+        manager.register_pool(std::move(pool));
+    }
+
+    // Count the threads holding each pool: more threads than pools makes some of them wait for a pool to be unlocked
+    std::atomic<unsigned int> holders[num_pools];
+    for(auto &count : holders)
+    {
+        count.store(0);
+    }
+    std::atomic<unsigned int> num_locks(0);
+    std::atomic<bool>         shared(false);
+    std::atomic<bool>         unknown(false);
+
+    std::vector<std::thread> threads;
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+        {
+            for(unsigned int i = 0; i < num_iterations; ++i)
+            {
+                IMemoryPool *pool = manager.lock_pool();
+                const auto   it   = std::find(pools.begin(), pools.end(), pool);
+                if(it == pools.end())
+                {
+                    unknown = true;
+                }
+                else
+                {
+                    std::atomic<unsigned int> &count = holders[std::distance(pools.begin(), it)];
+                    if(count.fetch_add(1) != 0)
+                    {
+                        shared = true;
+                    }
+                    std::this_thread::yield();
+                    count.fetch_sub(1);
+                }
+                ++num_locks;
+                manager.unlock_pool(pool);
+            }
+        });
+    }
+
+    // The threads only finish if every waiter is woken up when a pool is unlocked
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ARM_COMPUTE_EXPECT(!unknown, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!shared, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(num_locks == num_threads * num_iterations, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(manager.release_pool() != nullptr, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
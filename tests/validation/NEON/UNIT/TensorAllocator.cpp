@@ -24,6 +24,8 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 
 #include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryRegion.h"
 
@@ -33,6 +35,8 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace test
@@ -82,6 +86,37 @@ TEST_CASE(ImportMemory, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(t4.buffer() == nullptr, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(ImportSharedMemory, framework::DatasetMode::ALL)
+{
+    // Init tensor info
+    TensorInfo info(TensorShape(24U, 16U, 3U), 1, DataType::F32);
+    auto       region = std::make_shared<MemoryRegion>(info.total_size());
+
+    // Negative case : Import a region smaller than the tensor
+    Tensor t1;
+    t1.allocator()->init(info);
+    ARM_COMPUTE_EXPECT(!bool(t1.allocator()->import_memory(Memory(std::make_shared<MemoryRegion>(info.total_size() / 2)))), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t1.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+    // Positive case : The tensors share the ownership of the region
+    Tensor t2;
+    Tensor t3;
+    t2.allocator()->init(info);
+    t3.allocator()->init(info);
+    ARM_COMPUTE_EXPECT(bool(t2.allocator()->import_memory(Memory(region))), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(t3.allocator()->import_memory(Memory(region))), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!t2.info()->is_resizable(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t2.buffer() == reinterpret_cast<uint8_t *>(region->buffer()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t3.buffer() == t2.buffer(), framework::LogLevel::ERRORS);
+
+    // The region outlives its original owner and the other tensors
+    region.reset();
+    t2.allocator()->free();
+    ARM_COMPUTE_EXPECT(t2.buffer() == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t3.buffer() != nullptr, framework::LogLevel::ERRORS);
+    std::fill_n(t3.buffer(), info.total_size(), 0);
+}
+
 TEST_CASE(AlignedAlloc, framework::DatasetMode::ALL)
 {
     // Init tensor info
@@ -98,6 +133,38 @@ TEST_CASE(AlignedAlloc, framework::DatasetMode::ALL)
                        framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(AllocationPolicies, framework::DatasetMode::ALL)
+{
+    // Large enough to be mapped on huge pages when the policy asks for it
+    TensorInfo   info(TensorShape(256U, 256U, 16U), 1, DataType::F32);
+    const size_t requested_alignment = 1024;
+
+    for(auto policy : { HostMemoryPolicy::ZERO_INITIALIZED, HostMemoryPolicy::UNINITIALIZED, HostMemoryPolicy::HUGE_PAGES })
+    {
+        Allocator allocator(policy);
+        auto      region = allocator.make_region(info.total_size(), requested_alignment);
+        ARM_COMPUTE_EXPECT(region != nullptr && region->buffer() != nullptr, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(region->buffer(), requested_alignment), framework::LogLevel::ERRORS);
+
+        const uint8_t *ptr = static_cast<const uint8_t *>(region->buffer());
+        if(policy == HostMemoryPolicy::ZERO_INITIALIZED)
+        {
+            ARM_COMPUTE_EXPECT(std::all_of(ptr, ptr + info.total_size(), [](uint8_t v)
+            {
+                return v == 0;
+            }),
+            framework::LogLevel::ERRORS);
+        }
+
+        // The whole region must be usable
+        Tensor t;
+        t.allocator()->init(info, requested_alignment);
+        ARM_COMPUTE_EXPECT(bool(t.allocator()->import_memory(region->buffer(), info.total_size())), framework::LogLevel::ERRORS);
+        std::fill_n(t.buffer(), info.total_size(), 0x5A);
+        ARM_COMPUTE_EXPECT(ptr[info.total_size() - 1] == 0x5A, framework::LogLevel::ERRORS);
+    }
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
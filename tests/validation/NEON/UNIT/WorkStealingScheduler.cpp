@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Kernel counting how many times each element of its window is visited, the first rows being much slower than the other ones */
+class CountingKernel final : public ICPPKernel
+{
+public:
+    /** Constructor
+     *
+     * @param[in] width     Number of elements per row.
+     * @param[in] height    Number of rows.
+     * @param[in] slow_rows Number of rows at the top of the window which take longer, so that the threads running them are left behind.
+     */
+    CountingKernel(unsigned int width, unsigned int height, unsigned int slow_rows)
+        : _width(width), _slow_rows(slow_rows), _counts(width * height)
+    {
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, width, 1));
+        win.set(Window::DimY, Window::Dimension(0, height, 1));
+        ICPPKernel::configure(win);
+        reset();
+    }
+
+    /** Reset the counts */
+    void reset()
+    {
+        for(auto &count : _counts)
+        {
+            count.store(0);
+        }
+    }
+
+    /** Check that every element was visited exactly once
+     *
+     * @return True if every element was visited once
+     */
+    bool all_visited_once() const
+    {
+        for(const auto &count : _counts)
+        {
+            if(count.load() != 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            if(static_cast<unsigned int>(id.y()) < _slow_rows && id.x() == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+            _counts[id.y() * _width + id.x()].fetch_add(1);
+        });
+    }
+
+    const char *name() const override
+    {
+        return "CountingKernel";
+    }
+
+private:
+    unsigned int                           _width;
+    unsigned int                           _slow_rows;
+    std::vector<std::atomic<unsigned int>> _counts;
+};
+
+/** Run a function with the default scheduler and with the work stealing one
+ *
+ * @param[in] run       Function running the computations and returning the tensor holding their result.
+ * @param[in] tolerance Absolute tolerance between the two results.
+ */
+void compare_with_default_scheduler(const std::function<void(Tensor &)> &run, float tolerance)
+{
+    Tensor reference;
+    Tensor target;
+
+    run(reference);
+
+    const Scheduler::Type default_type = Scheduler::get_type();
+    Scheduler::set(Scheduler::Type::CPP_WORK_STEALING);
+    run(target);
+    Scheduler::set(default_type);
+
+    ARM_COMPUTE_EXPECT(reference.info()->tensor_shape() == target.info()->tensor_shape(), framework::LogLevel::ERRORS);
+
+    Window window;
+    window.use_tensor_dimensions(reference.info()->tensor_shape());
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const float ref = *reinterpret_cast<const float *>(reference.ptr_to_element(id));
+        const float out = *reinterpret_cast<const float *>(target.ptr_to_element(id));
+        ARM_COMPUTE_EXPECT(std::abs(ref - out) <= tolerance, framework::LogLevel::ERRORS);
+    });
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(WorkStealingScheduler)
+
+TEST_CASE(VisitsEveryWindowOnce, framework::DatasetMode::ALL)
+{
+    if(!Scheduler::is_available(Scheduler::Type::CPP_WORK_STEALING))
+    {
+        return;
+    }
+
+    const Scheduler::Type default_type = Scheduler::get_type();
+    Scheduler::set(Scheduler::Type::CPP_WORK_STEALING);
+    IScheduler        &scheduler   = Scheduler::get();
+    const unsigned int num_threads = scheduler.num_threads();
+
+    // More threads than cores, so that threads get descheduled in the middle of the job
+    scheduler.set_num_threads(4);
+
+    // Imbalanced job: the threads done with their own rows steal the rows of the slow ones
+    CountingKernel kernel(16, 64, 8);
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        kernel.reset();
+        scheduler.schedule(&kernel, Window::DimY);
+        ARM_COMPUTE_EXPECT(kernel.all_visited_once(), framework::LogLevel::ERRORS);
+
+        // Leave the workers idle long enough for them to park, the next job must wake them up
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // Back-to-back small jobs, caught by the spinning workers
+    CountingKernel small_kernel(4, 3, 0);
+    for(unsigned int i = 0; i < 1000; ++i)
+    {
+        small_kernel.reset();
+        scheduler.schedule(&small_kernel, Window::DimY);
+        ARM_COMPUTE_EXPECT(small_kernel.all_visited_once(), framework::LogLevel::ERRORS);
+    }
+
+    scheduler.set_num_threads(num_threads);
+    Scheduler::set(default_type);
+}
+
+TEST_CASE(MatchesDefaultScheduler, framework::DatasetMode::ALL)
+{
+    if(!Scheduler::is_available(Scheduler::Type::CPP_WORK_STEALING))
+    {
+        return;
+    }
+
+    // Element-wise function: the results must be identical
+    compare_with_default_scheduler([](Tensor & dst)
+    {
+        Tensor src = create_tensor<Tensor>(TensorShape(27U, 13U, 9U), DataType::F32, 1);
+        dst.allocator()->init(*src.info());
+
+        NEActivationLayer act;
+        act.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(src), 0);
+
+        for(unsigned int i = 0; i < 10; ++i)
+        {
+            act.run();
+        }
+    },
+    0.f);
+
+    // Matrix multiplication: the blocking may depend on the number of threads, so the accumulations can happen in a different order
+    compare_with_default_scheduler([](Tensor & dst)
+    {
+        Tensor a = create_tensor<Tensor>(TensorShape(67U, 45U), DataType::F32, 1);
+        Tensor b = create_tensor<Tensor>(TensorShape(31U, 67U), DataType::F32, 1);
+        dst.allocator()->init(TensorInfo(TensorShape(31U, 45U), 1, DataType::F32));
+
+        NEGEMM gemm;
+        gemm.configure(&a, &b, nullptr, &dst, 1.f, 0.f);
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a), 1);
+        library->fill_tensor_uniform(Accessor(b), 2);
+
+        gemm.run();
+    },
+    0.001f);
+}
+
+TEST_SUITE_END() // WorkStealingScheduler
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
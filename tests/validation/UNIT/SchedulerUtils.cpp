@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SchedulerUtils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Execution window of @p height rows and @p depth planes */
+Window create_window(unsigned int height, unsigned int depth)
+{
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 16, 16));
+    win.set(Window::DimY, Window::Dimension(0, height, 1));
+    win.set(Window::DimZ, Window::Dimension(0, depth, 1));
+    return win;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(SchedulerUtils)
+
+TEST_CASE(Split1D, framework::DatasetMode::ALL)
+{
+    const Window            win = create_window(7, 64);
+    const IScheduler::Hints hints(Window::DimY);
+
+    ARM_COMPUTE_EXPECT(!hints.is_2d_split(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler_utils::num_iterations(win, hints) == 7, framework::LogLevel::ERRORS);
+
+    const std::pair<unsigned int, unsigned int> grid = scheduler_utils::split_grid(win, hints, 7, 8);
+    ARM_COMPUTE_EXPECT(grid.first == 7, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(grid.second == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(SameDimensions, framework::DatasetMode::ALL)
+{
+    const IScheduler::Hints hints = IScheduler::Hints(Window::DimY).set_secondary_split_dimension(Window::DimY);
+    ARM_COMPUTE_EXPECT(!hints.is_2d_split(), framework::LogLevel::ERRORS);
+}
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Split2D, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+               framework::dataset::make("Height",      {  7U, 64U, 3U,  3U, 5U, 56U }),
+               framework::dataset::make("Depth",       { 64U,  1U, 3U,  3U, 1U, 56U })),
+               framework::dataset::make("MaxTiles",    {  8U,  8U, 8U,  9U, 5U, 24U })),
+               framework::dataset::make("NumThreads",  {  8U,  8U, 8U,  8U, 8U,  8U })),
+               framework::dataset::make("ExpectedY",   {  1U,  8U, 2U,  3U, 5U,  2U })),
+               framework::dataset::make("ExpectedZ",   {  8U,  1U, 3U,  3U, 1U,  8U })),
+               height, depth, max_tiles, num_threads, expected_y, expected_z)
+{
+    const Window            win   = create_window(height, depth);
+    const IScheduler::Hints hints = IScheduler::Hints(Window::DimY).set_secondary_split_dimension(Window::DimZ);
+
+    ARM_COMPUTE_EXPECT(hints.is_2d_split(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler_utils::num_iterations(win, hints) == height * depth, framework::LogLevel::ERRORS);
+
+    const std::pair<unsigned int, unsigned int> grid = scheduler_utils::split_grid(win, hints, max_tiles, num_threads);
+    ARM_COMPUTE_EXPECT(grid.first == expected_y, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(grid.second == expected_z, framework::LogLevel::ERRORS);
+
+    // Every element of the window must belong to exactly one tile
+    std::vector<unsigned int> hits(height * depth, 0);
+    for(unsigned int id = 0; id < grid.first * grid.second; ++id)
+    {
+        const Window tile = scheduler_utils::split_window(win, hints, id, grid);
+        ARM_COMPUTE_EXPECT(tile.x().start() == win.x().start() && tile.x().end() == win.x().end(), framework::LogLevel::ERRORS);
+        for(int z = tile.z().start(); z < tile.z().end(); ++z)
+        {
+            for(int y = tile.y().start(); y < tile.y().end(); ++y)
+            {
+                ++hits[z * height + y];
+            }
+        }
+    }
+    for(unsigned int hit : hits)
+    {
+        ARM_COMPUTE_EXPECT(hit == 1, framework::LogLevel::ERRORS);
+    }
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(SplitWeighted, framework::DatasetMode::ALL)
+{
+    const Window                    win = create_window(101, 1);
+    const IScheduler::Hints         hints(Window::DimY);
+    const std::vector<unsigned int> weights{ 1024, 512, 1, 1024 };
+    const std::vector<unsigned int> expected_rows{ 39, 21, 1, 40 };
+
+    // Chunks must be contiguous, cover the whole window and contain at least one row
+    int next_row = win.y().start();
+    for(unsigned int id = 0; id < weights.size(); ++id)
+    {
+        const Window chunk = scheduler_utils::split_window_weighted(win, hints, id, weights);
+        ARM_COMPUTE_EXPECT(chunk.y().start() == next_row, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(static_cast<unsigned int>(chunk.y().end() - chunk.y().start()) == expected_rows[id], framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(chunk.z().start() == win.z().start() && chunk.z().end() == win.z().end(), framework::LogLevel::ERRORS);
+        next_row = chunk.y().end();
+    }
+    ARM_COMPUTE_EXPECT(next_row == win.y().end(), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // SchedulerUtils
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
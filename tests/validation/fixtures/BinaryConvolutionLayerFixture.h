@@ -33,11 +33,14 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Fixture.h"
 #include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
 #include "tests/validation/reference/BinaryConvolutionLayer.h"
 
 #include "utils/Utils.h"
 
+#include <cstdio>
 #include <random>
+#include <string>
 
 namespace arm_compute
 {
@@ -147,6 +150,225 @@ protected:
     TensorType          _target{};
     SimpleTensor<float> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename PackedWeightsType>
+class BinaryConvolutionLayerPrepackedValidationFixture : public BinaryConvolutionLayerValidationFixture<TensorType, AccessorType, FunctionType>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, DataLayout data_layout)
+    {
+        ARM_COMPUTE_ERROR_ON(dilation != Size2D(1U, 1U));
+
+        this->_target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, data_layout);
+        this->_reference = this->compute_reference(input_shape, weights_shape, bias_shape, output_shape, info);
+    }
+
+protected:
+    TensorType compute_target(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, const PadStrideInfo &info,
+                              const DataLayout &data_layout)
+    {
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(output_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType weights = create_tensor<TensorType>(weights_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType dst     = create_tensor<TensorType>(output_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+
+        // Pack the weights and map them back from a file, as done when deploying a model
+        const std::string filename = "binary_convolution_layer_weights.bin";
+        {
+            weights.allocator()->allocate();
+            this->fill(AccessorType(weights), 1);
+
+            PackedWeightsType packed_weights;
+            packed_weights.pack(&weights);
+            packed_weights.save(filename);
+
+            weights.allocator()->free();
+        }
+
+        PackedWeightsType packed_weights;
+        packed_weights.load(filename);
+        std::remove(filename.c_str());
+
+        // Create Binary Convolution configure function
+        FunctionType bc;
+        bc.configure(&src, packed_weights.weights(), &bias, &dst, info, packed_weights.weights_info(), packed_weights.alpha());
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(bias), 2);
+
+        // Compute function
+        bc.run();
+
+        return dst;
+    }
+};
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class BinaryConvolutionLayerFusedValidationFixture : public BinaryConvolutionLayerValidationFixture<TensorType, AccessorType, FunctionType>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, DataLayout data_layout,
+               ActivationLayerInfo act_info, bool chained)
+    {
+        ARM_COMPUTE_ERROR_ON(dilation != Size2D(1U, 1U));
+
+        // When chained, the output of the fused layer is binarized and fed to a 3x3 binary convolution
+        const TensorShape next_weights_shape(3U, 3U, output_shape.z(), _next_num_kernels);
+        TensorShape       next_output_shape = output_shape;
+        next_output_shape.set(2, _next_num_kernels);
+
+        this->_target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, data_layout, act_info, chained, next_weights_shape, next_output_shape);
+        this->_reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, info, act_info, chained, next_weights_shape, next_output_shape);
+    }
+
+protected:
+    TensorType compute_target(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, const PadStrideInfo &info,
+                              const DataLayout &data_layout, const ActivationLayerInfo &act_info, bool chained, TensorShape next_weights_shape, TensorShape next_output_shape)
+    {
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(output_shape, PermutationVector(2U, 0U, 1U));
+            permute(next_weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(next_output_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src          = create_tensor<TensorType>(input_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType weights      = create_tensor<TensorType>(weights_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType bias         = create_tensor<TensorType>(bias_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType scale        = create_tensor<TensorType>(bias_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType shift        = create_tensor<TensorType>(bias_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType dst          = create_tensor<TensorType>(output_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType next_weights = create_tensor<TensorType>(next_weights_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType next_bias    = create_tensor<TensorType>(TensorShape(_next_num_kernels), DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType next_dst     = create_tensor<TensorType>(next_output_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType binarized_dst;
+        TensorType dst_beta;
+
+        // Create and configure functions. When chained, dst only describes the output of the first layer and is never allocated
+        FunctionType bc;
+        FunctionType next_bc;
+        if(chained)
+        {
+            bc.configure(&src, &weights, &bias, &dst, info, WeightsInfo(), nullptr, &scale, &shift, act_info, nullptr, nullptr, &binarized_dst, &dst_beta);
+            next_bc.configure(&dst, &next_weights, &next_bias, &next_dst, PadStrideInfo(1, 1, 1, 1), WeightsInfo(), nullptr, nullptr, nullptr, ActivationLayerInfo(),
+                              &binarized_dst, &dst_beta);
+        }
+        else
+        {
+            bc.configure(&src, &weights, &bias, &dst, info, WeightsInfo(), nullptr, &scale, &shift, act_info);
+        }
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        scale.allocator()->allocate();
+        shift.allocator()->allocate();
+        if(chained)
+        {
+            binarized_dst.allocator()->allocate();
+            dst_beta.allocator()->allocate();
+            next_weights.allocator()->allocate();
+            next_bias.allocator()->allocate();
+            next_dst.allocator()->allocate();
+        }
+        else
+        {
+            dst.allocator()->allocate();
+        }
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(weights), 1);
+        this->fill(AccessorType(bias), 2);
+        this->fill(AccessorType(scale), 3);
+        this->fill(AccessorType(shift), 4);
+
+        // Compute functions
+        bc.run();
+
+        if(chained)
+        {
+            this->fill(AccessorType(next_weights), 5);
+            this->fill(AccessorType(next_bias), 6);
+
+            next_bc.run();
+            return next_dst;
+        }
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &in_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &out_shape,
+                                          const PadStrideInfo &info, const ActivationLayerInfo &act_info, bool chained, const TensorShape &next_weights_shape,
+                                          const TensorShape &next_out_shape)
+    {
+        SimpleTensor<float> scale{ bias_shape, DataType::F32 };
+        SimpleTensor<float> shift{ bias_shape, DataType::F32 };
+
+        this->fill(scale, 3);
+        this->fill(shift, 4);
+
+        SimpleTensor<float> dst = this->compute_reference(in_shape, weights_shape, bias_shape, out_shape, info);
+
+        for(int i = 0; i < dst.num_elements(); ++i)
+        {
+            const int channel = index2coord(dst.shape(), i).z();
+            dst[i]            = dst[i] * scale[channel] + shift[channel];
+        }
+        dst = reference::activation_layer(dst, act_info);
+
+        if(!chained)
+        {
+            return dst;
+        }
+
+        SimpleTensor<float> next_weights{ next_weights_shape, DataType::F32 };
+        SimpleTensor<float> next_bias{ TensorShape(_next_num_kernels), DataType::F32 };
+
+        this->fill(next_weights, 5);
+        this->fill(next_bias, 6);
+
+        return reference::binary_convolution(dst, next_weights, next_bias, next_out_shape, PadStrideInfo(1, 1, 1, 1));
+    }
+
+    using BinaryConvolutionLayerValidationFixture<TensorType, AccessorType, FunctionType>::compute_reference;
+
+    static constexpr unsigned int _next_num_kernels = 8; /**< Number of kernels of the layer consuming the binarized output when chained */
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -124,6 +124,115 @@ protected:
     SimpleTensor<int32_t> _reference{};
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class GEMMLowpMatrixMultiplyCoreFusedOffsetOutputValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, int32_t a_offset, int32_t b_offset, int32_t result_fixedpoint_multiplier, int32_t result_shift,
+               int32_t result_offset_after_shift, int32_t min, int32_t max, bool add_bias)
+    {
+        GEMMLowpOutputStageInfo output_stage;
+        output_stage.type                = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+        output_stage.gemmlowp_offset     = result_offset_after_shift;
+        output_stage.gemmlowp_multiplier = result_fixedpoint_multiplier;
+        output_stage.gemmlowp_shift      = result_shift;
+        output_stage.gemmlowp_min_bound  = min;
+        output_stage.gemmlowp_max_bound  = max;
+
+        _target    = compute_target(shape_a, shape_b, shape_c, a_offset, b_offset, output_stage, add_bias);
+        _reference = compute_reference(shape_a, shape_b, shape_c, a_offset, b_offset, output_stage, add_bias);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        // Between 1 and 254 in order to avoid having -128 and 128 for the DOT product path
+        std::uniform_int_distribution<> distribution(1, 254);
+        library->fill(tensor, distribution, i);
+    }
+
+    template <typename U>
+    void fill_bias(U &&tensor, int i)
+    {
+        std::uniform_int_distribution<> distribution(-6000, 6000);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &shape_c, int32_t a_offset, int32_t b_offset,
+                              const GEMMLowpOutputStageInfo &output_stage, bool add_bias)
+    {
+        // Create tensors
+        TensorType a    = create_tensor<TensorType>(shape_a, DataType::QASYMM8, 1);
+        TensorType b    = create_tensor<TensorType>(shape_b, DataType::QASYMM8, 1);
+        TensorType bias = create_tensor<TensorType>(TensorShape(shape_c[0]), DataType::S32, 1);
+        TensorType c    = create_tensor<TensorType>(shape_c, DataType::QASYMM8, 1);
+
+        a.info()->set_quantization_info(QuantizationInfo(1.0f / 255, a_offset));
+        b.info()->set_quantization_info(QuantizationInfo(1.0f / 255, b_offset));
+
+        // Create and configure function
+        FunctionType gemmlowp;
+        gemmlowp.configure(&a, &b, add_bias ? &bias : nullptr, &c, GEMMInfo(false, false, false, 0, false, false, output_stage));
+
+        ARM_COMPUTE_EXPECT(a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(c.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        bias.allocator()->allocate();
+        c.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!c.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+        fill_bias(AccessorType(bias), 2);
+
+        // Compute GEMM function
+        gemmlowp.run();
+        return c;
+    }
+
+    SimpleTensor<uint8_t> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &shape_c, int32_t a_offset, int32_t b_offset,
+                                            const GEMMLowpOutputStageInfo &output_stage, bool add_bias)
+    {
+        // Create reference
+        SimpleTensor<uint8_t> a{ shape_a, DataType::QASYMM8, 1 };
+        SimpleTensor<uint8_t> b{ shape_b, DataType::QASYMM8, 1 };
+        SimpleTensor<int32_t> bias{ TensorShape(shape_c[0]), DataType::S32, 1 };
+
+        // Fill reference
+        fill(a, 0);
+        fill(b, 1);
+        fill_bias(bias, 2);
+
+        const SimpleTensor<int32_t> mm_result = reference::gemmlowp_matrix_multiply_core<int32_t, uint8_t>(a, b, shape_c, a_offset, b_offset);
+
+        if(add_bias)
+        {
+            return reference::gemmlowp_quantize_down_int32_to_uint8_scale_by_fixedpoint<int32_t>(mm_result, bias, output_stage.gemmlowp_multiplier, output_stage.gemmlowp_shift,
+                                                                                                   output_stage.gemmlowp_offset, output_stage.gemmlowp_min_bound, output_stage.gemmlowp_max_bound);
+        }
+        else
+        {
+            return reference::gemmlowp_quantize_down_int32_to_uint8_scale_by_fixedpoint<int32_t>(mm_result, output_stage.gemmlowp_multiplier, output_stage.gemmlowp_shift,
+                                                                                                   output_stage.gemmlowp_offset, output_stage.gemmlowp_min_bound, output_stage.gemmlowp_max_bound);
+        }
+    }
+
+    TensorType            _target{};
+    SimpleTensor<uint8_t> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType>
 class GEMMLowpQuantizeDownInt32ToUint8ScaleValidationFixture : public framework::Fixture
 {
@@ -45,10 +45,10 @@ class PaddingFixture : public framework::Fixture
 {
 public:
     template <typename...>
-    void setup(TensorShape shape, DataType data_type, const PaddingList &padding)
+    void setup(TensorShape shape, DataType data_type, const PaddingList &padding, PaddingMode mode)
     {
-        _target    = compute_target(shape, data_type, padding);
-        _reference = compute_reference(shape, data_type, padding);
+        _target    = compute_target(shape, data_type, padding, mode);
+        _reference = compute_reference(shape, data_type, padding, mode);
     }
 
 protected:
@@ -60,7 +60,8 @@ protected:
 
     TensorType compute_target(const TensorShape &shape,
                               DataType           data_type,
-                              const PaddingList &paddings)
+                              const PaddingList &paddings,
+                              PaddingMode        mode)
     {
         // Create tensors
         TensorType src = create_tensor<TensorType>(shape, data_type);
@@ -68,7 +69,7 @@ protected:
 
         // Create and configure function
         FunctionType padding;
-        padding.configure(&src, &dst, paddings);
+        padding.configure(&src, &dst, paddings, PixelValue(), mode);
 
         ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
         ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
@@ -90,7 +91,8 @@ protected:
     }
 
     SimpleTensor<T> compute_reference(const TensorShape &shape, DataType data_type,
-                                      const PaddingList &paddings)
+                                      const PaddingList &paddings,
+                              PaddingMode        mode)
     {
         // Create reference tensor
         SimpleTensor<T> src{ shape, data_type };
@@ -98,7 +100,7 @@ protected:
         // Fill reference tensor
         fill(src);
 
-        return reference::pad_layer(src, paddings);
+        return reference::pad_layer(src, paddings, mode);
     }
 
     TensorType      _target{};
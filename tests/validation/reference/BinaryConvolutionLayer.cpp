@@ -85,13 +85,14 @@ SimpleTensor<float> binary_convolution(const SimpleTensor<float> &src, const Sim
     SimpleTensor<float>   beta{};
     SimpleTensor<float>   dummy{}; // For unused alpha/beta
     
-    const PaddingList padding { PaddingInfo(info.pad_left(), info.pad_right()), PaddingInfo(info.pad_top(), info.pad_bottom()) };
+    const PaddingList   padding { PaddingInfo(info.pad_left(), info.pad_right()), PaddingInfo(info.pad_top(), info.pad_bottom()) };
+    const PadStrideInfo stride_info(info.stride().first, info.stride().second, 0, 0);
     SimpleTensor<float> padded_src = pad_layer(src, padding);
     
     std::tie(bin_weights, alpha, dummy) = binary_sign(weights);
     std::tie(bin_src, dummy, beta)      = binary_sign(padded_src);
     
-    SimpleTensor<float> K = pooling_layer(beta, PoolingLayerInfo(PoolingType::AVG, weights.shape().x(), PadStrideInfo()));
+    SimpleTensor<float> K = pooling_layer(beta, PoolingLayerInfo(PoolingType::AVG, Size2D(weights.shape().x(), weights.shape().y()), stride_info));
     SimpleTensor<float> Ka { output_shape, DataType::F32 }; // 3D Ka
     
     for(size_t batch = 0; batch < Ka.shape().total_size_upper(3); ++batch)
@@ -121,7 +122,7 @@ SimpleTensor<float> binary_convolution(const SimpleTensor<float> &src, const Sim
     // "Un-binarize" weights and src, perform convolution and apply normalization
     SimpleTensor<float> unbin_weights = unbinarize(bin_weights, weights.shape());
     SimpleTensor<float> unbin_src     = unbinarize(bin_src, padded_src.shape());
-    SimpleTensor<float> binary_conv   = convolution_layer(unbin_src, unbin_weights, dummy_bias, output_shape, PadStrideInfo());
+    SimpleTensor<float> binary_conv   = convolution_layer(unbin_src, unbin_weights, dummy_bias, output_shape, stride_info);
     
     SimpleTensor<float> dst { output_shape, DataType::F32 };
     for(int i = 0; i < dst.num_elements(); ++i)
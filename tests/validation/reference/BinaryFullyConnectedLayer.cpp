@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "BinaryFullyConnectedLayer.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+SimpleTensor<float> binary_fully_connected_layer(const SimpleTensor<float> &src, const SimpleTensor<float> &weights, const SimpleTensor<float> &bias,
+                                                 const TensorShape &dst_shape)
+{
+    SimpleTensor<float> dst{ dst_shape, DataType::F32 };
+
+    const int num_inputs  = src.shape().x();
+    const int num_outputs = weights.shape().y();
+    const int num_batches = src.shape().total_size_upper(1);
+
+    for(int b = 0; b < num_batches; ++b)
+    {
+        const float *src_row = src.data() + b * num_inputs;
+
+        // Beta is the mean over absolute values of the input sample
+        float beta = 0.f;
+        for(int i = 0; i < num_inputs; ++i)
+        {
+            beta += std::abs(src_row[i]);
+        }
+        beta /= num_inputs;
+
+        for(int o = 0; o < num_outputs; ++o)
+        {
+            const float *weights_row = weights.data() + o * num_inputs;
+
+            // Alpha is the mean over absolute values of the weights of the output, 0 binarizes to -1
+            float alpha = 0.f;
+            int   acc   = 0;
+            for(int i = 0; i < num_inputs; ++i)
+            {
+                alpha += std::abs(weights_row[i]);
+                acc += ((src_row[i] > 0.f) == (weights_row[i] > 0.f)) ? 1 : -1;
+            }
+            alpha /= num_inputs;
+
+            dst[b * num_outputs + o] = acc * alpha * beta + bias[o];
+        }
+    }
+
+    return dst;
+}
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
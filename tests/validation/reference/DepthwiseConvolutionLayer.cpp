@@ -50,7 +50,7 @@ namespace reference
  */
 template <typename T, typename TB>
 SimpleTensor<T> depthwise_convolution(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<TB> &biases, const TensorShape &dst_shape, const PadStrideInfo &conv_info,
-                                      unsigned int depth_multiplier)
+                                      unsigned int depth_multiplier, const Size2D &dilation)
 {
     SimpleTensor<T> dst{ dst_shape, src.data_type(), 1 };
 
@@ -63,18 +63,13 @@ SimpleTensor<T> depthwise_convolution(const SimpleTensor<T> &src, const SimpleTe
     const int input_depth   = src.shape().z();
     const int num_batches   = src.shape().total_size() / (input_width * input_height * input_depth);
 
-    const int filter_half_width  = filter_width / 2;
-    const int filter_half_height = filter_height / 2;
+    const int output_width  = dst_shape.x();
+    const int output_height = dst_shape.y();
 
-    const int pad_left   = conv_info.pad_left();
-    const int pad_top    = conv_info.pad_top();
-    const int pad_right  = conv_info.pad_right();
-    const int pad_bottom = conv_info.pad_bottom();
-
-    const int minimum_x = -pad_left + filter_half_width;
-    const int minimum_y = -pad_top + filter_half_height;
-    const int maximum_x = input_width + pad_left - filter_half_width + pad_right - filter_half_width;
-    const int maximum_y = input_height + pad_top - filter_half_height + pad_bottom - filter_half_height;
+    const int pad_left = conv_info.pad_left();
+    const int pad_top  = conv_info.pad_top();
+    const int stride_x = conv_info.stride().first;
+    const int stride_y = conv_info.stride().second;
 
     const T border_value(0);
 
@@ -87,20 +82,22 @@ SimpleTensor<T> depthwise_convolution(const SimpleTensor<T> &src, const SimpleTe
             {
                 const int out_z = z * depth_multiplier + m;
 
-                for(int y = minimum_y; y < minimum_y + maximum_y; y += conv_info.stride().second)
+                for(int oy = 0; oy < output_height; ++oy)
                 {
-                    for(int x = minimum_x; x < minimum_x + maximum_x; x += conv_info.stride().first)
+                    const int y = oy * stride_y - pad_top;
+                    for(int ox = 0; ox < output_width; ++ox)
                     {
-                        Coordinates coords(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z), static_cast<int>(r));
+                        const int   x = ox * stride_x - pad_left;
+                        Coordinates coords(x, y, z, r);
                         size_t      filter_offset = filter_plane * out_z;
 
                         T val(0);
-                        for(int j = y - filter_half_height; j <= static_cast<int>(y + filter_half_height); ++j)
+                        for(int j = 0; j < filter_height; ++j)
                         {
-                            for(int i = x - filter_half_width; i <= static_cast<int>(x + filter_half_width); ++i)
+                            for(int i = 0; i < filter_width; ++i)
                             {
-                                coords.set(0, i);
-                                coords.set(1, j);
+                                coords.set(0, x + i * static_cast<int>(dilation.x()));
+                                coords.set(1, y + j * static_cast<int>(dilation.y()));
 
                                 val += *(weights.data() + filter_offset) * tensor_elem_at(src, coords, BorderMode::CONSTANT, border_value);
                                 ++filter_offset;
@@ -119,7 +116,7 @@ SimpleTensor<T> depthwise_convolution(const SimpleTensor<T> &src, const SimpleTe
 
 template <>
 SimpleTensor<uint8_t> depthwise_convolution(const SimpleTensor<uint8_t> &src, const SimpleTensor<uint8_t> &weights, const SimpleTensor<int32_t> &biases, const TensorShape &dst_shape,
-                                            const PadStrideInfo &conv_info, unsigned int depth_multiplier)
+                                            const PadStrideInfo &conv_info, unsigned int depth_multiplier, const Size2D &dilation)
 {
     SimpleTensor<uint8_t> dst{ dst_shape, src.data_type(), 1, src.quantization_info() };
 
@@ -145,18 +142,13 @@ SimpleTensor<uint8_t> depthwise_convolution(const SimpleTensor<uint8_t> &src, co
     const int input_depth   = src.shape().z();
     const int num_batches   = src.shape().total_size() / (input_width * input_height * input_depth);
 
-    const int filter_half_width  = filter_width / 2;
-    const int filter_half_height = filter_height / 2;
-
-    const int pad_left   = conv_info.pad_left();
-    const int pad_top    = conv_info.pad_top();
-    const int pad_right  = conv_info.pad_right();
-    const int pad_bottom = conv_info.pad_bottom();
+    const int output_width  = dst_shape.x();
+    const int output_height = dst_shape.y();
 
-    const int minimum_x = -pad_left + filter_half_width;
-    const int minimum_y = -pad_top + filter_half_height;
-    const int maximum_x = input_width + pad_left - filter_half_width + pad_right - filter_half_width;
-    const int maximum_y = input_height + pad_top - filter_half_height + pad_bottom - filter_half_height;
+    const int pad_left = conv_info.pad_left();
+    const int pad_top  = conv_info.pad_top();
+    const int stride_x = conv_info.stride().first;
+    const int stride_y = conv_info.stride().second;
 
     int out_pos = 0;
     for(int r = 0; r < num_batches; ++r)
@@ -168,20 +160,22 @@ SimpleTensor<uint8_t> depthwise_convolution(const SimpleTensor<uint8_t> &src, co
                 const int     out_z    = z * depth_multiplier + m;
                 const int32_t bias_val = *static_cast<const int32_t *>(biases(Coordinates(out_z)));
 
-                for(int y = minimum_y; y < minimum_y + maximum_y; y += conv_info.stride().second)
+                for(int oy = 0; oy < output_height; ++oy)
                 {
-                    for(int x = minimum_x; x < minimum_x + maximum_x; x += conv_info.stride().first)
+                    const int y = oy * stride_y - pad_top;
+                    for(int ox = 0; ox < output_width; ++ox)
                     {
+                        const int   x = ox * stride_x - pad_left;
                         Coordinates coords(x, y, z, r);
                         int         filter_offset = filter_plane * out_z;
 
                         int32_t val = 0;
-                        for(int j = y - filter_half_height; j <= (y + filter_half_height); ++j)
+                        for(int j = 0; j < filter_height; ++j)
                         {
-                            for(int i = x - filter_half_width; i <= (x + filter_half_width); ++i)
+                            for(int i = 0; i < filter_width; ++i)
                             {
-                                coords.set(0, i);
-                                coords.set(1, j);
+                                coords.set(0, x + i * static_cast<int>(dilation.x()));
+                                coords.set(1, y + j * static_cast<int>(dilation.y()));
                                 const auto    in_val = tensor_elem_at<uint8_t>(src, coords, BorderMode::CONSTANT, -input_offset);
                                 const uint8_t w_val  = *(weights.data() + filter_offset);
                                 val += (in_val + input_offset) * (w_val + weights_offset);
@@ -206,10 +200,10 @@ SimpleTensor<uint8_t> depthwise_convolution(const SimpleTensor<uint8_t> &src, co
 }
 
 template SimpleTensor<float> depthwise_convolution(const SimpleTensor<float> &src, const SimpleTensor<float> &weights, const SimpleTensor<float> &biases, const TensorShape &dst_shape,
-                                                   const PadStrideInfo &conv_info, unsigned int depth_multiplier);
+                                                   const PadStrideInfo &conv_info, unsigned int depth_multiplier, const Size2D &dilation);
 
 template SimpleTensor<half> depthwise_convolution(const SimpleTensor<half> &src, const SimpleTensor<half> &weights, const SimpleTensor<half> &biases, const TensorShape &dst_shape,
-                                                  const PadStrideInfo &conv_info, unsigned int depth_multiplier);
+                                                  const PadStrideInfo &conv_info, unsigned int depth_multiplier, const Size2D &dilation);
 } // namespace reference
 } // namespace validation
 } // namespace test
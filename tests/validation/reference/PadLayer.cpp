@@ -36,7 +36,7 @@ namespace validation
 namespace reference
 {
 template <typename T>
-SimpleTensor<T> pad_layer(const SimpleTensor<T> &src, const PaddingList &paddings)
+SimpleTensor<T> pad_layer(const SimpleTensor<T> &src, const PaddingList &paddings, PaddingMode mode)
 {
     DataType dst_data_type = src.data_type();
 
@@ -73,10 +73,33 @@ SimpleTensor<T> pad_layer(const SimpleTensor<T> &src, const PaddingList &padding
         };
 
         // If the tuple [i,j,k,l,m] is in the padding area, then seimply set the value
-        if(std::any_of(dims.begin(), dims.end(), is_padding_area))
+        if(mode == PaddingMode::CONSTANT && std::any_of(dims.begin(), dims.end(), is_padding_area))
         {
             dst[idx] = T(0);
         }
+        else if(std::any_of(dims.begin(), dims.end(), is_padding_area))
+        {
+            // Mirror the coordinates in the padding area back into the input
+            Coordinates orig_coords;
+            for(size_t d = 0; d < TensorShape::num_max_dimensions; ++d)
+            {
+                const int size   = orig_shape[d];
+                const int repeat = (mode == PaddingMode::SYMMETRIC) ? 1 : 0;
+                int       c      = static_cast<int>(coords[d]) - static_cast<int>(paddings_extended[d].first);
+                if(c < 0)
+                {
+                    c = -c - repeat;
+                }
+                else if(c >= size)
+                {
+                    c = 2 * size - 2 + repeat - c;
+                }
+                orig_coords.set(d, c);
+            }
+
+            const size_t idx_src = coord2index(orig_shape, orig_coords);
+            dst[idx]             = src[idx_src];
+        }
         else
         {
             // If the tuple[i,j,k,l,m] is not in the padding area, then copy the input into the output
@@ -96,13 +119,13 @@ SimpleTensor<T> pad_layer(const SimpleTensor<T> &src, const PaddingList &padding
     return dst;
 }
 
-template SimpleTensor<float> pad_layer(const SimpleTensor<float> &src, const PaddingList &paddings);
-template SimpleTensor<half> pad_layer(const SimpleTensor<half> &src, const PaddingList &paddings);
-template SimpleTensor<uint32_t> pad_layer(const SimpleTensor<uint32_t> &src, const PaddingList &paddings);
-template SimpleTensor<uint8_t> pad_layer(const SimpleTensor<uint8_t> &src, const PaddingList &paddings);
-template SimpleTensor<int8_t> pad_layer(const SimpleTensor<int8_t> &src, const PaddingList &paddings);
-template SimpleTensor<uint16_t> pad_layer(const SimpleTensor<uint16_t> &src, const PaddingList &paddings);
-template SimpleTensor<int16_t> pad_layer(const SimpleTensor<int16_t> &src, const PaddingList &paddings);
+template SimpleTensor<float> pad_layer(const SimpleTensor<float> &src, const PaddingList &paddings, PaddingMode mode);
+template SimpleTensor<half> pad_layer(const SimpleTensor<half> &src, const PaddingList &paddings, PaddingMode mode);
+template SimpleTensor<uint32_t> pad_layer(const SimpleTensor<uint32_t> &src, const PaddingList &paddings, PaddingMode mode);
+template SimpleTensor<uint8_t> pad_layer(const SimpleTensor<uint8_t> &src, const PaddingList &paddings, PaddingMode mode);
+template SimpleTensor<int8_t> pad_layer(const SimpleTensor<int8_t> &src, const PaddingList &paddings, PaddingMode mode);
+template SimpleTensor<uint16_t> pad_layer(const SimpleTensor<uint16_t> &src, const PaddingList &paddings, PaddingMode mode);
+template SimpleTensor<int16_t> pad_layer(const SimpleTensor<int16_t> &src, const PaddingList &paddings, PaddingMode mode);
 } // namespace reference
 } // namespace validation
 } // namespace test
@@ -41,11 +41,12 @@ namespace reference
  *
  * @param[in] src      Tensor to pad
  * @param[in] paddings Padding size in each dimension
+ * @param[in] mode     (Optional) Padding mode
  *
  * @return The padded Tensor
  */
 template <typename T>
-SimpleTensor<T> pad_layer(const SimpleTensor<T> &src, const PaddingList &paddings);
+SimpleTensor<T> pad_layer(const SimpleTensor<T> &src, const PaddingList &paddings, PaddingMode mode = PaddingMode::CONSTANT);
 } // namespace reference
 } // namespace validation
 } // namespace test
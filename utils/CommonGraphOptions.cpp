@@ -85,6 +85,8 @@ namespace utils
     os << "Tuner enabled? : " << (common_params.enable_tuner ? true_str : false_str) << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str) << std::endl;
+    os << "Dataflow execution enabled? : " << (common_params.execution_strategy == ExecutionStrategy::Dataflow ? true_str : false_str) << std::endl;
+    os << "Pipeline stages : " << common_params.pipeline_stages << std::endl;
     if(!common_params.data_path.empty())
     {
         os << "Data path : " << common_params.data_path << std::endl;
@@ -118,6 +120,8 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       data_layout(),
       enable_tuner(parser.add_option<ToggleOption>("enable-tuner")),
       fast_math_hint(parser.add_option<ToggleOption>("fast-math")),
+      dataflow(parser.add_option<ToggleOption>("dataflow")),
+      pipeline_stages(parser.add_option<SimpleOption<unsigned int>>("pipeline-stages", 0)),
       data_path(parser.add_option<SimpleOption<std::string>>("data")),
       image(parser.add_option<SimpleOption<std::string>>("image")),
       labels(parser.add_option<SimpleOption<std::string>>("labels")),
@@ -157,6 +161,8 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     data_layout->set_help("Data layout to use");
     enable_tuner->set_help("Enable OpenCL dynamic tuner");
     fast_math_hint->set_help("Enable fast math");
+    dataflow->set_help("Execute independent graph nodes concurrently (NEON only)");
+    pipeline_stages->set_help("Number of stages to stream the inputs through, 0 to disable (NEON only)");
     data_path->set_help("Path where graph parameters reside");
     image->set_help("Input image for the graph");
     labels->set_help("File containing the output labels");
@@ -182,6 +188,12 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     }
     common_params.enable_tuner           = options.enable_tuner->is_set() ? options.enable_tuner->value() : false;
     common_params.fast_math_hint         = options.fast_math_hint->is_set() ? fast_math_hint_value : FastMathHint::Disabled;
+    common_params.execution_strategy     = (options.dataflow->is_set() && options.dataflow->value()) ? ExecutionStrategy::Dataflow : ExecutionStrategy::Sequential;
+    common_params.pipeline_stages        = options.pipeline_stages->value();
+    if(common_params.pipeline_stages > 0)
+    {
+        common_params.execution_strategy = ExecutionStrategy::Pipelined;
+    }
     common_params.data_path              = options.data_path->value();
     common_params.image                  = options.image->value();
     common_params.labels                 = options.labels->value();
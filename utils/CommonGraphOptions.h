@@ -44,6 +44,8 @@ namespace utils
  * --layout           : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
  * --enable-tuner     : Toggle option to enable the OpenCL dynamic tuner.
  * --fast-math        : Toggle option to enable the fast math option.
+ * --dataflow         : Toggle option to execute independent graph nodes concurrently (NEON only).
+ * --pipeline-stages  : Number of stages to split the graph in to stream the inputs through (NEON only). 0 disables the pipelined execution.
  * --data             : Path that contains the trainable parameter files of graph layers.
  * --image            : Image to load and operate on. Image types supported: PPM, JPEG, NPY.
  * --labels           : File that contains the labels that classify upon.
@@ -87,21 +89,23 @@ namespace utils
 /** Structure holding all the common graph parameters */
 struct CommonGraphParams
 {
-    bool                             help{ false };
-    int                              threads{ 0 };
-    arm_compute::graph::Target       target{ arm_compute::graph::Target::NEON };
-    arm_compute::DataType            data_type{ DataType::F32 };
-    arm_compute::DataLayout          data_layout{ DataLayout::NHWC };
-    bool                             enable_tuner{ false };
-    arm_compute::graph::FastMathHint fast_math_hint{ arm_compute::graph::FastMathHint::Disabled };
-    std::string                      data_path{};
-    std::string                      image{};
-    std::string                      labels{};
-    std::string                      validation_file{};
-    std::string                      validation_path{};
-    std::string                      tuner_file{};
-    unsigned int                     validation_range_start{ 0 };
-    unsigned int                     validation_range_end{ std::numeric_limits<unsigned int>::max() };
+    bool                                  help{ false };
+    int                                   threads{ 0 };
+    arm_compute::graph::Target            target{ arm_compute::graph::Target::NEON };
+    arm_compute::DataType                 data_type{ DataType::F32 };
+    arm_compute::DataLayout               data_layout{ DataLayout::NHWC };
+    bool                                  enable_tuner{ false };
+    arm_compute::graph::FastMathHint      fast_math_hint{ arm_compute::graph::FastMathHint::Disabled };
+    arm_compute::graph::ExecutionStrategy execution_strategy{ arm_compute::graph::ExecutionStrategy::Sequential };
+    unsigned int                          pipeline_stages{ 0 };
+    std::string                           data_path{};
+    std::string                           image{};
+    std::string                           labels{};
+    std::string                           validation_file{};
+    std::string                           validation_path{};
+    std::string                           tuner_file{};
+    unsigned int                          validation_range_start{ 0 };
+    unsigned int                          validation_range_end{ std::numeric_limits<unsigned int>::max() };
 };
 
 /** Formatted output of the CommonGraphParams type
@@ -148,6 +152,8 @@ public:
     EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
     ToggleOption                           *enable_tuner;     /**< Enable tuner */
     ToggleOption                           *fast_math_hint;   /**< Fast math hint */
+    ToggleOption                           *dataflow;         /**< Dataflow execution */
+    SimpleOption<unsigned int>             *pipeline_stages;  /**< Number of pipeline stages */
     SimpleOption<std::string>              *data_path;        /**< Trainable parameters path */
     SimpleOption<std::string>              *image;            /**< Image */
     SimpleOption<std::string>              *labels;           /**< Labels */
@@ -882,6 +882,33 @@ inline ::std::ostream &operator<<(::std::ostream &os, const PaddingList &padding
     return os;
 }
 
+/** Formatted output of the PaddingMode type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  mode Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const PaddingMode &mode)
+{
+    switch(mode)
+    {
+        case PaddingMode::CONSTANT:
+            os << "CONSTANT";
+            break;
+        case PaddingMode::REFLECT:
+            os << "REFLECT";
+            break;
+        case PaddingMode::SYMMETRIC:
+            os << "SYMMETRIC";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
 /** Formatted output of the Multiples type.
  *
  * @param[out] os        Output stream.
@@ -1252,6 +1279,19 @@ inline std::string to_string(const PaddingList &padding)
     return str.str();
 }
 
+/** Formatted output of the PaddingMode type.
+ *
+ * @param[in] mode Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const PaddingMode &mode)
+{
+    std::stringstream str;
+    str << mode;
+    return str.str();
+}
+
 /** Formatted output of the Multiples type.
  *
  * @param[in] multiples Type to output.